@@ -82,6 +82,8 @@ class OhOsTargetEntryBuilder : KuiklyCoreAbsEntryBuilder() {
                                 )
                             } catch(t: Throwable){
                                 ExceptionTracker.notifyKuiklyException(t)
+                            } finally {
+                                NativeBridge.flushAllRenderCommands()
                             }
                 })
             """.trimIndent())
@@ -87,6 +87,8 @@ class OhOsTargetMultiEntryBuilder(private val isMainModule: Boolean, private val
                                 )
                             } catch(t: Throwable){
                                 ExceptionTracker.notifyKuiklyException(t)
+                            } finally {
+                                NativeBridge.flushAllRenderCommands()
                             }
                 })
             """.trimIndent())
@@ -37,7 +37,7 @@ IKRRenderNativeContextHandler::OnCallNative(const KuiklyRenderNativeMethod &meth
                                             std::shared_ptr<KRRenderValue> &arg3, std::shared_ptr<KRRenderValue> &arg4,
                                             std::shared_ptr<KRRenderValue> &arg5) {
     return call_native_callback_ ? call_native_callback_->OnCallNative(method, arg0, arg1, arg2, arg3, arg4, arg5)
-                              : std::make_shared<KRRenderValue>();
+                              : KRRenderValue::Create();
 }
 
 KRRenderCValue IKRRenderNativeContextHandler::DispatchCallNative(const std::string &instanceId, int methodId,
@@ -45,6 +45,14 @@ KRRenderCValue IKRRenderNativeContextHandler::DispatchCallNative(const std::stri
                                                                  const KRRenderCValue &arg2, const KRRenderCValue &arg3,
                                                                  const KRRenderCValue &arg4,
                                                                  const KRRenderCValue &arg5) {
+    return DispatchCallNative(instanceId.c_str(), methodId, arg0, arg1, arg2, arg3, arg4, arg5);
+}
+
+KRRenderCValue IKRRenderNativeContextHandler::DispatchCallNative(const char *instanceId, int methodId,
+                                                                 const KRRenderCValue &arg0, const KRRenderCValue &arg1,
+                                                                 const KRRenderCValue &arg2, const KRRenderCValue &arg3,
+                                                                 const KRRenderCValue &arg4,
+                                                                 const KRRenderCValue &arg5) {
     return KRRenderNativeContextHandlerManager::GetInstance().DispatchCallNative(instanceId, methodId, arg0, arg1, arg2,
                                                                                  arg3, arg4, arg5);
 }
@@ -51,7 +51,9 @@ enum class KuiklyRenderNativeMethod {
     KuiklyRenderNativeMethodCallShadowMethod = 14,        // "callShadowModule方法"
     KuiklyRenderNativeMethodFireFatalException = 15,      // "fireFatalException"方法
     KuiklyRenderNativeMethodSyncFlushUI = 16,             // "syncFlushUI方法"
-    KuiklyRenderNativeMethodCallTDFNativeMethod = 17      // "callTDFModuleMethod"
+    KuiklyRenderNativeMethodCallTDFNativeMethod = 17,     // "callTDFModuleMethod"
+    KuiklyRenderNativeMethodFlushRenderCommands = 18,     // "flushRenderCommands" 批量渲染指令
+    KuiklyRenderNativeMethodClearTimeout = 19             // "clearTimeout方法"
 };
 
 class IKRRenderNativeContextHandler;
@@ -78,6 +80,10 @@ class IKRRenderNativeContextHandler : public std::enable_shared_from_this<IKRRen
                                              const KRRenderCValue &arg1, const KRRenderCValue &arg2,
                                              const KRRenderCValue &arg3, const KRRenderCValue &arg4,
                                              const KRRenderCValue &arg5);
+    static KRRenderCValue DispatchCallNative(const char *instanceId, int methodId, const KRRenderCValue &arg0,
+                                             const KRRenderCValue &arg1, const KRRenderCValue &arg2,
+                                             const KRRenderCValue &arg3, const KRRenderCValue &arg4,
+                                             const KRRenderCValue &arg5);
     
     static void SetContextHandlerCreator(const KRRenderContextHandlerCreator &creator);
 
@@ -0,0 +1,197 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 THL A29 Limited, a Tencent company. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/context/KRInstanceHandleTable.h"
+
+#include <cstring>
+#include "libohos_render/context/IKRRenderNativeContextHandler.h"
+#include "libohos_render/scheduler/KRContextScheduler.h"
+#include "libohos_render/utils/KRRenderLoger.h"
+
+namespace {
+
+/**
+ * 桥接调用集中在 Context 线程且通常连续来自少数几个页面，缓存最近解析过的 instanceId
+ */
+struct KRResolveCache {
+    static constexpr size_t kSize = 4;
+    std::string instance_ids[kSize];
+    KRInstanceHandle handles[kSize] = {};
+    size_t next = 0;
+};
+
+thread_local KRResolveCache g_resolve_cache;
+
+}  // namespace
+
+KRInstanceHandleTable &KRInstanceHandleTable::GetInstance() {
+    static KRInstanceHandleTable instance;
+    return instance;
+}
+
+void KRInstanceHandleTable::RegisterContextHandler(
+    const std::string &instance_id, const std::shared_ptr<IKRRenderNativeContextHandler> &context_handler) {
+    std::shared_ptr<IKRRenderNativeContextHandler> replaced;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto handle = FindOrAllocLocked(instance_id);
+        if (handle == kKRInvalidInstanceHandle) {
+            return;
+        }
+        auto index = static_cast<uint32_t>(handle);
+        replaced = std::move(owned_handlers_[index]);
+        owned_handlers_[index] = context_handler;
+        slots_[index].context_handler.store(context_handler.get(), std::memory_order_release);
+    }
+    if (replaced != nullptr && replaced != context_handler) {
+        ReleaseOnContextThread(std::move(replaced));
+    }
+}
+
+void KRInstanceHandleTable::UnregisterContextHandler(const std::string &instance_id) {
+    std::shared_ptr<IKRRenderNativeContextHandler> released;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = index_map_.find(instance_id);
+        if (it == index_map_.end()) {
+            return;
+        }
+        auto index = it->second;
+        slots_[index].context_handler.store(nullptr, std::memory_order_release);
+        released = std::move(owned_handlers_[index]);
+        ReleaseIfUnusedLocked(instance_id, index);
+    }
+    if (released) {
+        ReleaseOnContextThread(std::move(released));
+    }
+}
+
+void KRInstanceHandleTable::ReleaseOnContextThread(std::shared_ptr<IKRRenderNativeContextHandler> context_handler) {
+    KRContextScheduler::ScheduleTask(false, 0, [context_handler = std::move(context_handler)] {});
+}
+
+void KRInstanceHandleTable::SetRenderViewAlive(const std::string &instance_id, bool alive) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (alive) {
+        auto handle = FindOrAllocLocked(instance_id);
+        if (handle != kKRInvalidInstanceHandle) {
+            slots_[static_cast<uint32_t>(handle)].render_view_alive.store(true, std::memory_order_release);
+        }
+        return;
+    }
+    auto it = index_map_.find(instance_id);
+    if (it == index_map_.end()) {
+        return;
+    }
+    auto index = it->second;
+    slots_[index].render_view_alive.store(false, std::memory_order_release);
+    ReleaseIfUnusedLocked(instance_id, index);
+}
+
+KRInstanceHandle KRInstanceHandleTable::Resolve(const char *instance_id) {
+    if (instance_id == nullptr) {
+        return kKRInvalidInstanceHandle;
+    }
+    auto &cache = g_resolve_cache;
+    for (size_t i = 0; i < KRResolveCache::kSize; ++i) {
+        if (cache.handles[i] != kKRInvalidInstanceHandle && SlotForHandle(cache.handles[i]) != nullptr &&
+            std::strcmp(cache.instance_ids[i].c_str(), instance_id) == 0) {
+            return cache.handles[i];
+        }
+    }
+    KRInstanceHandle handle = kKRInvalidInstanceHandle;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = index_map_.find(instance_id);
+        if (it == index_map_.end()) {
+            return kKRInvalidInstanceHandle;
+        }
+        handle = MakeHandle(it->second, slots_[it->second].generation.load(std::memory_order_relaxed));
+    }
+    auto slot = cache.next++ % KRResolveCache::kSize;
+    cache.instance_ids[slot] = instance_id;
+    cache.handles[slot] = handle;
+    return handle;
+}
+
+IKRRenderNativeContextHandler *KRInstanceHandleTable::GetContextHandler(KRInstanceHandle handle) const {
+    auto slot = SlotForHandle(handle);
+    if (slot == nullptr) {
+        return nullptr;
+    }
+    auto context_handler = slot->context_handler.load(std::memory_order_acquire);
+    // 读取期间槽位可能被回收并分配给新实例，再次校验 generation
+    return SlotForHandle(handle) != nullptr ? context_handler : nullptr;
+}
+
+std::shared_ptr<IKRRenderNativeContextHandler> KRInstanceHandleTable::CopyContextHandler(KRInstanceHandle handle) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (SlotForHandle(handle) == nullptr) {
+        return nullptr;
+    }
+    return owned_handlers_[static_cast<uint32_t>(handle)];
+}
+
+bool KRInstanceHandleTable::IsRenderViewAlive(KRInstanceHandle handle) const {
+    auto slot = SlotForHandle(handle);
+    if (slot == nullptr) {
+        return false;
+    }
+    auto alive = slot->render_view_alive.load(std::memory_order_acquire);
+    return alive && SlotForHandle(handle) != nullptr;
+}
+
+const KRInstanceHandleTable::Slot *KRInstanceHandleTable::SlotForHandle(KRInstanceHandle handle) const {
+    auto index = static_cast<uint32_t>(handle);
+    if (handle == kKRInvalidInstanceHandle || index >= kMaxSlots) {
+        return nullptr;
+    }
+    const auto &slot = slots_[index];
+    if (slot.generation.load(std::memory_order_acquire) != static_cast<uint32_t>(handle >> 32)) {
+        return nullptr;
+    }
+    return &slot;
+}
+
+KRInstanceHandle KRInstanceHandleTable::FindOrAllocLocked(const std::string &instance_id) {
+    auto it = index_map_.find(instance_id);
+    uint32_t index = 0;
+    if (it != index_map_.end()) {
+        index = it->second;
+    } else if (!free_slots_.empty()) {
+        index = free_slots_.back();
+        free_slots_.pop_back();
+        index_map_[instance_id] = index;
+    } else if (next_slot_ < kMaxSlots) {
+        index = next_slot_++;
+        index_map_[instance_id] = index;
+    } else {
+        KR_LOG_ERROR << "KRInstanceHandleTable full, instanceId:" << instance_id;
+        return kKRInvalidInstanceHandle;
+    }
+    return MakeHandle(index, slots_[index].generation.load(std::memory_order_relaxed));
+}
+
+void KRInstanceHandleTable::ReleaseIfUnusedLocked(const std::string &instance_id, uint32_t index) {
+    auto &slot = slots_[index];
+    if (owned_handlers_[index] != nullptr || slot.render_view_alive.load(std::memory_order_relaxed)) {
+        return;
+    }
+    // 先让旧句柄失效，槽位才能复用；generation 跳过 0，保证句柄不会为 0
+    auto generation = slot.generation.load(std::memory_order_relaxed) + 1;
+    slot.generation.store(generation == 0 ? 1 : generation, std::memory_order_release);
+    index_map_.erase(instance_id);
+    free_slots_.push_back(index);
+}
@@ -0,0 +1,99 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 THL A29 Limited, a Tencent company. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRINSTANCEHANDLETABLE_H
+#define CORE_RENDER_OHOS_KRINSTANCEHANDLETABLE_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class IKRRenderNativeContextHandler;
+
+/**
+ * 实例句柄：高 32 位为 generation，低 32 位为槽位下标，0 为无效句柄
+ */
+using KRInstanceHandle = uint64_t;
+constexpr KRInstanceHandle kKRInvalidInstanceHandle = 0;
+
+/**
+ * 实例槽位表，实例创建时分配稠密的整数句柄，字符串 instanceId 只在对外接口处转换一次
+ * 读取无锁并校验 generation，槽位回收后旧句柄自动失效；注册、注销等写操作加锁
+ */
+class KRInstanceHandleTable {
+ public:
+    static KRInstanceHandleTable &GetInstance();
+
+    KRInstanceHandleTable(const KRInstanceHandleTable &) = delete;
+    KRInstanceHandleTable &operator=(const KRInstanceHandleTable &) = delete;
+
+    /**
+     * 同一 instanceId 重复注册时替换旧 handler，旧 handler 与注销时一样延迟到 Context 线程释放
+     */
+    void RegisterContextHandler(const std::string &instance_id,
+                                const std::shared_ptr<IKRRenderNativeContextHandler> &context_handler);
+    /**
+     * 注销后 handler 会延迟到 Context 线程释放，保证 Context 线程上正在进行的调用仍可安全使用裸指针
+     */
+    void UnregisterContextHandler(const std::string &instance_id);
+    void SetRenderViewAlive(const std::string &instance_id, bool alive);
+
+    /**
+     * 桥接入口处将 C 字符串转换为句柄，命中线程内缓存时无内存分配和哈希查找
+     */
+    KRInstanceHandle Resolve(const char *instance_id);
+
+    /**
+     * 仅限 Context 线程调用，返回的指针在本次调用返回前有效；句柄失效时返回 nullptr
+     */
+    IKRRenderNativeContextHandler *GetContextHandler(KRInstanceHandle handle) const;
+    /**
+     * 任意线程可调用，返回持有所有权的 handler
+     */
+    std::shared_ptr<IKRRenderNativeContextHandler> CopyContextHandler(KRInstanceHandle handle);
+    bool IsRenderViewAlive(KRInstanceHandle handle) const;
+
+ private:
+    KRInstanceHandleTable() = default;
+
+    static constexpr uint32_t kMaxSlots = 1024;
+
+    struct Slot {
+        std::atomic<uint32_t> generation{1};
+        std::atomic<IKRRenderNativeContextHandler *> context_handler{nullptr};
+        std::atomic<bool> render_view_alive{false};
+    };
+
+    static KRInstanceHandle MakeHandle(uint32_t index, uint32_t generation) {
+        return (static_cast<uint64_t>(generation) << 32) | index;
+    }
+    const Slot *SlotForHandle(KRInstanceHandle handle) const;
+    KRInstanceHandle FindOrAllocLocked(const std::string &instance_id);
+    void ReleaseIfUnusedLocked(const std::string &instance_id, uint32_t index);
+    static void ReleaseOnContextThread(std::shared_ptr<IKRRenderNativeContextHandler> context_handler);
+
+    Slot slots_[kMaxSlots];
+    std::mutex mutex_;
+    std::unordered_map<std::string, uint32_t> index_map_;
+    std::shared_ptr<IKRRenderNativeContextHandler> owned_handlers_[kMaxSlots];
+    std::vector<uint32_t> free_slots_;
+    uint32_t next_slot_ = 0;
+};
+
+#endif  // CORE_RENDER_OHOS_KRINSTANCEHANDLETABLE_H
@@ -16,6 +16,7 @@
 #include "libohos_render/context/KRRenderNativeContextHandlerManager.h"
 
 #include "libohos_render/context/DefaultRenderNativeContextHandler.h"
+#include "libohos_render/context/KRInstanceHandleTable.h"
 #include "libohos_render/manager/KRRenderManager.h"
 #include "libohos_render/scheduler/KRContextScheduler.h"
 
@@ -51,11 +52,11 @@ std::shared_ptr<IKRRenderNativeContextHandler> KRRenderNativeContextHandlerManag
 
 void KRRenderNativeContextHandlerManager::RegisterContextHandler(
     const std::string &instanceId, const std::shared_ptr<IKRRenderNativeContextHandler> &contextHandler) {
-    context_handler_map_[instanceId] = contextHandler;
+    KRInstanceHandleTable::GetInstance().RegisterContextHandler(instanceId, contextHandler);
 }
 
 void KRRenderNativeContextHandlerManager::UnregisterContextHandler(const std::string &instanceId) {
-    context_handler_map_.erase(instanceId);
+    KRInstanceHandleTable::GetInstance().UnregisterContextHandler(instanceId);
 }
 
 void KRRenderNativeContextHandlerManager::ScheduleDeallocRenderValues(
@@ -71,20 +72,29 @@ void KRRenderNativeContextHandlerManager::ScheduleDeallocRenderValues(
 }
 
 KRRenderCValue KRRenderNativeContextHandlerManager::DispatchCallNative(
-    const std::string &instanceId, int methodId, const KRRenderCValue &arg0, const KRRenderCValue &arg1,
+    const char *instanceId, int methodId, const KRRenderCValue &arg0, const KRRenderCValue &arg1,
     const KRRenderCValue &arg2, const KRRenderCValue &arg3, const KRRenderCValue &arg4, const KRRenderCValue &arg5) {
-    auto handler = context_handler_map_[instanceId];
-    if (!handler || nullptr == KRRenderManager::GetInstance().GetRenderView(instanceId)) {
+    auto &handle_table = KRInstanceHandleTable::GetInstance();
+    auto handle = handle_table.Resolve(instanceId);
+    IKRRenderNativeContextHandler *handler = nullptr;
+    std::shared_ptr<IKRRenderNativeContextHandler> handler_holder;
+    if (KRContextScheduler::IsCurrentOnContextThread()) {
+        handler = handle_table.GetContextHandler(handle);
+    } else {
+        handler_holder = handle_table.CopyContextHandler(handle);
+        handler = handler_holder.get();
+    }
+    if (!handler || !handle_table.IsRenderViewAlive(handle)) {
         auto cv = KRRenderCValue();
         cv.type = KRRenderCValue::NULL_VALUE;
         return cv;
     }
-    auto cv0 = std::make_shared<KRRenderValue>(arg0);
-    auto cv1 = std::make_shared<KRRenderValue>(arg1);
-    auto cv2 = std::make_shared<KRRenderValue>(arg2);
-    auto cv3 = std::make_shared<KRRenderValue>(arg3);
-    auto cv4 = std::make_shared<KRRenderValue>(arg4);
-    auto cv5 = std::make_shared<KRRenderValue>(arg5);
+    auto cv0 = KRRenderValue::Create(arg0);
+    auto cv1 = KRRenderValue::Create(arg1);
+    auto cv2 = KRRenderValue::Create(arg2);
+    auto cv3 = KRRenderValue::Create(arg3);
+    auto cv4 = KRRenderValue::Create(arg4);
+    auto cv5 = KRRenderValue::Create(arg5);
 
     auto return_value =
         handler->OnCallNative(static_cast<KuiklyRenderNativeMethod>(methodId), cv0, cv1, cv2, cv3, cv4, cv5);
@@ -35,7 +35,7 @@ class KRRenderNativeContextHandlerManager {
     void RegisterContextHandler(const std::string &instanceId,
                                 const std::shared_ptr<IKRRenderNativeContextHandler> &contextHandler);
     void UnregisterContextHandler(const std::string &instanceId);
-    KRRenderCValue DispatchCallNative(const std::string &instanceId, int methodId, const KRRenderCValue &arg0,
+    KRRenderCValue DispatchCallNative(const char *instanceId, int methodId, const KRRenderCValue &arg0,
                                       const KRRenderCValue &arg1, const KRRenderCValue &arg2,
                                       const KRRenderCValue &arg3, const KRRenderCValue &arg4,
                                       const KRRenderCValue &arg5);
@@ -57,7 +57,6 @@ class KRRenderNativeContextHandlerManager {
     void ScheduleDeallocRenderValues(const std::shared_ptr<KRRenderValue> will_dealloc_render_value);
 
  private:
-    std::unordered_map<std::string, std::shared_ptr<IKRRenderNativeContextHandler>> context_handler_map_;
     KRRenderContextHandlerCreator creator_;
     bool scheduling_dealloc_render_values_ = false;
     std::vector<std::shared_ptr<KRRenderValue>> pending_dealloc_render_values_;
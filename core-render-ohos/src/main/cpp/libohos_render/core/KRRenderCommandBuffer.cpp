@@ -0,0 +1,184 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 THL A29 Limited, a Tencent company. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/core/KRRenderCommandBuffer.h"
+
+#include <cstring>
+#include "libohos_render/utils/KRRenderLoger.h"
+
+int KRRenderCommandBuffer::Decode(IKRRenderCommandReceiver &receiver) {
+    int decoded_count = 0;
+    std::string view_name;
+    std::string prop_key;
+    while (offset_ < size_) {
+        uint8_t type = 0;
+        if (!ReadUInt8(type)) {
+            break;
+        }
+        bool ok = false;
+        switch (static_cast<KRRenderCommandType>(type)) {
+        case KRRenderCommandType::kCreateRenderView: {
+            int32_t tag = 0;
+            ok = ReadInt32(tag) && ReadString(view_name);
+            if (ok) {
+                receiver.OnCreateRenderView(tag, view_name);
+            }
+            break;
+        }
+        case KRRenderCommandType::kInsertSubRenderView: {
+            int32_t parent_tag = 0;
+            int32_t child_tag = 0;
+            int32_t index = 0;
+            ok = ReadInt32(parent_tag) && ReadInt32(child_tag) && ReadInt32(index);
+            if (ok) {
+                receiver.OnInsertSubRenderView(parent_tag, child_tag, index);
+            }
+            break;
+        }
+        case KRRenderCommandType::kSetViewProp: {
+            int32_t tag = 0;
+            KRAnyValue prop_value;
+            ok = ReadInt32(tag) && ReadString(prop_key) && ReadValue(prop_value);
+            if (ok) {
+                receiver.OnSetViewProp(tag, prop_key, prop_value);
+            }
+            break;
+        }
+        case KRRenderCommandType::kSetRenderViewFrame: {
+            int32_t tag = 0;
+            float x = 0;
+            float y = 0;
+            float width = 0;
+            float height = 0;
+            ok = ReadInt32(tag) && ReadFloat(x) && ReadFloat(y) && ReadFloat(width) && ReadFloat(height);
+            if (ok) {
+                receiver.OnSetRenderViewFrame(tag, KRRect(x, y, width, height));
+            }
+            break;
+        }
+        default:
+            break;
+        }
+        if (!ok) {
+            KR_LOG_ERROR << "KRRenderCommandBuffer broken, type:" << static_cast<int>(type) << " offset:" << offset_
+                         << " size:" << size_;
+            break;
+        }
+        decoded_count++;
+    }
+    return decoded_count;
+}
+
+bool KRRenderCommandBuffer::ReadBytes(void *dst, size_t length) {
+    if (length > size_ - offset_) {
+        return false;
+    }
+    memcpy(dst, data_ + offset_, length);
+    offset_ += length;
+    return true;
+}
+
+bool KRRenderCommandBuffer::ReadUInt8(uint8_t &value) {
+    return ReadBytes(&value, sizeof(value));
+}
+
+bool KRRenderCommandBuffer::ReadInt32(int32_t &value) {
+    return ReadBytes(&value, sizeof(value));
+}
+
+bool KRRenderCommandBuffer::ReadInt64(int64_t &value) {
+    return ReadBytes(&value, sizeof(value));
+}
+
+bool KRRenderCommandBuffer::ReadFloat(float &value) {
+    return ReadBytes(&value, sizeof(value));
+}
+
+bool KRRenderCommandBuffer::ReadDouble(double &value) {
+    return ReadBytes(&value, sizeof(value));
+}
+
+bool KRRenderCommandBuffer::ReadString(std::string &value) {
+    uint32_t length = 0;
+    if (!ReadBytes(&length, sizeof(length)) || length > size_ - offset_) {
+        return false;
+    }
+    value.assign(reinterpret_cast<const char *>(data_ + offset_), length);
+    offset_ += length;
+    return true;
+}
+
+bool KRRenderCommandBuffer::ReadValue(KRAnyValue &value) {
+    uint8_t type = 0;
+    if (!ReadUInt8(type)) {
+        return false;
+    }
+    switch (static_cast<KRRenderCValue::Type>(type)) {
+    case KRRenderCValue::Type::NULL_VALUE: {
+        value = KRRenderValue::Create();
+        return true;
+    }
+    case KRRenderCValue::Type::INT: {
+        int32_t v = 0;
+        if (!ReadInt32(v)) {
+            return false;
+        }
+        value = KRRenderValue::Create(v);
+        return true;
+    }
+    case KRRenderCValue::Type::LONG: {
+        int64_t v = 0;
+        if (!ReadInt64(v)) {
+            return false;
+        }
+        value = KRRenderValue::Create(v);
+        return true;
+    }
+    case KRRenderCValue::Type::FLOAT: {
+        float v = 0;
+        if (!ReadFloat(v)) {
+            return false;
+        }
+        value = KRRenderValue::Create(v);
+        return true;
+    }
+    case KRRenderCValue::Type::DOUBLE: {
+        double v = 0;
+        if (!ReadDouble(v)) {
+            return false;
+        }
+        value = KRRenderValue::Create(v);
+        return true;
+    }
+    case KRRenderCValue::Type::BOOL: {
+        uint8_t v = 0;
+        if (!ReadUInt8(v)) {
+            return false;
+        }
+        value = KRRenderValue::Create(v != 0);
+        return true;
+    }
+    case KRRenderCValue::Type::STRING: {
+        std::string v;
+        if (!ReadString(v)) {
+            return false;
+        }
+        value = KRRenderValue::Create(std::move(v));
+        return true;
+    }
+    default:
+        return false;
+    }
+}
@@ -0,0 +1,82 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 THL A29 Limited, a Tencent company. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRRENDERCOMMANDBUFFER_H
+#define CORE_RENDER_OHOS_KRRENDERCOMMANDBUFFER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include "libohos_render/foundation/KRCommon.h"
+#include "libohos_render/foundation/KRRect.h"
+
+/**
+ * 批量渲染指令类型，取值与 KuiklyRenderNativeMethod 保持一致
+ */
+enum class KRRenderCommandType : uint8_t {
+    kCreateRenderView = 1,     // tag:i32, viewName:str
+    kInsertSubRenderView = 3,  // parentTag:i32, childTag:i32, index:i32
+    kSetViewProp = 4,          // tag:i32, propKey:str, propValue:value
+    kSetRenderViewFrame = 5    // tag:i32, x:f32, y:f32, width:f32, height:f32
+};
+
+/**
+ * 批量渲染指令的接收方，每解码出一条指令回调一次
+ */
+class IKRRenderCommandReceiver {
+ public:
+    virtual ~IKRRenderCommandReceiver() = default;
+    virtual void OnCreateRenderView(int tag, const std::string &view_name) = 0;
+    virtual void OnInsertSubRenderView(int parent_tag, int child_tag, int index) = 0;
+    virtual void OnSetViewProp(int tag, const std::string &prop_key, const KRAnyValue &prop_value) = 0;
+    virtual void OnSetRenderViewFrame(int tag, const KRRect &frame) = 0;
+};
+
+/**
+ * Kotlin 侧批量写入的二进制渲染指令流解码器。
+ * 指令流由若干条记录顺序拼接，每条记录为 [type:u8][payload]，全部为小端序：
+ *   str   = [length:u32][utf8 bytes]（不含结尾'\0'）
+ *   value = [KRRenderCValue::Type:u8][payload]，payload 按类型分别为
+ *           INT:i32 LONG:i64 FLOAT:f32 DOUBLE:f64 BOOL:u8 STRING:str NULL_VALUE:无
+ * 整批指令只跨桥一次；解码在 context 线程进行，逐条交给接收方按普通视图操作入队，与非批量通道一样参与批次内合并。
+ */
+class KRRenderCommandBuffer {
+ public:
+    KRRenderCommandBuffer(const uint8_t *data, size_t size) : data_(data), size_(size) {}
+
+    /**
+     * 按顺序解码全部指令并交给接收方
+     * @param receiver 指令接收方
+     * @return 成功解码的指令条数，遇到非法数据时提前结束
+     */
+    int Decode(IKRRenderCommandReceiver &receiver);
+
+ private:
+    bool ReadUInt8(uint8_t &value);
+    bool ReadInt32(int32_t &value);
+    bool ReadInt64(int64_t &value);
+    bool ReadFloat(float &value);
+    bool ReadDouble(double &value);
+    bool ReadString(std::string &value);
+    bool ReadValue(KRAnyValue &value);
+    bool ReadBytes(void *dst, size_t length);
+
+    const uint8_t *data_ = nullptr;
+    size_t size_ = 0;
+    size_t offset_ = 0;
+};
+
+#endif  // CORE_RENDER_OHOS_KRRENDERCOMMANDBUFFER_H
@@ -17,6 +17,8 @@
 
 #include <functional>
 #include <memory>
+#include "libohos_render/core/KRRenderCommandBuffer.h"
+#include "libohos_render/foundation/KRPropKey.h"
 #include "libohos_render/foundation/KRRect.h"
 #include "libohos_render/layer/KRRenderLayerHandler.h"
 #include "libohos_render/manager/KRArkTSManager.h"
@@ -29,8 +31,9 @@ EXTERN_C_START
 const KRRenderCValue com_tencent_kuikly_CallNative(int methodId, KRRenderCValue arg0, KRRenderCValue arg1,
                                                    KRRenderCValue arg2, KRRenderCValue arg3, KRRenderCValue arg4,
                                                    KRRenderCValue arg5) {
-    return IKRRenderNativeContextHandler::DispatchCallNative(std::string(arg0.value.stringValue), methodId, arg0, arg1,
-                                                             arg2, arg3, arg4, arg5);
+    // instanceId 只在这里以 C 字符串形式进入，随后转换为整数句柄
+    return IKRRenderNativeContextHandler::DispatchCallNative(arg0.value.stringValue, methodId, arg0, arg1, arg2, arg3,
+                                                             arg4, arg5);
 }
 
 CallKotlin callKotlin_;
@@ -59,15 +62,15 @@ static constexpr int kSyncCallbackMask = 1;
 static constexpr int kCallbackKeepAliveMask = 2;
 
 /** 任务在context线程中执行 */
-static void PerformTaskOnContextQueue(bool isSync, int delayMs, const KRSchedulerTask &task) {
-    KRContextScheduler::ScheduleTask(isSync, delayMs, task);
+static bool PerformTaskOnContextQueue(bool isSync, int delayMs, const KRSchedulerTask &task) {
+    return KRContextScheduler::ScheduleTask(isSync, delayMs, task);
 }
 
 KRRenderCore::KRRenderCore(std::weak_ptr<IKRRenderView> renderView, std::shared_ptr<KRRenderContextParams> context)
     : ICallNativeCallback() {
     renderView_ = renderView;
     context_ = context;
-    defaultNullValue_ = std::make_shared<KRRenderValue>();
+    defaultNullValue_ = KRRenderValue::Create();
     uiScheduler_ = std::make_shared<KRUIScheduler>(this);
     contextHandler_ = IKRRenderNativeContextHandler::CreateContextHandler(context);
     // 注册kotlin call native回调（走onCallNative接口）
@@ -145,6 +148,10 @@ void KRRenderCore::WillDealloc(const std::string &instanceId) {
     auto self = shared_from_this();
     std::string id = instanceId;
     PerformTaskOnContextQueue(false, 0, [self, id] {
+        for (auto &it : self->timeout_tasks_) {
+            KRContextScheduler::CancelDelayedTask(it.second);
+        }
+        self->timeout_tasks_.clear();
         auto nullValue = self->defaultNullValue_;
         self->CallKotlinMethod(KuiklyRenderContextMethod::KuiklyRenderContextMethodDestroyInstance, nullValue, nullValue,
                                nullValue, nullValue, nullValue);
@@ -183,22 +190,124 @@ KRRenderCore::OnCallNative(const KuiklyRenderNativeMethod &method, std::shared_p
                            std::shared_ptr<KRRenderValue> &arg1, std::shared_ptr<KRRenderValue> &arg2,
                            std::shared_ptr<KRRenderValue> &arg3, std::shared_ptr<KRRenderValue> &arg4,
                            std::shared_ptr<KRRenderValue> &arg5) {
+    // 属性名只在此处解析一次ID，主线程分发时通过 KRPropKeyIdScope 复用
+    auto prop_key_id = method == KuiklyRenderNativeMethod::KuiklyRenderNativeMethodSetViewProp
+                           ? KRGetPropKeyId(arg2->toString())
+                           : KRPropKeyId::kUnknown;
     if (ShouldSyncCallMethod(method, arg5)) {  // 是否同步调用Native方法，如Module syncCall方法
-        return PerformNativeCallback(method, arg1, arg2, arg3, arg4, arg5, true);
+        return PerformNativeCallback(method, prop_key_id, arg1, arg2, arg3, arg4, arg5, true);
     } else {
         if (!uiScheduler_) {
             return defaultNullValue_;
         }
+        if (method == KuiklyRenderNativeMethod::KuiklyRenderNativeMethodSetRenderViewFrame) {
+            AddFrameTaskToMainQueue(arg1->toInt(),
+                                    KRRect(arg2->toFloat(), arg3->toFloat(), arg4->toFloat(), arg5->toFloat()));
+            return defaultNullValue_;
+        }
+        if (method == KuiklyRenderNativeMethod::KuiklyRenderNativeMethodFlushRenderCommands) {
+            // 在 context 线程解码 kotlin 侧批量写入的渲染指令，逐条回调 On* 入队
+            auto bytes = arg1->toByteArray();
+            if (bytes && !bytes->empty()) {
+                KRRenderCommandBuffer command_buffer(bytes->data(), bytes->size());
+                command_buffer.Decode(*this);
+            }
+            return defaultNullValue_;
+        }
         std::weak_ptr<KRRenderCore> weakSelf = shared_from_this();
-        uiScheduler_->AddTaskToMainQueueWithTask([weakSelf, method, arg1, arg2, arg3, arg4, arg5] {
+        KRSchedulerTask task = [weakSelf, method, prop_key_id, arg1, arg2, arg3, arg4, arg5] {
             if (auto locked = weakSelf.lock()) {
-                locked->PerformNativeCallback(method, arg1, arg2, arg3, arg4, arg5, false);
+                locked->PerformNativeCallback(method, prop_key_id, arg1, arg2, arg3, arg4, arg5, false);
             }
-        });
+        };
+        AddNativeCallbackToMainQueue(method, prop_key_id, arg1, arg2, std::move(task));
     }
     return defaultNullValue_;
 }
 
+// animation 之后的属性需要以动画方式生效，不能与之前的写入合并
+static KRUIViewOpType PropOpType(KRPropKeyId prop_key_id) {
+    return prop_key_id == KRPropKeyId::kAnimation ? KRUIViewOpType::kBarrier : KRUIViewOpType::kSetProp;
+}
+
+void KRRenderCore::AddNativeCallbackToMainQueue(const KuiklyRenderNativeMethod &method, KRPropKeyId prop_key_id,
+                                                const KRAnyValue &arg1, const KRAnyValue &arg2,
+                                                KRSchedulerTask &&task) {
+    static const std::string kEmptyPropKey;
+    switch (method) {
+    case KuiklyRenderNativeMethod::KuiklyRenderNativeMethodCreateRenderView:
+        uiScheduler_->AddViewOpToMainQueue(KRUIViewOpType::kCreate, arg1->toInt(), -1, kEmptyPropKey, std::move(task));
+        break;
+    case KuiklyRenderNativeMethod::KuiklyRenderNativeMethodRemoveRenderView:
+        uiScheduler_->AddViewOpToMainQueue(KRUIViewOpType::kRemove, arg1->toInt(), -1, kEmptyPropKey, std::move(task));
+        break;
+    case KuiklyRenderNativeMethod::KuiklyRenderNativeMethodInsertSubRenderView:
+        uiScheduler_->AddViewOpToMainQueue(KRUIViewOpType::kInsert, arg2->toInt(), arg1->toInt(), kEmptyPropKey,
+                                           std::move(task));
+        break;
+    case KuiklyRenderNativeMethod::KuiklyRenderNativeMethodSetViewProp:
+        uiScheduler_->AddViewOpToMainQueue(PropOpType(prop_key_id), arg1->toInt(), -1, arg2->toString(),
+                                           std::move(task));
+        break;
+    case KuiklyRenderNativeMethod::KuiklyRenderNativeMethodCallViewMethod:
+        uiScheduler_->AddViewOpToMainQueue(KRUIViewOpType::kOther, arg1->toInt(), -1, kEmptyPropKey, std::move(task));
+        break;
+    default:
+        uiScheduler_->AddTaskToMainQueueWithTask(std::move(task));
+        break;
+    }
+}
+
+void KRRenderCore::AddFrameTaskToMainQueue(int tag, const KRRect &frame) {
+    std::weak_ptr<KRRenderCore> weakSelf = shared_from_this();
+    // 同一批次内同一tag的frame由KRUIScheduler只保留最后一次，跨批次按顺序各自生效
+    uiScheduler_->AddViewOpToMainQueue(KRUIViewOpType::kFrame, tag, -1, "", [weakSelf, tag, frame] {
+        auto locked = weakSelf.lock();
+        if (locked && locked->renderLayerHandler_) {
+            locked->renderLayerHandler_->SetFrame(tag, frame);
+        }
+    });
+}
+
+void KRRenderCore::OnCreateRenderView(int tag, const std::string &view_name) {
+    std::weak_ptr<KRRenderCore> weakSelf = shared_from_this();
+    uiScheduler_->AddViewOpToMainQueue(KRUIViewOpType::kCreate, tag, -1, "", [weakSelf, tag, view_name] {
+        auto locked = weakSelf.lock();
+        if (locked && locked->renderLayerHandler_) {
+            locked->renderLayerHandler_->CreateRenderView(tag, view_name);
+        }
+    });
+}
+
+void KRRenderCore::OnInsertSubRenderView(int parent_tag, int child_tag, int index) {
+    std::weak_ptr<KRRenderCore> weakSelf = shared_from_this();
+    uiScheduler_->AddViewOpToMainQueue(KRUIViewOpType::kInsert, child_tag, parent_tag, "",
+                                       [weakSelf, parent_tag, child_tag, index] {
+                                           auto locked = weakSelf.lock();
+                                           if (locked && locked->renderLayerHandler_) {
+                                               locked->renderLayerHandler_->InsertSubRenderView(parent_tag, child_tag,
+                                                                                                index);
+                                           }
+                                       });
+}
+
+void KRRenderCore::OnSetViewProp(int tag, const std::string &prop_key, const KRAnyValue &prop_value) {
+    std::weak_ptr<KRRenderCore> weakSelf = shared_from_this();
+    auto prop_key_id = KRGetPropKeyId(prop_key);
+    uiScheduler_->AddViewOpToMainQueue(PropOpType(prop_key_id), tag, -1, prop_key,
+                                       [weakSelf, tag, prop_key, prop_key_id, prop_value] {
+                                           auto locked = weakSelf.lock();
+                                           if (locked && locked->renderLayerHandler_) {
+                                               KRPropKeyIdScope prop_key_scope(prop_key, prop_key_id);
+                                               locked->renderLayerHandler_->SetProp(tag, prop_key, prop_value);
+                                           }
+                                       });
+}
+
+void KRRenderCore::OnSetRenderViewFrame(int tag, const KRRect &frame) {
+    AddFrameTaskToMainQueue(tag, frame);
+}
+
 // 判断事件是否需要同步调用
 bool KRRenderCore::ShouldSyncCallMethod(const KuiklyRenderNativeMethod &method, std::shared_ptr<KRRenderValue> &arg5) {
     if (method == KuiklyRenderNativeMethod::KuiklyRenderNativeMethodCallModuleMethod) {
@@ -210,14 +319,15 @@ bool KRRenderCore::ShouldSyncCallMethod(const KuiklyRenderNativeMethod &method,
            method == KuiklyRenderNativeMethod::KuiklyRenderNativeMethodSetShadowProp ||
            method == KuiklyRenderNativeMethod::KuiklyRenderNativeMethodSetShadowForView ||
            method == KuiklyRenderNativeMethod::KuiklyRenderNativeMethodSetTimeout ||
+           method == KuiklyRenderNativeMethod::KuiklyRenderNativeMethodClearTimeout ||
            method == KuiklyRenderNativeMethod::KuiklyRenderNativeMethodCallShadowMethod ||
            method == KuiklyRenderNativeMethod::KuiklyRenderNativeMethodSyncFlushUI ||
            method == KuiklyRenderNativeMethod::KuiklyRenderNativeMethodCallTDFNativeMethod;
 }
 
-KRAnyValue KRRenderCore::PerformNativeCallback(const KuiklyRenderNativeMethod &method, const KRAnyValue &arg1,
-                                               const KRAnyValue &arg2, const KRAnyValue &arg3, const KRAnyValue &arg4,
-                                               const KRAnyValue &arg5, bool sync) {
+KRAnyValue KRRenderCore::PerformNativeCallback(const KuiklyRenderNativeMethod &method, KRPropKeyId prop_key_id,
+                                               const KRAnyValue &arg1, const KRAnyValue &arg2, const KRAnyValue &arg3,
+                                               const KRAnyValue &arg4, const KRAnyValue &arg5, bool sync) {
     switch (method) {
     case KuiklyRenderNativeMethod::KuiklyRenderNativeMethodCreateRenderView: {
         renderLayerHandler_->CreateRenderView(arg1->toInt(), arg2->toString());
@@ -232,13 +342,14 @@ KRAnyValue KRRenderCore::PerformNativeCallback(const KuiklyRenderNativeMethod &m
         break;
     }
     case KuiklyRenderNativeMethod::KuiklyRenderNativeMethodSetViewProp: {
+        KRPropKeyIdScope prop_key_scope(arg2->toString(), prop_key_id);
         bool isEvent = arg4->toInt() == 1;
         if (isEvent) {
             bool sync = IsSyncCallback(arg5);
             std::weak_ptr<KRRenderCore> weakSelf = shared_from_this();
             KRRenderCallback callback = [weakSelf, arg1, arg2, arg3, arg4, arg5, sync](KRAnyValue res) {
                 auto shouldSync = sync;
-                PerformTaskOnContextQueue(shouldSync, 0, [weakSelf, shouldSync, res, arg1, arg2, arg3, arg4, arg5] {
+                auto task = [weakSelf, shouldSync, res, arg1, arg2, arg3, arg4, arg5] {
                     if (auto locked = weakSelf.lock()) {
                         locked->CallKotlinMethod(KuiklyRenderContextMethod::KuiklyRenderContextMethodFireViewEvent, arg1, arg2,
                                                  res, locked->defaultNullValue_, locked->defaultNullValue_);
@@ -246,8 +357,10 @@ KRAnyValue KRRenderCore::PerformNativeCallback(const KuiklyRenderNativeMethod &m
                             locked->uiScheduler_->PerformSyncMainQueueTasksBlockIfNeed(true);
                         }
                     }
-                });
-                if (shouldSync) {
+                };
+                auto ranSync = PerformTaskOnContextQueue(shouldSync, 0, task);
+                // 重入降级为异步时事件尚未处理，不等待同步 UI 任务
+                if (shouldSync && ranSync) {
                     if (auto locked = weakSelf.lock()) {
                         locked->uiScheduler_->PerformMainThreadTaskWaitToSyncBlockIfNeed();
                     }
@@ -261,10 +374,8 @@ KRAnyValue KRRenderCore::PerformNativeCallback(const KuiklyRenderNativeMethod &m
     }
 
     case KuiklyRenderNativeMethod::KuiklyRenderNativeMethodSetRenderViewFrame: {
-        auto rect = KRRect(arg2->toFloat(), arg3->toFloat(), arg4->toFloat(), arg5->toFloat());
-        std::string rectData((const char *)&rect, sizeof(KRRect));
-        auto value = std::make_shared<KRRenderValue>(rectData);
-        renderLayerHandler_->SetProp(arg1->toInt(), "frame", value);
+        renderLayerHandler_->SetFrame(arg1->toInt(),
+                                      KRRect(arg2->toFloat(), arg3->toFloat(), arg4->toFloat(), arg5->toFloat()));
         break;
     }
     case KuiklyRenderNativeMethod::KuiklyRenderNativeMethodCalculateRenderViewSize: {
@@ -347,13 +458,30 @@ KRAnyValue KRRenderCore::PerformNativeCallback(const KuiklyRenderNativeMethod &m
     }
     case KuiklyRenderNativeMethod::KuiklyRenderNativeMethodSetTimeout: {
         std::weak_ptr<KRRenderCore> weakSelf = shared_from_this();
-        PerformTaskOnContextQueue(false, arg1->toInt() > 0 ? arg1->toInt() : 1, [weakSelf, arg2] {
-            if (auto lock = weakSelf.lock()) {
-                auto nullValue = lock->defaultNullValue_;
-                lock->CallKotlinMethod(KuiklyRenderContextMethod::KuiklyRenderContextMethodFireCallback, arg2, nullValue,
-                                       nullValue, nullValue, nullValue);
-            }
-        });
+        auto callbackId = arg2->toString();
+        auto taskId = KRContextScheduler::ScheduleDelayedTask(
+            arg1->toInt() > 0 ? arg1->toInt() : 1, [weakSelf, arg2, callbackId] {
+                if (auto lock = weakSelf.lock()) {
+                    // 已被 clearTimeout 取消的定时器不再回调
+                    if (lock->timeout_tasks_.erase(callbackId) == 0) {
+                        return;
+                    }
+                    auto nullValue = lock->defaultNullValue_;
+                    lock->CallKotlinMethod(KuiklyRenderContextMethod::KuiklyRenderContextMethodFireCallback, arg2,
+                                           nullValue, nullValue, nullValue, nullValue);
+                }
+            });
+        timeout_tasks_[callbackId] = taskId;
+        break;
+    }
+
+    case KuiklyRenderNativeMethod::KuiklyRenderNativeMethodClearTimeout: {
+        // Kotlin 侧 clearTimeout(instanceId, callbackId)，callbackId 在 arg1
+        auto it = timeout_tasks_.find(arg1->toString());
+        if (it != timeout_tasks_.end()) {
+            KRContextScheduler::CancelDelayedTask(it->second);
+            timeout_tasks_.erase(it);
+        }
         break;
     }
 
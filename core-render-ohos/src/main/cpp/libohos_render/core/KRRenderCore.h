@@ -19,8 +19,11 @@
 /**
  * 负责渲染流程核心逻辑模块。
  */
+#include <unordered_map>
 #include "libohos_render/context/IKRRenderNativeContextHandler.h"
 #include "libohos_render/context/KRRenderContextParams.h"
+#include "libohos_render/core/KRRenderCommandBuffer.h"
+#include "libohos_render/foundation/KRPropKey.h"
 #include "libohos_render/layer/IKRRenderLayer.h"
 #include "libohos_render/scheduler/KRUIScheduler.h"
 #include "libohos_render/view/IKRRenderView.h"
@@ -37,7 +40,8 @@ enum class KRInitState {
 
 class KRRenderCore : public std::enable_shared_from_this<KRRenderCore>,
                      public ICallNativeCallback,
-                     public KRRenderUISchedulerDelegate {
+                     public KRRenderUISchedulerDelegate,
+                     private IKRRenderCommandReceiver {
  public:
     /**
      * 唯一初始化构造方法
@@ -123,6 +127,8 @@ class KRRenderCore : public std::enable_shared_from_this<KRRenderCore>,
     std::shared_ptr<KRRenderValue> defaultNullValue_;
     /** 正在从主线程同步任务到context线程 */
     bool syncingPerformTaskMainThreadToContextThread = false;
+    /** setTimeout 的 callbackId 到延时任务 id 的映射，仅在context线程访问 */
+    std::unordered_map<std::string, uint64_t> timeout_tasks_;
 
     /** callback 是否为同步方法 */
     bool IsSyncCallback(const KRAnyValue &params);
@@ -132,9 +138,20 @@ class KRRenderCore : public std::enable_shared_from_this<KRRenderCore>,
     void CallKotlinMethod(const KuiklyRenderContextMethod &method, const KRAnyValue &arg1, const KRAnyValue &arg2,
                           const KRAnyValue &arg3, const KRAnyValue &arg4, const KRAnyValue &arg5);
     /** 执行kotlin call native方法*/
-    KRAnyValue PerformNativeCallback(const KuiklyRenderNativeMethod &method, const KRAnyValue &arg1, const KRAnyValue &arg2,
-                                     const KRAnyValue &arg3, const KRAnyValue &arg4, const KRAnyValue &arg5, bool sync);
+    KRAnyValue PerformNativeCallback(const KuiklyRenderNativeMethod &method, KRPropKeyId prop_key_id,
+                                     const KRAnyValue &arg1, const KRAnyValue &arg2, const KRAnyValue &arg3,
+                                     const KRAnyValue &arg4, const KRAnyValue &arg5, bool sync);
     bool ShouldSyncCallMethod(const KuiklyRenderNativeMethod &method, std::shared_ptr<KRRenderValue> &arg5);
+    /** 按方法类型将异步native调用加入主线程队列，视图相关操作交给 KRUIScheduler 在批次内合并 */
+    void AddNativeCallbackToMainQueue(const KuiklyRenderNativeMethod &method, KRPropKeyId prop_key_id,
+                                      const KRAnyValue &arg1, const KRAnyValue &arg2, KRSchedulerTask &&task);
+    /** 合并frame设置：同一批次内同一tag多次设置frame时只生效最后一次 */
+    void AddFrameTaskToMainQueue(int tag, const KRRect &frame);
+    /** IKRRenderCommandReceiver：批量渲染指令按普通视图操作入队，参与批次内合并 */
+    void OnCreateRenderView(int tag, const std::string &view_name) override;
+    void OnInsertSubRenderView(int parent_tag, int child_tag, int index) override;
+    void OnSetViewProp(int tag, const std::string &prop_key, const KRAnyValue &prop_value) override;
+    void OnSetRenderViewFrame(int tag, const KRRect &frame) override;
 
     void OnDestroy();
 };
@@ -17,6 +17,7 @@
 
 #include "libohos_render/expand/components/apng/APNGCache.h"
 #include "libohos_render/foundation/thread/KRGCDQueue.h"
+#include "libohos_render/foundation/thread/KRMainThread.h"
 #include "libohos_render/utils/KRRenderLoger.h"
 /**
  * 实例初始化构造器
@@ -59,8 +60,8 @@ void APNGAnimateView::Destroy() {
 
 APNGAnimateView::~APNGAnimateView() {
     Destroy();
-    KRGCDQueue::GetInstance().DispatchAsync([apng = apng_] {
-        apng->width;  // sub thread gc
+    KRGCDQueue::GetInstance().DispatchAsync([apng = apng_, stream = stream_, drawable = current_drawable_] {
+        // sub thread gc
     });
 }
 
@@ -109,6 +110,7 @@ void APNGAnimateView::SetFrame(KRRect parent_frame) {
 void APNGAnimateView::LoadSuccess(std::shared_ptr<APNG> apng) {
     // 开始播放
     apng_ = apng;
+    stream_ = std::make_shared<APNGFrameStream>(apng);
     SyncAutoPlayIfNeed();
     if (animation_start_callback_) {
         animation_start_callback_();
@@ -128,17 +130,17 @@ void APNGAnimateView::PlayNextFrame() {
     }
     bool need_play_next_frame = true;
 
-    std::shared_ptr<APNGDrawable> apngDrawable = apng_->GetDrawable(current_frame_index_ + 1);
+    std::shared_ptr<APNGDrawable> apngDrawable = stream_->GetDrawable(current_frame_index_ + 1);
     if (apngDrawable == nullptr) {
-        if (!(apng_->IsParsing())) {  // 说明最后一个了
+        if (stream_->IsEnd(current_frame_index_ + 1)) {  // 说明最后一个了
             did_play_loop_count_ += 1;
             if (did_play_loop_count_ < repeat_count_) {
-                current_frame_index_ = 0;
-                apngDrawable = apng_->GetDrawable(current_frame_index_);
+                apngDrawable = stream_->GetDrawable(0);
+                current_frame_index_ = apngDrawable ? 0 : -1;  // 流式模式回绕后首帧可能仍在解码
             } else {
                 need_play_next_frame = false;
             }
-        } else {  // 还在解析 延迟等待
+        } else {  // 还在解析或解码 延迟等待
             need_play_next_frame = true;
         }
     } else {
@@ -177,6 +179,7 @@ void APNGAnimateView::PlayNextFrame() {
 void APNGAnimateView::UpdateCurrentFrameToRender(std::shared_ptr<APNGDrawable> apngDrawable) {
     if (apngDrawable && apngDrawable->drawable) {
         kuikly::util::SetArkUIImageSrc(image_node_, apngDrawable->drawable);
+        current_drawable_ = apngDrawable;
     }
 }
 
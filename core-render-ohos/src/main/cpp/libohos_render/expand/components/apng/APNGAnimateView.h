@@ -111,6 +111,8 @@ class APNGAnimateView : public std::enable_shared_from_this<APNGAnimateView> {
     ArkUI_NodeHandle parent_node_ = nullptr;  // 父节点句柄
     ArkUI_NodeHandle image_node_ = nullptr;   // 图片节点句柄
     std::shared_ptr<APNG> apng_ = nullptr;    // APNG 动画对象
+    std::shared_ptr<APNGFrameStream> stream_ = nullptr;        // 帧来源（大动画按需流式解码）
+    std::shared_ptr<APNGDrawable> current_drawable_ = nullptr;  // 正在显示的帧，保证渲染期间不被释放
     bool auto_play_ = true;                   // 是否自动播放
     int32_t current_frame_index_ = -1;        // 当前帧索引
     int32_t play_timeout_flag_ = -1;          // 播放超时标志
@@ -0,0 +1,141 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 THL A29 Limited, a Tencent company. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/expand/components/apng/APNGCache.h"
+
+#include <chrono>
+#include <cstdio>
+#include "libohos_render/expand/components/apng/ApngParser.h"
+#include "libohos_render/foundation/thread/KRGCDQueue.h"
+#include "libohos_render/foundation/thread/KRMainThread.h"
+#include "libohos_render/utils/KRRenderLoger.h"
+
+static bool ReadFileToBuffer(const std::string &filePath, std::vector<uint8_t> &buffer) {
+    FILE *file = fopen(filePath.c_str(), "rb");
+    if (!file) {
+        return false;
+    }
+
+    fseek(file, 0, SEEK_END);
+    std::int32_t fileSize = ftell(file);
+    if (fileSize != -1) {
+        fseek(file, 0, SEEK_SET);
+        buffer.resize(fileSize);
+        fread(buffer.data(), 1, fileSize, file);
+    }
+    fclose(file);
+
+    return true;
+}
+
+APNGCache &APNGCache::GetInstance() {
+    static APNGCache instance;
+    return instance;
+}
+
+void APNGCache::Fetch(const std::string &filePath, APNGCompletion completion) {
+    std::shared_ptr<APNG> cached;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (auto hit = cache_.Get(filePath)) {
+            cached = *hit;
+        } else if (!pending_requests_.Add(filePath, std::move(completion))) {
+            // 已有相同文件在解码，等待其结果
+            return;
+        }
+    }
+    if (cached) {
+        completion(cached);
+        return;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    KRGCDQueue::GetInstance().DispatchAsync([this, filePath, start]() {
+        std::vector<uint8_t> buffer;
+        ReadFileToBuffer(filePath, buffer);
+        auto end0 = std::chrono::steady_clock::now();
+        auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end0 - start);
+
+        parseAPNG(buffer, [this, end0, duration, filePath](std::shared_ptr<APNG> apng) {
+            auto end1 = std::chrono::steady_clock::now();
+            auto duration1 = std::chrono::duration_cast<std::chrono::milliseconds>(end1 - end0);
+            bool isValidApng = apng && apng->isAPNG && apng->frames.size();
+            KR_LOG_INFO << "ReadFileToBuffer cost time:" << (duration).count() << " parse apng c:" << duration1.count();
+            KRMainThread::RunOnMainThread(
+                [this, filePath, apng, isValidApng] { DidFetch(filePath, apng, isValidApng); });
+        });
+    });
+}
+
+void APNGCache::DidFetch(const std::string &filePath, std::shared_ptr<APNG> apng, bool isValidApng) {
+    std::vector<APNGCompletion> completions;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        completions = pending_requests_.Take(filePath);
+    }
+    if (completions.empty()) {
+        return;
+    }
+    if (isValidApng) {
+        Insert(filePath, apng);
+    }
+    for (const auto &completion : completions) {
+        // 加载成功传入 apng，失败传入 nullptr
+        completion(isValidApng ? apng : nullptr);
+    }
+}
+
+void APNGCache::Insert(const std::string &filePath, std::shared_ptr<APNG> apng) {
+    size_t bytes = apng->MemoryCost();
+    std::vector<std::shared_ptr<APNG>> evicted;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        // 超过整个预算的 APNG 不缓存，仅由视图持有
+        cache_.Put(filePath, std::move(apng), bytes, evicted);
+    }
+    KRReleaseOnSubThread(std::move(evicted));
+}
+
+void APNGCache::SetByteBudget(size_t bytes) {
+    std::vector<std::shared_ptr<APNG>> evicted;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        cache_.SetByteBudget(bytes, evicted);
+    }
+    KRReleaseOnSubThread(std::move(evicted));
+}
+
+void APNGCache::TrimToSize(size_t targetBytes) {
+    std::vector<std::shared_ptr<APNG>> evicted;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        cache_.Evict(targetBytes, evicted);
+    }
+    KRReleaseOnSubThread(std::move(evicted));
+}
+
+void APNGCache::OnMemoryLevel(int level) {
+    std::vector<std::shared_ptr<APNG>> evicted;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        cache_.OnMemoryLevel(level, evicted);
+    }
+    KRReleaseOnSubThread(std::move(evicted));
+}
+
+size_t APNGCache::TotalBytes() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return cache_.TotalBytes();
+}
@@ -16,130 +16,66 @@
 #ifndef CORE_RENDER_OHOS_APNGCACHE_H
 #define CORE_RENDER_OHOS_APNGCACHE_H
 
-#include <arkui/native_type.h>
-#include <rawfile/raw_file.h>
-#include <rawfile/raw_file_manager.h>
-#include <array>
-#include <cstdint>
-#include <cstdio>
-#include <cstring>
-#include <filesystem>
-#include <fstream>
-#include <iostream>
+#include <cstddef>
+#include <functional>
+#include <memory>
 #include <mutex>
-#include <stdexcept>
 #include <string>
-#include <unordered_map>
-#include <vector>
-#include "libohos_render/expand/components/apng/ApngParser.h"
-#include "libohos_render/expand/modules/log/KRLogModule.h"
-#include "libohos_render/foundation/KRRect.h"
-#include "libohos_render/foundation/thread/KRGCDQueue.h"
-#include "libohos_render/utils/KRRenderLoger.h"
-#include "libohos_render/utils/KRViewUtil.h"
+#include "libohos_render/expand/components/apng/APNGStructs.h"
+#include "libohos_render/utils/KRByteLruCache.h"
 
-bool ReadFileToBuffer(const std::string &filePath, std::vector<uint8_t> &buffer) {
-    FILE *file = fopen(filePath.c_str(), "rb");
-    if (!file) {
-        return false;
-    }
-
-    fseek(file, 0, SEEK_END);
-    std::int32_t fileSize = ftell(file);
-    if (fileSize != -1) {
-        fseek(file, 0, SEEK_SET);
-        buffer.resize(fileSize);
-        fread(buffer.data(), 1, fileSize, file);
-    }
-    fclose(file);
-
-    return true;
-}
+using APNGCompletion = std::function<void(std::shared_ptr<APNG>)>;
 
 /**
- * 异步获取 APNG（动画便携式网络图形）文件，并在完成时调用完成回调函数。
- *
- * 该函数从给定的文件路径异步获取 APNG 文件。如果已经有针对相同文件路径的获取请求正在进行中，
- * 则不会启动新的获取，而是将完成回调函数添加到完成列表中，以便在获取完成时调用。这避免了对同一文件的不必要获取。
- *
- * 获取到的 APNG 还将在内存中缓存 1 分钟，以提高后续获取相同文件的性能。
- * 在开始新的获取之前，会检查缓存，如果在缓存中找到相同文件路径的有效 APNG，则返回缓存的 APNG，而不执行获取。
- *
- * 获取 APNG 后，将在主线程上调用完成回调函数并传递获取到的 APNG。如果 APNG 有效（即，它不为 null，它是
- * APNG，并且至少有一帧）， 则将 APNG 传递给完成回调函数。如果 APNG 无效，则将 null 传递给完成回调函数。
+ * 进程级 APNG 缓存
  *
- * @param filePath 要获取的 APNG 文件的路径。
- * @param completion 获取完成时要调用的函数。获取到的 APNG 将传递给此函数。
+ * 按解码后的像素内存计量，超出字节预算时按 LRU 淘汰；同一文件的并发请求只解码一次，
+ * 解码完成后在主线程回调所有请求方。被淘汰的 APNG 仍由正在播放的视图持有，视图释放后才真正回收。
  */
+class APNGCache {
+ public:
+    static APNGCache &GetInstance();
 
-void FetchAPNG(const std::string &filePath, std::function<void(std::shared_ptr<APNG>)> completion) {
-    static std::unordered_map<std::string, std::vector<std::function<void(std::shared_ptr<APNG>)>>> pendingRequests;
-    static std::unordered_map<std::string, std::shared_ptr<APNG>> apngCache;
+    /**
+     * 获取 APNG，命中缓存时同步回调，否则在主线程回调；无效 APNG 回调 nullptr
+     */
+    void Fetch(const std::string &filePath, APNGCompletion completion);
 
-    {
-        auto it = apngCache.find(filePath);
-        if (it != apngCache.end()) {
-            // 使用缓存的APNG
-            completion(it->second);
-            return;
-        }
-    }
+    /**
+     * 设置字节预算，超出部分立即淘汰
+     */
+    void SetByteBudget(size_t bytes);
 
-    {
-        auto it = pendingRequests.find(filePath);
-        if (it != pendingRequests.end()) {
-            // 如果已经有一个相同的请求正在进行，将回调函数添加到列表中
-            it->second.push_back(completion);
-            return;
-        } else {
-            // 如果没有相同的请求正在进行，创建一个新的回调函数列表
-            pendingRequests[filePath] = {completion};
-        }
-    }
-    auto start = std::chrono::steady_clock::now();
-    KRGCDQueue::GetInstance().DispatchAsync([filePath, start]() {
-        std::vector<uint8_t> buffer;
-        bool res = ReadFileToBuffer(filePath, buffer);
-        auto end0 = std::chrono::steady_clock::now();
-        auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end0 - start);
+    /**
+     * 淘汰到不超过 targetBytes
+     */
+    void TrimToSize(size_t targetBytes);
 
-        parseAPNG(buffer, [end0, duration, filePath](std::shared_ptr<APNG> apng) {
-            auto end1 = std::chrono::steady_clock::now();
-            auto duration1 = std::chrono::duration_cast<std::chrono::milliseconds>(end1 - end0);
-            bool isValidApng = apng && apng->isAPNG && apng->frames.size();
-            KR_LOG_INFO << "ReadFileToBuffer cost time:" << (duration).count() << " parse apng c:" << duration1.count();
-            KRMainThread::RunOnMainThread([filePath, apng, isValidApng] {
-                auto it = pendingRequests.find(filePath);
-                if (it != pendingRequests.end()) {
-                    std::vector<std::function<void(std::shared_ptr<APNG>)>> completions = std::move(it->second);
-                    pendingRequests.erase(it);
+    /**
+     * 内存压力回调（level 与 AbilityConstant.MemoryLevel 一致：0 中等，1 低，2 严重）
+     */
+    void OnMemoryLevel(int level);
 
-                    if (isValidApng) {
-                        apngCache[filePath] = apng;
-                        // 设置缓存过期时间为1分钟
-                        KRMainThread::RunOnMainThread(
-                            [filePath, apng] {
-                                KRGCDQueue::GetInstance().DispatchAsync([apng] {
-                                    apng->width;  // sub thread release
-                                });
-                                apngCache.erase(filePath);
-                            },
-                            10 * 60000);
-                    }
+    size_t TotalBytes();
 
-                    for (const auto &completion : completions) {
-                        if (isValidApng) {
-                            // 加载成功
-                            completion(apng);
-                        } else {
-                            // 播放失败
-                            completion(nullptr);
-                        }
-                    }
-                }
-            });
-        });
-    });
+ private:
+    APNGCache() = default;
+
+    static constexpr size_t kDefaultByteBudget = 64 * 1024 * 1024;
+
+    std::mutex mutex_;
+    KRByteLruCache<std::string, std::shared_ptr<APNG>> cache_{kDefaultByteBudget};
+    KRRequestCoalescer<std::string, APNGCompletion> pending_requests_;
+
+    void DidFetch(const std::string &filePath, std::shared_ptr<APNG> apng, bool isValidApng);
+    void Insert(const std::string &filePath, std::shared_ptr<APNG> apng);
+};
+
+/**
+ * 异步获取 APNG，详见 APNGCache::Fetch
+ */
+inline void FetchAPNG(const std::string &filePath, APNGCompletion completion) {
+    APNGCache::GetInstance().Fetch(filePath, std::move(completion));
 }
 
 #endif  // CORE_RENDER_OHOS_APNGCACHE_H
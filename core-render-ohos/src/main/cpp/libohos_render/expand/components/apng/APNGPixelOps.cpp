@@ -0,0 +1,177 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 THL A29 Limited, a Tencent company. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/expand/components/apng/APNGPixelOps.h"
+
+#include <cstring>
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define KR_APNG_PIXEL_OPS_NEON 1
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define KR_APNG_PIXEL_OPS_SSE2 1
+#endif
+
+namespace {
+
+// x / 255（向下取整），x <= 255 * 255
+inline uint32_t Div255(uint32_t x) {
+    return (x + 1 + (x >> 8)) >> 8;
+}
+
+}  // namespace
+
+void APNGPixelOps::BlendOverRowScalar(uint8_t *dst, const uint8_t *src, int width) {
+    for (int x = 0; x < width; ++x, src += 4, dst += 4) {
+        uint32_t sa = src[3];
+        if (sa == 0) {
+            continue;
+        }
+        uint32_t da = dst[3];
+        if (sa == 255 || da == 0) {
+            memcpy(dst, src, 4);
+            continue;
+        }
+        uint32_t inv_sa = 255 - sa;
+        if (da == 255) {
+            dst[0] = Div255(src[0] * sa + dst[0] * inv_sa);
+            dst[1] = Div255(src[1] * sa + dst[1] * inv_sa);
+            dst[2] = Div255(src[2] * sa + dst[2] * inv_sa);
+            continue;
+        }
+        // out = (s * sa + d * da * (1 - sa)) / outA，分子分母同乘 255 * 255
+        uint32_t src_weight = sa * 255;
+        uint32_t dst_weight = da * inv_sa;
+        uint32_t out_a = src_weight + dst_weight;
+        dst[0] = (src[0] * src_weight + dst[0] * dst_weight) / out_a;
+        dst[1] = (src[1] * src_weight + dst[1] * dst_weight) / out_a;
+        dst[2] = (src[2] * src_weight + dst[2] * dst_weight) / out_a;
+        dst[3] = out_a / 255;
+    }
+}
+
+#if KR_APNG_PIXEL_OPS_NEON
+
+void APNGPixelOps::BlendOverRow(uint8_t *dst, const uint8_t *src, int width) {
+    int x = 0;
+    for (; x + 16 <= width; x += 16) {
+        uint8x16x4_t s = vld4q_u8(src + x * 4);
+        uint8x16_t sa = s.val[3];
+        if (vmaxvq_u8(sa) == 0) {
+            continue;
+        }
+        if (vminvq_u8(sa) == 255) {
+            vst4q_u8(dst + x * 4, s);
+            continue;
+        }
+        uint8x16x4_t d = vld4q_u8(dst + x * 4);
+        if (vminvq_u8(d.val[3]) != 255) {
+            BlendOverRowScalar(dst + x * 4, src + x * 4, 16);
+            continue;
+        }
+        // 目标不透明：out = (s * sa + d * (255 - sa)) / 255
+        uint8x16_t inv_sa = vmvnq_u8(sa);
+        for (int c = 0; c < 3; ++c) {
+            uint16x8_t lo = vmlal_u8(vmull_u8(vget_low_u8(s.val[c]), vget_low_u8(sa)), vget_low_u8(d.val[c]),
+                                     vget_low_u8(inv_sa));
+            uint16x8_t hi = vmlal_u8(vmull_u8(vget_high_u8(s.val[c]), vget_high_u8(sa)), vget_high_u8(d.val[c]),
+                                     vget_high_u8(inv_sa));
+            lo = vaddq_u16(vaddq_u16(lo, vdupq_n_u16(1)), vshrq_n_u16(lo, 8));
+            hi = vaddq_u16(vaddq_u16(hi, vdupq_n_u16(1)), vshrq_n_u16(hi, 8));
+            d.val[c] = vcombine_u8(vshrn_n_u16(lo, 8), vshrn_n_u16(hi, 8));
+        }
+        vst4q_u8(dst + x * 4, d);
+    }
+    BlendOverRowScalar(dst + x * 4, src + x * 4, width - x);
+}
+
+#elif KR_APNG_PIXEL_OPS_SSE2
+
+void APNGPixelOps::BlendOverRow(uint8_t *dst, const uint8_t *src, int width) {
+    const __m128i alpha_mask = _mm_set1_epi32(static_cast<int>(0xFF000000u));
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i one = _mm_set1_epi16(1);
+    const __m128i full = _mm_set1_epi16(255);
+    int x = 0;
+    for (; x + 4 <= width; x += 4) {
+        __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + x * 4));
+        __m128i s_alpha = _mm_and_si128(s, alpha_mask);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(s_alpha, zero)) == 0xFFFF) {
+            continue;
+        }
+        __m128i *dst_ptr = reinterpret_cast<__m128i *>(dst + x * 4);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(s_alpha, alpha_mask)) == 0xFFFF) {
+            _mm_storeu_si128(dst_ptr, s);
+            continue;
+        }
+        __m128i d = _mm_loadu_si128(dst_ptr);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(d, alpha_mask), alpha_mask)) != 0xFFFF) {
+            BlendOverRowScalar(dst + x * 4, src + x * 4, 4);
+            continue;
+        }
+        // 目标不透明：out = (s * sa + d * (255 - sa)) / 255，alpha 通道固定为 255
+        __m128i s_lo = _mm_unpacklo_epi8(s, zero);
+        __m128i s_hi = _mm_unpackhi_epi8(s, zero);
+        __m128i d_lo = _mm_unpacklo_epi8(d, zero);
+        __m128i d_hi = _mm_unpackhi_epi8(d, zero);
+        __m128i a_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(s_lo, 0xFF), 0xFF);
+        __m128i a_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(s_hi, 0xFF), 0xFF);
+        __m128i lo = _mm_add_epi16(_mm_mullo_epi16(s_lo, a_lo), _mm_mullo_epi16(d_lo, _mm_sub_epi16(full, a_lo)));
+        __m128i hi = _mm_add_epi16(_mm_mullo_epi16(s_hi, a_hi), _mm_mullo_epi16(d_hi, _mm_sub_epi16(full, a_hi)));
+        lo = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(lo, one), _mm_srli_epi16(lo, 8)), 8);
+        hi = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(hi, one), _mm_srli_epi16(hi, 8)), 8);
+        _mm_storeu_si128(dst_ptr, _mm_or_si128(_mm_packus_epi16(lo, hi), alpha_mask));
+    }
+    BlendOverRowScalar(dst + x * 4, src + x * 4, width - x);
+}
+
+#else
+
+void APNGPixelOps::BlendOverRow(uint8_t *dst, const uint8_t *src, int width) {
+    BlendOverRowScalar(dst, src, width);
+}
+
+#endif
+
+void APNGPixelOps::BlendOverRect(uint8_t *dst, size_t dst_stride, const uint8_t *src, size_t src_stride, int width,
+                                 int height) {
+    for (int y = 0; y < height; ++y) {
+        BlendOverRow(dst + y * dst_stride, src + y * src_stride, width);
+    }
+}
+
+void APNGPixelOps::CopyRect(uint8_t *dst, size_t dst_stride, const uint8_t *src, size_t src_stride, int width,
+                            int height) {
+    size_t row_bytes = static_cast<size_t>(width) * 4;
+    if (dst_stride == row_bytes && src_stride == row_bytes) {
+        memcpy(dst, src, row_bytes * height);
+        return;
+    }
+    for (int y = 0; y < height; ++y) {
+        memcpy(dst + y * dst_stride, src + y * src_stride, row_bytes);
+    }
+}
+
+void APNGPixelOps::ClearRect(uint8_t *dst, size_t dst_stride, int width, int height) {
+    size_t row_bytes = static_cast<size_t>(width) * 4;
+    if (dst_stride == row_bytes) {
+        memset(dst, 0, row_bytes * height);
+        return;
+    }
+    for (int y = 0; y < height; ++y) {
+        memset(dst + y * dst_stride, 0, row_bytes);
+    }
+}
@@ -0,0 +1,54 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 THL A29 Limited, a Tencent company. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_APNGPIXELOPS_H
+#define CORE_RENDER_OHOS_APNGPIXELOPS_H
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * APNG 合成用的 RGBA_8888 像素操作，stride 以字节为单位，宽度以像素为单位
+ * 混合使用整数运算，arm64 下使用 NEON、x86 下使用 SSE2，其余平台走标量实现
+ */
+class APNGPixelOps {
+ public:
+    /**
+     * 将 src 按 APNG_BLEND_OP_OVER（非预乘 alpha）混合到 dst
+     */
+    static void BlendOverRect(uint8_t *dst, size_t dst_stride, const uint8_t *src, size_t src_stride, int width,
+                              int height);
+
+    /**
+     * 将 src 区域拷贝到 dst（APNG_BLEND_OP_SOURCE 及 dispose 恢复）
+     */
+    static void CopyRect(uint8_t *dst, size_t dst_stride, const uint8_t *src, size_t src_stride, int width,
+                         int height);
+
+    /**
+     * 将 dst 区域清为全透明（APNG_DISPOSE_OP_BACKGROUND）
+     */
+    static void ClearRect(uint8_t *dst, size_t dst_stride, int width, int height);
+
+    /**
+     * 标量实现，SIMD 路径处理不了的像素回落到这里
+     */
+    static void BlendOverRowScalar(uint8_t *dst, const uint8_t *src, int width);
+
+ private:
+    static void BlendOverRow(uint8_t *dst, const uint8_t *src, int width);
+};
+
+#endif  // CORE_RENDER_OHOS_APNGPIXELOPS_H
@@ -15,8 +15,11 @@
 
 #include "libohos_render/expand/components/apng/APNGStructs.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include "libohos_render/expand/components/apng/APNGPixelOps.h"
+#include "libohos_render/foundation/thread/KRGCDQueue.h"
 
 void Frame::SetImageBuffer(std::vector<std::vector<uint8_t>> &image_buffer) {
     if (width == 0) {
@@ -57,6 +60,7 @@ static OH_PixelmapNative *CreatePixelMap(std::shared_ptr<Frame> frame) {
     // ops参数支持传入nullptr, 当不需要设置解码参数时，不用创建
     errCode = OH_ImageSourceNative_CreatePixelmap(source, ops, &resPixMap);
     OH_DecodingOptions_Release(ops);
+    OH_ImageSourceNative_Release(source);
 
     if (errCode != IMAGE_SUCCESS) {
         KR_LOG_ERROR << "ImageSourceNativeCTest sourceTest OH_ImageSourceNative_CreatePixelmap failed, errCode: "
@@ -68,7 +72,10 @@ static OH_PixelmapNative *CreatePixelMap(std::shared_ptr<Frame> frame) {
 
 static bool PixelmapToBitmapBuffer(OH_PixelmapNative *pixelmap, size_t bufferSize, std::vector<uint8_t> &buffer) {
     buffer.clear();
-    buffer.reserve(bufferSize);
+    if (pixelmap == nullptr) {
+        return false;
+    }
+    buffer.resize(bufferSize);
     Image_ErrorCode errCode = OH_PixelmapNative_ReadPixels(pixelmap, buffer.data(), &bufferSize);
     if (errCode != IMAGE_SUCCESS) {
         KR_LOG_ERROR << "ImageSourceNativeCTest sourceTest PixelMapToBitmapBuffer failed, errCode: " << errCode;
@@ -89,6 +96,7 @@ static OH_PixelmapNative *BitmapBufferToPixelmap(size_t bufferSize, int width, i
     // OH_PixelmapInitializationOptions_SetAlphaType(createOpts, PIXELMAP_ALPHA_TYPE_);
 
     Image_ErrorCode errCode = OH_PixelmapNative_CreateEmptyPixelmap(createOpts, &resPixMap);
+    OH_PixelmapInitializationOptions_Release(createOpts);
 
     if (errCode != IMAGE_SUCCESS) {
         KR_LOG_ERROR << "BitmapBufferToPixelmap sourceTest OH_PixelmapNative_CreateEmptyPixelmap failed, errCode: "
@@ -101,153 +109,131 @@ static OH_PixelmapNative *BitmapBufferToPixelmap(size_t bufferSize, int width, i
         KR_LOG_ERROR << "BitmapBufferToPixelmap BitmapBufferToPixelmap sourceTest OH_PixelmapNative_WritePixels "
                         "failed, errCode: "
                      << errCode;
+        OH_PixelmapNative_Release(resPixMap);
         return nullptr;
     }
 
     return resPixMap;
 }
 
-APNG::~APNG() {
-    std::unique_lock<std::mutex> lock(drawableMutex);
-    for (const auto &drawable : animateDrawables) {
-        if (drawable && drawable->pixelmap) {
-            OH_PixelmapNative_Release(drawable->pixelmap);
-        }
-        if (drawable && drawable->drawable) {
-            OH_ArkUI_DrawableDescriptor_Dispose(drawable->drawable);
-        }
-        drawable->drawable = nullptr;
-        drawable->pixelmap = nullptr;
+APNGDrawable::~APNGDrawable() {
+    if (drawable) {
+        OH_ArkUI_DrawableDescriptor_Dispose(drawable);
+        drawable = nullptr;
+    }
+    if (pixelmap) {
+        OH_PixelmapNative_Release(pixelmap);
+        pixelmap = nullptr;
     }
-    animateDrawables.clear();
 }
 
-bool APNG::DidAddFrame(std::shared_ptr<Frame> frame, int index) {
-    if (frame->width == 0 || frame->height == 0) {
-        return false;
+std::shared_ptr<APNGDrawable> APNGCompositor::ComposeNext(const std::shared_ptr<Frame> &frame) {
+    size_t canvasSize = static_cast<size_t>(width_) * height_ * 4;
+    if (canvas_.size() != canvasSize) {
+        canvas_.assign(canvasSize, 0);
     }
-    bool didHandled = false;
-    // 首个完整帧
-    if (frame->width == width && frame->height == height && !hasFirstFullFrame) {
-        auto drawable = std::make_shared<APNGDrawable>();
-        drawable->pixelmap = CreatePixelMap(frame);
-        if (drawable->pixelmap) {
-            hasFirstFullFrame = true;
-            drawable->drawable = OH_ArkUI_DrawableDescriptor_CreateFromPixelMap(drawable->pixelmap);
-            didHandled = true;
-            size_t bufferSize = width * height * 4;
-            AddDrawable(drawable, index);
-            lazyBeforeNextFrameTask = [needApplyPixelmap = drawable->pixelmap, frame, bufferSize, this]() {
-                PixelmapToBitmapBuffer(needApplyPixelmap, bufferSize, this->curBitmapBuffer);
-                HandlePostFrameDisposeOp(frame);
-            };
-        }
-    } else if (hasFirstFullFrame) {  // 非完整帧依赖合成
-        size_t bufferSize = width * height * 4;
-        if (this->lazyBeforeNextFrameTask) {
-            this->lazyBeforeNextFrameTask();
-            this->lazyBeforeNextFrameTask = nullptr;
-        }
-        if (frame->disposeOp == 2) {  // 保存上一帧到缓冲区
-            previousBuffer = curBitmapBuffer;
-        }
-        HandleFrameBlendOp(frame, index);
-        HandlePostFrameDisposeOp(frame);
-        didHandled = true;
+    DisposeLastFrame();
+    if (frame->width <= 0 || frame->height <= 0 || frame->left < 0 || frame->top < 0 ||
+        frame->left + frame->width > width_ || frame->top + frame->height > height_) {
+        KR_LOG_ERROR << "APNG frame out of canvas, frame:" << frame->left << "," << frame->top << "," << frame->width
+                     << "," << frame->height << " canvas:" << width_ << "," << height_;
+        return nullptr;
     }
-    return didHandled;
-}
-
-void APNG::HandleFrameBlendOp(std::shared_ptr<Frame> frame, int index) {
-    // 合成// 根据 blendOp 合成帧
-    auto &drawingBuffer = this->curBitmapBuffer;
     auto framePixelmap = CreatePixelMap(frame);
-    auto frameBuffer = std::vector<uint8_t>();
-    int frameBufferSize = frame->width * frame->height * 4;
-    bool frameDecodeSuccess = PixelmapToBitmapBuffer(framePixelmap, frameBufferSize, frameBuffer);
+    std::vector<uint8_t> frameBuffer;
+    bool frameDecodeSuccess =
+        PixelmapToBitmapBuffer(framePixelmap, static_cast<size_t>(frame->width) * frame->height * 4, frameBuffer);
+    if (framePixelmap) {
+        OH_PixelmapNative_Release(framePixelmap);
+    }
     if (!frameDecodeSuccess) {
-        return;
+        return nullptr;
     }
-    for (int y = 0; y < frame->height; ++y) {
-        for (int x = 0; x < frame->width; ++x) {
-            int srcIdx = (y * frame->width + x) * 4;
-            int dstIdx = ((y + frame->top) * width + (x + frame->left)) * 4;
-
-            if (frame->blendOp == 0) {  // 覆盖操作
-                drawingBuffer[dstIdx + 0] = frameBuffer[srcIdx + 0];
-                drawingBuffer[dstIdx + 1] = frameBuffer[srcIdx + 1];
-                drawingBuffer[dstIdx + 2] = frameBuffer[srcIdx + 2];
-                drawingBuffer[dstIdx + 3] = frameBuffer[srcIdx + 3];
-            } else if (frame->blendOp == 1) {
-                // 在这里执行混合操作，例如使用 alpha 通道作为权重计算新的颜色值
-                uint8_t srcR = frameBuffer[srcIdx + 0];
-                uint8_t srcG = frameBuffer[srcIdx + 1];
-                uint8_t srcB = frameBuffer[srcIdx + 2];
-                uint8_t srcA = frameBuffer[srcIdx + 3];
+    if (frame->disposeOp == 2) {  // 只保存该帧区域合成前的内容，下一帧合成前恢复
+        size_t frameStride = static_cast<size_t>(frame->width) * 4;
+        previous_.resize(frameStride * frame->height);
+        APNGPixelOps::CopyRect(previous_.data(), frameStride, FrameRectOrigin(*frame), CanvasStride(), frame->width,
+                               frame->height);
+    }
+    BlendFrame(frame, frameBuffer);
+    last_frame_ = frame;
 
-                uint8_t dstR = drawingBuffer[dstIdx + 0];
-                uint8_t dstG = drawingBuffer[dstIdx + 1];
-                uint8_t dstB = drawingBuffer[dstIdx + 2];
-                uint8_t dstA = drawingBuffer[dstIdx + 3];
+    auto pixelmap = BitmapBufferToPixelmap(canvasSize, width_, height_, canvas_);
+    if (pixelmap == nullptr) {
+        return nullptr;
+    }
+    auto drawable = std::make_shared<APNGDrawable>();
+    drawable->pixelmap = pixelmap;
+    drawable->drawable = OH_ArkUI_DrawableDescriptor_CreateFromPixelMap(drawable->pixelmap);
+    return drawable;
+}
 
-                float srcAlpha = srcA / 255.0f;
-                float dstAlpha = dstA / 255.0f;
-                float outAlpha = srcAlpha + dstAlpha * (1 - srcAlpha);
+void APNGCompositor::Reset() {
+    std::fill(canvas_.begin(), canvas_.end(), 0);
+    previous_.clear();
+    last_frame_ = nullptr;
+}
 
-                if (outAlpha == 0) {
-                    drawingBuffer[dstIdx + 0] = 0;
-                    drawingBuffer[dstIdx + 1] = 0;
-                    drawingBuffer[dstIdx + 2] = 0;
-                    drawingBuffer[dstIdx + 3] = 0;
-                } else {
-                    drawingBuffer[dstIdx + 0] =
-                        static_cast<uint8_t>((srcR * srcAlpha + dstR * dstAlpha * (1 - srcAlpha)) / outAlpha);
-                    drawingBuffer[dstIdx + 1] =
-                        static_cast<uint8_t>((srcG * srcAlpha + dstG * dstAlpha * (1 - srcAlpha)) / outAlpha);
-                    drawingBuffer[dstIdx + 2] =
-                        static_cast<uint8_t>((srcB * srcAlpha + dstB * dstAlpha * (1 - srcAlpha)) / outAlpha);
-                    drawingBuffer[dstIdx + 3] = static_cast<uint8_t>(outAlpha * 255);
-                }
-            }
-        }
+void APNGCompositor::BlendFrame(const std::shared_ptr<Frame> &frame, const std::vector<uint8_t> &frameBuffer) {
+    uint8_t *dst = FrameRectOrigin(*frame);
+    size_t frameStride = static_cast<size_t>(frame->width) * 4;
+    if (frame->blendOp == 0) {  // 覆盖操作
+        APNGPixelOps::CopyRect(dst, CanvasStride(), frameBuffer.data(), frameStride, frame->width, frame->height);
+    } else {
+        APNGPixelOps::BlendOverRect(dst, CanvasStride(), frameBuffer.data(), frameStride, frame->width,
+                                    frame->height);
     }
+}
 
-    auto pixelmap = BitmapBufferToPixelmap(width * height * 4, width, height, this->curBitmapBuffer);
-    if (pixelmap) {
-        auto drawable = std::make_shared<APNGDrawable>();
-        drawable->pixelmap = pixelmap;
-        drawable->drawable = OH_ArkUI_DrawableDescriptor_CreateFromPixelMap(drawable->pixelmap);
-        AddDrawable(drawable, index);
+void APNGCompositor::DisposeLastFrame() {
+    if (last_frame_ == nullptr) {
+        return;
+    }
+    auto frame = std::move(last_frame_);
+    uint8_t *dst = FrameRectOrigin(*frame);
+    if (frame->disposeOp == 1) {  // 清除上一帧区域
+        APNGPixelOps::ClearRect(dst, CanvasStride(), frame->width, frame->height);
+    } else if (frame->disposeOp == 2) {  // 恢复上一帧区域合成前的内容
+        APNGPixelOps::CopyRect(dst, CanvasStride(), previous_.data(), static_cast<size_t>(frame->width) * 4,
+                               frame->width, frame->height);
     }
 }
 
-void APNG::HandlePostFrameDisposeOp(std::shared_ptr<Frame> frame) {
-    if (frame->disposeOp == 1) {  // 清理当前区域
-        auto &drawingBuffer = this->curBitmapBuffer;
-        // 清除当前帧区域
-        for (int y = 0; y < frame->height; ++y) {
-            for (int x = 0; x < frame->width; ++x) {
-                int dstIdx = ((y + frame->top) * width + (x + frame->left)) * 4;
-                drawingBuffer[dstIdx + 0] = 0;
-                drawingBuffer[dstIdx + 1] = 0;
-                drawingBuffer[dstIdx + 2] = 0;
-                drawingBuffer[dstIdx + 3] = 0;
-            }
-        }
-    } else if (frame->disposeOp == 2) {
-        previousBuffer = this->curBitmapBuffer;
+APNG::~APNG() {
+    std::unique_lock<std::mutex> lock(drawableMutex);
+    animateDrawables.clear();
+}
+
+bool APNG::DidAddFrame(std::shared_ptr<Frame> frame, int index) {
+    if (frame->width == 0 || frame->height == 0) {
+        return false;
     }
+    if (compositor_ == nullptr) {
+        compositor_ = std::make_unique<APNGCompositor>(width, height);
+    }
+    auto drawable = compositor_->ComposeNext(frame);
+    if (drawable == nullptr) {
+        return false;
+    }
+    AddDrawable(drawable, index);
+    // 已解码为位图，不再需要编码数据
+    std::vector<uint8_t>().swap(frame->data);
+    return true;
 }
 
-void APNG::AddDrawable(std::shared_ptr<APNGDrawable> drawable, int curFrameIndex) {
-    std::unique_lock<std::mutex> lock(drawableMutex);
+void APNG::SetupDrawableTiming(APNGDrawable &drawable, int curFrameIndex) {
     if (curFrameIndex + 1 < this->frames.size()) {
-        drawable->isLast = false;
-        drawable->nextFrameDelay = this->frames[curFrameIndex + 1]->delay;
+        drawable.isLast = false;
+        drawable.nextFrameDelay = this->frames[curFrameIndex + 1]->delay;
     } else {
-        drawable->nextFrameDelay = this->frames[this->frames.size() - 1]->delay;
-        drawable->isLast = true;
+        drawable.nextFrameDelay = this->frames[this->frames.size() - 1]->delay;
+        drawable.isLast = true;
     }
+}
+
+void APNG::AddDrawable(std::shared_ptr<APNGDrawable> drawable, int curFrameIndex) {
+    std::unique_lock<std::mutex> lock(drawableMutex);
+    SetupDrawableTiming(*drawable, curFrameIndex);
     animateDrawables.push_back(drawable);
 }
 
@@ -258,3 +244,118 @@ std::shared_ptr<APNGDrawable> APNG::GetDrawable(int index) {
     }
     return nullptr;
 }
+
+size_t APNG::MemoryCost() const {
+    size_t bytes = 0;
+    for (const auto &frame : frames) {
+        if (frame->width <= 0 || frame->height <= 0) {
+            continue;
+        }
+        bytes += streaming_ ? frame->data.size() : FrameBytes();
+    }
+    return bytes;
+}
+
+APNGFrameStream::APNGFrameStream(std::shared_ptr<APNG> apng)
+    : apng_(std::move(apng)), compositor_(apng_->width, apng_->height) {
+    if (apng_->IsStreaming()) {
+        for (int i = 0; i < apng_->frames.size(); ++i) {
+            if (apng_->frames[i]->width > 0 && apng_->frames[i]->height > 0) {
+                playable_frames_.push_back(i);
+            }
+        }
+    }
+}
+
+std::shared_ptr<APNGDrawable> APNGFrameStream::GetDrawable(int index) {
+    if (!apng_->IsStreaming()) {
+        return apng_->GetDrawable(index);
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (index < window_begin_) {
+        // 回到开头重新播放，合成需从第 0 帧开始
+        window_.clear();
+        window_begin_ = 0;
+        next_decode_index_ = 0;
+        generation_++;
+        reset_compositor_ = true;
+        failed_ = false;
+    }
+    while (!window_.empty() && window_begin_ < index) {
+        window_.pop_front();
+        window_begin_++;
+    }
+    std::shared_ptr<APNGDrawable> drawable = nullptr;
+    if (index >= window_begin_ && index < window_begin_ + static_cast<int>(window_.size())) {
+        drawable = window_[index - window_begin_];
+    }
+    ScheduleDecodeIfNeed();
+    return drawable;
+}
+
+bool APNGFrameStream::IsEnd(int index) {
+    if (!apng_->IsStreaming()) {
+        return !apng_->IsParsing() && apng_->GetDrawable(index) == nullptr;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (index >= static_cast<int>(playable_frames_.size())) {
+        return true;
+    }
+    return failed_ && index >= window_begin_ + static_cast<int>(window_.size());
+}
+
+bool APNGFrameStream::WindowFull() const {
+    const auto &config = APNGDecodeConfig::Default();
+    if (window_.empty()) {
+        return false;
+    }
+    return window_.size() >= config.windowFrames || (window_.size() + 1) * apng_->FrameBytes() > config.windowBytes;
+}
+
+void APNGFrameStream::ScheduleDecodeIfNeed() {
+    if (decoding_ || failed_ || next_decode_index_ >= static_cast<int>(playable_frames_.size()) || WindowFull()) {
+        return;
+    }
+    decoding_ = true;
+    std::weak_ptr<APNGFrameStream> weak_self = shared_from_this();
+    KRGCDQueue::GetInstance().DispatchAsync([weak_self] {
+        if (auto self = weak_self.lock()) {
+            self->DecodeLoop();
+        }
+    });
+}
+
+void APNGFrameStream::DecodeLoop() {
+    while (true) {
+        int frame_index = 0;
+        uint32_t generation = 0;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (reset_compositor_) {
+                compositor_.Reset();
+                reset_compositor_ = false;
+            }
+            if (failed_ || next_decode_index_ >= static_cast<int>(playable_frames_.size()) || WindowFull()) {
+                decoding_ = false;
+                return;
+            }
+            frame_index = playable_frames_[next_decode_index_];
+            generation = generation_;
+        }
+        auto drawable = compositor_.ComposeNext(apng_->frames[frame_index]);
+        if (drawable) {
+            apng_->SetupDrawableTiming(*drawable, frame_index);
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (generation != generation_) {
+            continue;  // 解码期间发生了回绕，丢弃结果
+        }
+        if (drawable == nullptr) {
+            failed_ = true;
+            decoding_ = false;
+            return;
+        }
+        window_.push_back(std::move(drawable));
+        next_decode_index_++;
+    }
+}
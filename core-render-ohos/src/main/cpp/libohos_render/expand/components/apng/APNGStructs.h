@@ -27,10 +27,15 @@
 #include <multimedia/image_framework/image_pixel_map_mdk.h>
 #include <native_drawing/drawing_canvas.h>
 #include <array>
+#include <atomic>
 #include <cstdint>
 #include <cstring>
+#include <deque>
 #include <execution>  // For std::execution::par
+#include <functional>
 #include <iostream>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
 #include <vector>
@@ -55,12 +60,61 @@ class Frame {
 
 class APNGDrawable {
  public:
+    ~APNGDrawable();
     int nextFrameDelay = 0;  // 如果为-1, 则没有下一个drawable
     bool isLast = false;
     OH_PixelmapNative *pixelmap = nullptr;
     ArkUI_DrawableDescriptor *drawable = nullptr;
 };
 
+/**
+ * 帧窗口配置：帧数超过 fullDecodeBytes 的动画改为流式解码，仅保留合成画布与少量预解码帧
+ */
+struct APNGDecodeConfig {
+    size_t fullDecodeBytes = 8 * 1024 * 1024;  // 全部解码后总字节数不超过该值时提前解码所有帧
+    size_t windowFrames = 4;                   // 流式解码时预解码的最大帧数
+    size_t windowBytes = 8 * 1024 * 1024;      // 流式解码时预解码帧的最大字节数
+
+    static APNGDecodeConfig &Default() {
+        static APNGDecodeConfig config;
+        return config;
+    }
+};
+
+/**
+ * 帧合成器：维护合成画布，按 APNG 的 dispose/blend 规则依次合成每一帧
+ */
+class APNGCompositor {
+ public:
+    APNGCompositor(int width, int height) : width_(width), height_(height) {}
+
+    /**
+     * 合成下一帧并生成可绘制对象，帧必须按顺序传入
+     */
+    std::shared_ptr<APNGDrawable> ComposeNext(const std::shared_ptr<Frame> &frame);
+
+    /**
+     * 回到第 0 帧之前的状态
+     */
+    void Reset();
+
+ private:
+    int width_ = 0;
+    int height_ = 0;
+    std::vector<uint8_t> canvas_;
+    std::vector<uint8_t> previous_;      // dispose 为 2 的帧所在区域合成前的内容
+    std::shared_ptr<Frame> last_frame_;  // 上一帧，合成下一帧前执行其 dispose
+
+    size_t CanvasStride() const {
+        return static_cast<size_t>(width_) * 4;
+    }
+    uint8_t *FrameRectOrigin(const Frame &frame) {
+        return canvas_.data() + frame.top * CanvasStride() + static_cast<size_t>(frame.left) * 4;
+    }
+    void BlendFrame(const std::shared_ptr<Frame> &frame, const std::vector<uint8_t> &frameBuffer);
+    void DisposeLastFrame();
+};
+
 class APNG {
  public:
     bool isAPNG = true;
@@ -69,7 +123,7 @@ class APNG {
     int numPlays = 0;
     int playTime = 0;
     std::vector<std::shared_ptr<Frame>> frames;
-    std::vector<std::shared_ptr<APNGDrawable>> animateDrawables;  // 播放帧
+    std::vector<std::shared_ptr<APNGDrawable>> animateDrawables;  // 播放帧（仅提前解码模式）
     ~APNG();
 
     void WillParseFrame() {
@@ -78,29 +132,82 @@ class APNG {
     bool DidAddFrame(std::shared_ptr<Frame> frame, int index);
     void DidEndParserFrame() {
         isParsing.store(false);
-        lazyBeforeNextFrameTask = nullptr;
+        compositor_ = nullptr;
     }
 
     bool IsParsing() {
         return isParsing.load();
     }
 
+    /**
+     * 是否流式解码（帧由各播放视图的 APNGFrameStream 按需解码）
+     */
+    bool IsStreaming() const {
+        return streaming_;
+    }
+    void SetStreaming(bool streaming) {
+        streaming_ = streaming;
+    }
+
+    size_t FrameBytes() const {
+        return static_cast<size_t>(width) * height * 4;
+    }
+
     std::shared_ptr<APNGDrawable> GetDrawable(int index);
 
+    /**
+     * 缓存计量用的内存占用：提前解码模式按全部帧像素估算，流式模式为各帧的编码数据
+     */
+    size_t MemoryCost() const;
+
+    /**
+     * 根据帧序号设置 drawable 的播放时长与是否末帧
+     */
+    void SetupDrawableTiming(APNGDrawable &drawable, int curFrameIndex);
+
  private:
     std::atomic_bool isParsing = true;
-    std::function<void()> lazyBeforeNextFrameTask = nullptr;
-    std::vector<uint8_t> curBitmapBuffer;
-    std::vector<uint8_t> previousBuffer;
+    bool streaming_ = false;
+    std::unique_ptr<APNGCompositor> compositor_;
     std::mutex drawableMutex;
 
-    bool hasFirstFullFrame = false;
+    void AddDrawable(std::shared_ptr<APNGDrawable> drawable, int curFrameIndex);
+};
+
+/**
+ * 单个播放视图的帧来源：提前解码模式直接读取 APNG 的帧；流式模式在工作线程按播放进度解码，
+ * 只保留合成画布和一个有界的预解码窗口
+ */
+class APNGFrameStream : public std::enable_shared_from_this<APNGFrameStream> {
+ public:
+    explicit APNGFrameStream(std::shared_ptr<APNG> apng);
+
+    /**
+     * 获取第 index 帧，尚未解码完成时返回 nullptr；同时丢弃 index 之前的帧并触发后续解码
+     */
+    std::shared_ptr<APNGDrawable> GetDrawable(int index);
 
-    void HandleFrameBlendOp(std::shared_ptr<Frame> frame, int index);
+    /**
+     * index 是否已超出最后一帧
+     */
+    bool IsEnd(int index);
 
-    void HandlePostFrameDisposeOp(std::shared_ptr<Frame> frame);
-    //
-    void AddDrawable(std::shared_ptr<APNGDrawable> drawable, int curFrameIndex);
+ private:
+    std::shared_ptr<APNG> apng_;
+    std::vector<int> playable_frames_;  // 流式模式下可播放帧在 frames 中的下标
+    std::mutex mutex_;
+    std::deque<std::shared_ptr<APNGDrawable>> window_;
+    int window_begin_ = 0;          // window_ 首帧的帧序号
+    int next_decode_index_ = 0;     // 下一个待解码的帧序号
+    uint32_t generation_ = 0;       // 回绕时递增，丢弃回绕前发起的解码结果
+    bool decoding_ = false;         // 是否有解码任务在执行
+    bool reset_compositor_ = false;
+    bool failed_ = false;           // 解码失败，播放到已解码的最后一帧为止
+    APNGCompositor compositor_;     // 仅在解码任务中访问
+
+    bool WindowFull() const;
+    void ScheduleDecodeIfNeed();
+    void DecodeLoop();
 };
 
 enum APNGEvent { LOAD_FAILURE, ANIMATION_START, ANIMATION_END };
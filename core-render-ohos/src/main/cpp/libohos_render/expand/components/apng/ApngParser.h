@@ -16,6 +16,7 @@
 #ifndef CORE_RENDER_OHOS_APNGPARSER_H
 #define CORE_RENDER_OHOS_APNGPARSER_H
 
+#include <algorithm>
 #include <array>
 #include <cstdint>
 #include <cstring>
@@ -248,6 +249,11 @@ static void parseAPNG(std::vector<uint8_t> &buffer, std::function<void(std::shar
         completion(apng);
         return;
     }
+    size_t playableCount = std::count_if(apng->frames.begin(), apng->frames.end(), [](const auto &f) {
+        return f->width > 0 && f->height > 0;
+    });
+    // 全部解码占用过大时只组装每帧的 PNG 数据，由播放视图按需流式解码
+    apng->SetStreaming(playableCount * apng->FrameBytes() > APNGDecodeConfig::Default().fullDecodeBytes);
     apng->WillParseFrame();
     int index = 0;
     bool didAddFrameSuccess = false;
@@ -270,7 +276,8 @@ static void parseAPNG(std::vector<uint8_t> &buffer, std::function<void(std::shar
         }
         bb.insert(bb.end(), postDataParts.begin(), postDataParts.end());
         frame->SetImageBuffer(bb);
-        if (apng->DidAddFrame(frame, index) && !didAddFrameSuccess) {
+        // 流式模式不在此解码
+        if (!apng->IsStreaming() && apng->DidAddFrame(frame, index) && !didAddFrameSuccess) {
             didAddFrameSuccess = true;
             completion(apng);
         }
@@ -280,7 +287,7 @@ static void parseAPNG(std::vector<uint8_t> &buffer, std::function<void(std::shar
     }
     apng->DidEndParserFrame();
 
-    if (apng->frames.empty()) {
+    if (apng->frames.empty() || (apng->IsStreaming() && playableCount == 0)) {
         apng->isAPNG = false;
     }
     if (!didAddFrameSuccess) {
@@ -26,45 +26,30 @@
 #include "libohos_render/utils/KRURIHelper.h"
 #include "libohos_render/utils/KRStringUtil.h"
 
-constexpr char kPropNameSrc[] = "src";
-constexpr char kPropNameAutoPlay[] = "autoPlay";
-constexpr char kPropNameRepeatCount[] = "repeatCount";
-constexpr char kEventLoadFailure[] = "loadFailure";
-constexpr char kEventAnimatedStart[] = "animationStart";
-constexpr char kEventAnimatedEnd[] = "animationEnd";
-
 bool KRApngView::SetProp(const std::string &prop_key, const KRAnyValue &prop_value,
                          const KRRenderCallback event_call_back) {
-    if (kuikly::util::isEqual(prop_key, kPropNameSrc)) {  // setSrc
-        auto src = prop_value->toString();
-        SetSrc(src);
-        return true;
-    }
-    if (kuikly::util::isEqual(prop_key, kPropNameAutoPlay)) {  // setSrc
-        SetAutoPlay(prop_value->toBool());
-        return true;
-    }
-
-    if (kuikly::util::isEqual(prop_key, kPropNameRepeatCount)) {  //
-        SetRepeatCount(prop_value->toInt());
-        return true;
-    }
-
-    if (kuikly::util::isEqual(prop_key, kEventLoadFailure)) {  //
-        load_failure_callback_ = event_call_back;
-        return true;
+    switch (KRGetPropKeyId(prop_key)) {
+        case KRPropKeyId::kSrc:
+            SetSrc(prop_value->toString());
+            return true;
+        case KRPropKeyId::kAutoPlay:
+            SetAutoPlay(prop_value->toBool());
+            return true;
+        case KRPropKeyId::kRepeatCount:
+            SetRepeatCount(prop_value->toInt());
+            return true;
+        case KRPropKeyId::kLoadFailure:
+            load_failure_callback_ = event_call_back;
+            return true;
+        case KRPropKeyId::kAnimationStart:
+            animation_start_callback_ = event_call_back;
+            return true;
+        case KRPropKeyId::kAnimationEnd:
+            animation_end_callback_ = event_call_back;
+            return true;
+        default:
+            break;
     }
-
-    if (kuikly::util::isEqual(prop_key, kEventAnimatedStart)) {  //
-        animation_start_callback_ = event_call_back;
-        return true;
-    }
-
-    if (kuikly::util::isEqual(prop_key, kEventAnimatedEnd)) {  //
-        animation_end_callback_ = event_call_back;
-        return true;
-    }
-
     return IKRRenderViewExport::SetProp(prop_key, prop_value, event_call_back);
 }
 
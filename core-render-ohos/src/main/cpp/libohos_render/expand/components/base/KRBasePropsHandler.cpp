@@ -24,20 +24,7 @@
 #include "libohos_render/utils/KRViewUtil.h"
 
 const char *kBackgroundColor = "backgroundColor";
-const char *kFrame = "frame";
-const char *kBorderRadius = "borderRadius";
-const char *kBorder = "border";
 const char *kBackgroundImage = "backgroundImage";
-const char *kTransform = "transform";
-const char *kOpacity = "opacity";
-const char *kVisibility = "visibility";
-const char *kOverflow = "overflow";
-const char *kZIndex = "zIndex";
-const char *kTouchEnable = "touchEnable";
-const char *kAccessibility = "accessibility";
-const char *kBoxShadow = "boxShadow";
-const char *KAnimation = "animation";
-const char *kAnimationCompletion = "animationCompletion";
 
 // 动画完成回调事件参数
 constexpr char kParamKeyFinish[] = "finish";
@@ -53,209 +40,207 @@ void KRBasePropsHandler::OnDestroy() {
 
 bool KRBasePropsHandler::SetProp(const std::string &prop_key, const KRAnyValue &prop_value,
                                  const KRRenderCallback event_call_back) {
+    return SetProp(KRGetPropKeyId(prop_key), prop_key, prop_value, event_call_back);
+}
+
+bool KRBasePropsHandler::SetProp(KRPropKeyId key_id, const std::string &prop_key, const KRAnyValue &prop_value,
+                                 const KRRenderCallback event_call_back) {
+    if (!KRIsBasePropKeyId(key_id)) {  // 非基础属性
+        return false;
+    }
     if (tryAddCurrentAnimationOperation(prop_key, prop_value)) {
         return true;
     }
 
-    return SetPropWithoutAnimation(prop_key, prop_value, event_call_back);
+    return SetPropWithoutAnimation(key_id, prop_value, event_call_back);
 }
 
 bool KRBasePropsHandler::SetPropWithoutAnimation(const std::string &prop_key, const KRAnyValue &prop_value,
                                                  const KRRenderCallback event_call_back) {
+    return SetPropWithoutAnimation(KRGetPropKeyId(prop_key), prop_value, event_call_back);
+}
+
+bool KRBasePropsHandler::SetPropWithoutAnimation(KRPropKeyId key_id, const KRAnyValue &prop_value,
+                                                 const KRRenderCallback event_call_back) {
     if (node_ == nullptr) {
         return false;
     }
-    if (strcmp(prop_key.c_str(), kBackgroundColor) == 0) {  // 背景色
-        kuikly::util::UpdateNodeBackgroundColor(node_, kuikly::util::ConvertToHexColor(prop_value->toString()));
-        return true;
-    }
-    if (strcmp(prop_key.c_str(), kBorderRadius) == 0) {  // 圆角
-        auto borderRadiuses = kuikly::util::ConverToBorderRadiuses(prop_value->toString());
-        kuikly::util::UpdateNodeBorderRadius(node_, borderRadiuses);
-        if (!borderRadiuses.isAllZero()) {  // 圆角不为0，需要强制clip 子孩子，避免超出自身边界
-            force_overflow_ = true;
-            kuikly::util::UpdateNodeOverflow(node_, 1);
-        } else {
-            force_overflow_ = false;
-            kuikly::util::UpdateNodeOverflow(node_, css_overflow_);
-        }
-        return true;
-    }
-    if (strcmp(prop_key.c_str(), kBorder) == 0) {  // 边框样式
-        kuikly::util::UpdateNodeBorder(node_, prop_value->toString());
-        return true;
-    }
-    if (strcmp(prop_key.c_str(), kFrame) == 0) {
-        if (prop_value->isString()) {
-            KRRect frame;
-            const std::string &s = prop_value->toString();
-            memcpy(&frame, s.data(), s.size());
-            ResetTransformIfNeed();
-            kuikly::util::UpdateNodeFrame(node_, frame);
-            frame_ = frame;
-            if (css_transform_.length()) {
-                UpdateTransform(css_transform_);
+    switch (key_id) {
+        case KRPropKeyId::kBackgroundColor:  // 背景色
+            kuikly::util::UpdateNodeBackgroundColor(node_, kuikly::util::ConvertToHexColor(prop_value->toString()));
+            return true;
+        case KRPropKeyId::kBorderRadius: {  // 圆角
+            auto borderRadiuses = kuikly::util::ConverToBorderRadiuses(prop_value->toString());
+            kuikly::util::UpdateNodeBorderRadius(node_, borderRadiuses);
+            if (!borderRadiuses.isAllZero()) {  // 圆角不为0，需要强制clip 子孩子，避免超出自身边界
+                force_overflow_ = true;
+                kuikly::util::UpdateNodeOverflow(node_, 1);
+            } else {
+                force_overflow_ = false;
+                kuikly::util::UpdateNodeOverflow(node_, css_overflow_);
             }
             return true;
         }
-    }
-    if (strcmp(prop_key.c_str(), kBackgroundImage) == 0) {  // 背景渐变
-        kuikly::util::UpdateNodeBackgroundImage(node_, prop_value->toString());
-        return true;
-    }
-    if (strcmp(prop_key.c_str(), kTransform) == 0) {  // transform(旋转，位移，缩放，倾斜) （+anchor）
-        css_transform_ = prop_value->toString();
-        UpdateTransform(css_transform_);
-        return true;
-    }
-    if (strcmp(prop_key.c_str(), kOpacity) == 0) {  // 透明度
-        kuikly::util::UpdateNodeOpacity(node_, prop_value->toDouble());
-        return true;
-    }
-
-    if (strcmp(prop_key.c_str(), kVisibility) == 0) {  // Visibility
-        kuikly::util::UpdateNodeVisibility(node_, prop_value->toInt());
-        return true;
-    }
-
-    if (strcmp(prop_key.c_str(), kOverflow) == 0) {  // 裁剪
-        css_overflow_ = prop_value->toInt();
-        kuikly::util::UpdateNodeOverflow(node_, css_overflow_);
-        if (force_overflow_) {
-            kuikly::util::UpdateNodeOverflow(node_, 1);
+        case KRPropKeyId::kBorder:  // 边框样式
+            kuikly::util::UpdateNodeBorder(node_, prop_value->toString());
+            return true;
+        case KRPropKeyId::kFrame:
+            if (prop_value->isString()) {
+                KRRect frame;
+                const std::string &s = prop_value->toString();
+                memcpy(&frame, s.data(), s.size());
+                UpdateFrame(frame);
+                return true;
+            }
+            return false;
+        case KRPropKeyId::kBackgroundImage:  // 背景渐变
+            kuikly::util::UpdateNodeBackgroundImage(node_, prop_value->toString());
+            return true;
+        case KRPropKeyId::kTransform:  // transform(旋转，位移，缩放，倾斜) （+anchor）
+            css_transform_ = prop_value->toString();
+            UpdateTransform(css_transform_);
+            return true;
+        case KRPropKeyId::kOpacity:  // 透明度
+            kuikly::util::UpdateNodeOpacity(node_, prop_value->toDouble());
+            return true;
+        case KRPropKeyId::kVisibility:  // Visibility
+            kuikly::util::UpdateNodeVisibility(node_, prop_value->toInt());
+            return true;
+        case KRPropKeyId::kOverflow:  // 裁剪
+            css_overflow_ = prop_value->toInt();
+            kuikly::util::UpdateNodeOverflow(node_, css_overflow_);
+            if (force_overflow_) {
+                kuikly::util::UpdateNodeOverflow(node_, 1);
+            }
+            return true;
+        case KRPropKeyId::kZIndex:  // z-index
+            z_index_ = prop_value->toInt();
+            kuikly::util::UpdateNodeZIndex(node_, z_index_);
+            return true;
+        case KRPropKeyId::kTouchEnable:  // 禁用手势
+            kuikly::util::UpdateNodeHitTest(node_, prop_value->toBool());
+            return true;
+        case KRPropKeyId::kAccessibility:  // 无障碍化
+            kuikly::util::UpdateNodeAccessibility(node_, prop_value->toString());
+            return true;
+        case KRPropKeyId::kBoxShadow:  // 阴影
+            kuikly::util::UpdateNodeBoxShadow(node_, prop_value->toString());
+            return true;
+        case KRPropKeyId::kAnimation: {
+            auto animationStr = prop_value->toString();
+            kuikly::util::SetNodeAnimation(weakView_, &animationStr);
+            return true;
         }
-        return true;
-    }
-
-    if (strcmp(prop_key.c_str(), kZIndex) == 0) {  // z-index
-        z_index_ = prop_value->toInt();
-        kuikly::util::UpdateNodeZIndex(node_, z_index_);
-        return true;
-    }
-
-    if (strcmp(prop_key.c_str(), kTouchEnable) == 0) {  // 禁用手势
-        kuikly::util::UpdateNodeHitTest(node_, prop_value->toBool());
-        return true;
-    }
-
-    if (strcmp(prop_key.c_str(), kAccessibility) == 0) {  // 无障碍化
-        kuikly::util::UpdateNodeAccessibility(node_, prop_value->toString());
-        return true;
-    }
-
-    if (strcmp(prop_key.c_str(), kBoxShadow) == 0) {  // 阴影
-        kuikly::util::UpdateNodeBoxShadow(node_, prop_value->toString());
-        return true;
+        case KRPropKeyId::kAnimationCompletion:
+            animation_completion_callback_ = event_call_back;
+            return true;
+        default:
+            return false;
     }
+}
 
-    if (strcmp(prop_key.c_str(), KAnimation) == 0) {
-        auto animationStr = prop_value->toString();
-        kuikly::util::SetNodeAnimation(weakView_, &animationStr);
-        return true;
+bool KRBasePropsHandler::SetFrame(const KRRect &frame) {
+    if (node_ == nullptr) {
+        return false;
     }
-
-    if (strcmp(prop_key.c_str(), kAnimationCompletion) == 0) {
-        animation_completion_callback_ = event_call_back;
+    if (currentAnimation != nullptr && currentAnimation->isPropSupportAnimation(PROP_KEY_FRAME)) {
+        // 动画操作仍以属性值形式记录，仅在此情况下才封装KRRenderValue
+        std::string rect_data(reinterpret_cast<const char *>(&frame), sizeof(KRRect));
+        currentAnimation->addAnimationOperation(PROP_KEY_FRAME, NewKRRenderValue(rect_data));
         return true;
     }
-
-    return false;
+    UpdateFrame(frame);
+    return true;
 }
 
 bool KRBasePropsHandler::ResetProp(const std::string &prop_key) {
+    return ResetProp(KRGetPropKeyId(prop_key));
+}
+
+bool KRBasePropsHandler::ResetProp(KRPropKeyId key_id) {
     if (node_ == nullptr) {
         return false;
     }
     force_overflow_ = false;
-    if (strcmp(prop_key.c_str(), kBackgroundColor) == 0) {
-        kuikly::util::UpdateNodeBackgroundColor(node_, 0x00000000);  // 透明
-        kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_BACKGROUND_COLOR);
-        return true;
-    }
-    if (strcmp(prop_key.c_str(), kBorderRadius) == 0) {  // 圆角
-        kuikly::util::UpdateNodeBorderRadius(node_, KRBorderRadiuses());
-        kuikly::util::UpdateNodeOverflow(node_, 0);
-        kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_CLIP);
-        kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_BORDER_RADIUS);
-        return true;
-    }
-    if (strcmp(prop_key.c_str(), kBorder) == 0) {
-        kuikly::util::UpdateNodeBorder(node_, "0 solid 0");
-        kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_BORDER_WIDTH);
-        kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_BORDER_COLOR);
-        kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_BORDER_STYLE);
-        return true;
-    }
-    if (strcmp(prop_key.c_str(), kFrame) == 0) {
-        KRRect frame;
-        kuikly::util::UpdateNodeFrame(node_, frame);
-        frame_ = frame;
-        return true;
-    }
-
-    if (strcmp(prop_key.c_str(), kBackgroundImage) == 0) {
-        kuikly::util::UpdateNodeBackgroundImage(node_, "8,0 0,0 1");  // 重置为不渐变，且透明
-        kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_LINEAR_GRADIENT);
-        return true;
-    }
-
-    if (strcmp(prop_key.c_str(), kTransform) == 0) {
-        ResetTransformIfNeed();
-        css_transform_ = "";
-        kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_TRANSFORM_CENTER);
-        kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_TRANSFORM);
-        kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_ROTATE);
-        return true;
-    }
-
-    if (strcmp(prop_key.c_str(), kOpacity) == 0) {
-        kuikly::util::UpdateNodeOpacity(node_, 1);
-        kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_OPACITY);
-        return true;
-    }
-
-    if (strcmp(prop_key.c_str(), kVisibility) == 0) {  // 透明度
-        kuikly::util::UpdateNodeVisibility(node_, 1);
-        kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_VISIBILITY);
-        return true;
-    }
-
-    if (strcmp(prop_key.c_str(), kOverflow) == 0) {  // 裁剪子孩子
-        kuikly::util::UpdateNodeOverflow(node_, 0);
-        css_overflow_ = 0;
-        kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_CLIP);
-        return true;
-    }
-
-    if (strcmp(prop_key.c_str(), kZIndex) == 0) {  // z-index
-        z_index_ = 0;
-        kuikly::util::UpdateNodeZIndex(node_, 0);
-        kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_Z_INDEX);
-        return true;
-    }
-
-    if (strcmp(prop_key.c_str(), kTouchEnable) == 0) {  // 禁用手势
-        kuikly::util::UpdateNodeHitTest(node_, true);
-        kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_ENABLED);
-        return true;
-    }
-    if (strcmp(prop_key.c_str(), kAccessibility) == 0) {  // 无障碍化
-        kuikly::util::UpdateNodeAccessibility(node_, "");
-        kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_ACCESSIBILITY_TEXT);
-        return true;
-    }
-
-    if (strcmp(prop_key.c_str(), kBoxShadow) == 0) {  // 阴影
-        kuikly::util::UpdateNodeBoxShadow(node_, "0 0 0 0");
-        kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_CUSTOM_SHADOW);
+    switch (key_id) {
+        case KRPropKeyId::kBackgroundColor:
+            kuikly::util::UpdateNodeBackgroundColor(node_, 0x00000000);  // 透明
+            kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_BACKGROUND_COLOR);
+            return true;
+        case KRPropKeyId::kBorderRadius:  // 圆角
+            kuikly::util::UpdateNodeBorderRadius(node_, KRBorderRadiuses());
+            kuikly::util::UpdateNodeOverflow(node_, 0);
+            kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_CLIP);
+            kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_BORDER_RADIUS);
+            return true;
+        case KRPropKeyId::kBorder:
+            kuikly::util::UpdateNodeBorder(node_, "0 solid 0");
+            kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_BORDER_WIDTH);
+            kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_BORDER_COLOR);
+            kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_BORDER_STYLE);
+            return true;
+        case KRPropKeyId::kFrame: {
+            KRRect frame;
+            kuikly::util::UpdateNodeFrame(node_, frame);
+            frame_ = frame;
+            return true;
+        }
+        case KRPropKeyId::kBackgroundImage:
+            kuikly::util::UpdateNodeBackgroundImage(node_, "8,0 0,0 1");  // 重置为不渐变，且透明
+            kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_LINEAR_GRADIENT);
+            return true;
+        case KRPropKeyId::kTransform:
+            ResetTransformIfNeed();
+            css_transform_ = "";
+            kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_TRANSFORM_CENTER);
+            kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_TRANSFORM);
+            kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_ROTATE);
+            return true;
+        case KRPropKeyId::kOpacity:
+            kuikly::util::UpdateNodeOpacity(node_, 1);
+            kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_OPACITY);
+            return true;
+        case KRPropKeyId::kVisibility:
+            kuikly::util::UpdateNodeVisibility(node_, 1);
+            kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_VISIBILITY);
+            return true;
+        case KRPropKeyId::kOverflow:  // 裁剪子孩子
+            kuikly::util::UpdateNodeOverflow(node_, 0);
+            css_overflow_ = 0;
+            kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_CLIP);
+            return true;
+        case KRPropKeyId::kZIndex:  // z-index
+            z_index_ = 0;
+            kuikly::util::UpdateNodeZIndex(node_, 0);
+            kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_Z_INDEX);
+            return true;
+        case KRPropKeyId::kTouchEnable:  // 禁用手势
+            kuikly::util::UpdateNodeHitTest(node_, true);
+            kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_ENABLED);
+            return true;
+        case KRPropKeyId::kAccessibility:  // 无障碍化
+            kuikly::util::UpdateNodeAccessibility(node_, "");
+            kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_ACCESSIBILITY_TEXT);
+            return true;
+        case KRPropKeyId::kBoxShadow:  // 阴影
+            kuikly::util::UpdateNodeBoxShadow(node_, "0 0 0 0");
+            kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_CUSTOM_SHADOW);
+            return false;
+        case KRPropKeyId::kAnimation:
+            kuikly::util::SetNodeAnimation(weakView_, nullptr);
+            return true;
+        default:
+            return false;
     }
+}
 
-    if (strcmp(prop_key.c_str(), KAnimation) == 0) {
-        kuikly::util::SetNodeAnimation(weakView_, nullptr);
-        return true;
+void KRBasePropsHandler::UpdateFrame(const KRRect &frame) {
+    ResetTransformIfNeed();
+    kuikly::util::UpdateNodeFrame(node_, frame);
+    frame_ = frame;
+    if (css_transform_.length()) {
+        UpdateTransform(css_transform_);
     }
-
-    return false;
 }
 
 void KRBasePropsHandler::ResetTransformIfNeed() {
@@ -21,6 +21,7 @@
 #include <string>
 #include "libohos_render/expand/components/base/animation/IKRNodeAnimation.h"
 #include "libohos_render/foundation/KRCommon.h"
+#include "libohos_render/foundation/KRPropKey.h"
 #include "libohos_render/foundation/KRRect.h"
 #include "libohos_render/view/IKRRenderView.h"
 
@@ -35,10 +36,19 @@ class KRBasePropsHandler : public std::enable_shared_from_this<KRBasePropsHandle
     }
 
     bool SetProp(const std::string &prop_key, const KRAnyValue &prop_value, const KRRenderCallback event_call_back);
+    // key_id 为 prop_key 预先查好的ID，避免重复查找
+    bool SetProp(KRPropKeyId key_id, const std::string &prop_key, const KRAnyValue &prop_value,
+                 const KRRenderCallback event_call_back);
     bool SetPropWithoutAnimation(const std::string &prop_key, const KRAnyValue &prop_value,
                                  const KRRenderCallback event_call_back);
+    bool SetPropWithoutAnimation(KRPropKeyId key_id, const KRAnyValue &prop_value,
+                                 const KRRenderCallback event_call_back);
+
+    // 直接设置frame，不经过属性字符串分发
+    bool SetFrame(const KRRect &frame);
 
     bool ResetProp(const std::string &prop_key);
+    bool ResetProp(KRPropKeyId key_id);
 
     void OnDestroy();
 
@@ -73,6 +83,7 @@ class KRBasePropsHandler : public std::enable_shared_from_this<KRBasePropsHandle
     }
 
  private:
+    void UpdateFrame(const KRRect &frame);
     void ResetTransformIfNeed();
     void UpdateTransform(const std::string &css_transform);
 
@@ -25,6 +25,8 @@
 #include <native_drawing/drawing_shader_effect.h>
 #include <native_drawing/drawing_types.h>
 
+#include <algorithm>
+
 #include "libohos_render/utils/KRColor.h"
 #include "libohos_render/utils/KRJSONObject.h"
 
@@ -55,7 +57,8 @@ KRCanvasView::KRCanvasView()
     : KRView(), cachable_methods_({LINE_CAP, LINE_WIDTH, LINE_DASH, STROKE_STYLE, FILL_STYLE, BEGIN_PATH, MOVE_TO,
                                    LINE_TO, ARC, CLOSE_PATH, STROKE, FILL, CREATE_LINEAR_GRADIENT, QUADRATIC_CURVE_TO,
                                    TEXT_ALIGN, FONT, FILL_TEXT, STROKE_TEXT}) {
-    // ctor body left blank
+    std::fill(std::begin(pending_state_commands_), std::end(pending_state_commands_), -1);
+    std::fill(std::begin(has_current_state_), std::end(has_current_state_), false);
 }
 void KRCanvasView::DidMoveToParentView() {
     KRView::DidMoveToParentView();
@@ -65,6 +68,9 @@ void KRCanvasView::DidMoveToParentView() {
 void KRCanvasView::DidInit() {
     IKRRenderViewExport::DidInit();
 }
+void KRCanvasView::OnDestroy() {
+    Reset();
+}
 
 bool KRCanvasView::ShouldCacheOp(const std::string &method) {
     return cachable_methods_.find(method) != cachable_methods_.end();
@@ -99,48 +105,6 @@ void KRCanvasView::OnCustomEvent(ArkUI_NodeCustomEvent *event, const ArkUI_NodeC
     }
 }
 
-void KRCanvasView::SetLineCap(const std::string &params) {
-    auto obj = kuikly::util::JSONObject::Parse(params);
-    std::string str = obj->GetString("style");
-    OH_Drawing_PenLineCapStyle style = LINE_FLAT_CAP;
-    if (str == "round") {
-        style = LINE_ROUND_CAP;
-    } else if (str == "square") {
-        style = LINE_SQUARE_CAP;
-    }
-    if (pen_ == nullptr) {
-        pen_ = OH_Drawing_PenCreate();
-    }
-    OH_Drawing_PenSetCap(pen_, style);
-}
-
-void KRCanvasView::SetLineWidth(const std::string &params) {
-    auto obj = kuikly::util::JSONObject::Parse(params);
-    float width = obj->GetNumber("width");
-
-    if (pen_ == nullptr) {
-        pen_ = OH_Drawing_PenCreate();
-    }
-    OH_Drawing_PenSetWidth(pen_, width);
-}
-
-void KRCanvasView::SetLineDash(const std::string &params) {
-    auto obj = kuikly::util::JSONObject::Parse(params);
-    auto intervalsVector = obj->GetNumberArray("intervals");
-    int count = intervalsVector.size();
-    if (pen_ == nullptr) {
-        pen_ = OH_Drawing_PenCreate();
-    }
-    if (count == 0) {
-        OH_Drawing_PenSetPathEffect(pen_, nullptr);
-        return;
-    }
-    std::vector<float> intervals(intervalsVector.begin(), intervalsVector.end());
-    auto pathEffect = OH_Drawing_CreateDashPathEffect(intervals.data(), count, 0);
-    OH_Drawing_PenSetPathEffect(pen_, pathEffect);
-    OH_Drawing_PathEffectDestroy(pathEffect);
-}
-
 void processColorStops(const std::string &colorStopsStr, std::vector<uint32_t> &colors, std::vector<float> &locations) {
     std::vector<std::string> splits = kuikly::util::ConvertSplit(colorStopsStr, ",");
 
@@ -184,176 +148,364 @@ OH_Drawing_ShaderEffect *parseGradientStyle(const std::string &style) {
     return colorShaderEffect;
 }
 
-void KRCanvasView::SetStrokeStyle(const std::string &params) {
-    auto paramObj = kuikly::util::JSONObject::Parse(params);
-    if (paramObj) {
-        const std::string style = paramObj->GetString("style");
-        if (style.substr(0, LINEAR_GRADIENT.size()) == LINEAR_GRADIENT) {
-            OH_Drawing_ShaderEffect *colorShaderEffect = parseGradientStyle(style);
-            if (pen_ == nullptr) {
-                pen_ = OH_Drawing_PenCreate();
-            }
-            OH_Drawing_PenSetShaderEffect(pen_, colorShaderEffect);
-        } else {
-            if (pen_ == nullptr) {
-                pen_ = OH_Drawing_PenCreate();
-            }
-            OH_Drawing_PenSetShaderEffect(pen_, nullptr);
-            OH_Drawing_PenSetColor(pen_, kuikly::util::ConvertToHexColor(style));
-        }
+static bool IsStateCommand(KRCanvasCommandType type) {
+    switch (type) {
+    case KRCanvasCommandType::kLineCap:
+    case KRCanvasCommandType::kLineWidth:
+    case KRCanvasCommandType::kLineDash:
+    case KRCanvasCommandType::kStrokeStyle:
+    case KRCanvasCommandType::kFillStyle:
+    case KRCanvasCommandType::kTextAlign:
+    case KRCanvasCommandType::kFont:
+        return true;
+    default:
+        return false;
     }
 }
-void KRCanvasView::SetFillStyle(const std::string &params) {
-    auto paramObj = kuikly::util::JSONObject::Parse(params);
-    if (paramObj) {
-        const std::string style = paramObj->GetString("style");
-        if (style.substr(0, LINEAR_GRADIENT.size()) == LINEAR_GRADIENT) {
-            OH_Drawing_ShaderEffect *colorShaderEffect = parseGradientStyle(style);
-            if (brush_ == nullptr) {
-                brush_ = OH_Drawing_BrushCreate();
+
+/**
+ * 按 used 标记压缩资源数组，释放未被引用的资源，remap 记录旧下标到新下标的映射（未引用为 -1）
+ */
+template <typename T, typename Release>
+static void CompactResources(std::vector<T> &resources, const std::vector<bool> &used, std::vector<int32_t> &remap,
+                             Release release) {
+    remap.assign(resources.size(), -1);
+    size_t kept = 0;
+    for (size_t i = 0; i < resources.size(); i++) {
+        if (used[i]) {
+            remap[i] = static_cast<int32_t>(kept);
+            if (kept != i) {
+                resources[kept] = std::move(resources[i]);
             }
-            OH_Drawing_BrushSetShaderEffect(brush_, colorShaderEffect);
+            kept++;
         } else {
-            if (brush_ == nullptr) {
-                brush_ = OH_Drawing_BrushCreate();
-            }
-            OH_Drawing_BrushSetShaderEffect(brush_, nullptr);
-            kuikly::graphics::Color color = kuikly::graphics::Color::FromString(style);
-            OH_Drawing_BrushSetColor(brush_, color.value);
+            release(resources[i]);
         }
     }
+    resources.resize(kept);
 }
 
-void KRCanvasView::BeginPath() {
-    if (drawingPath_) {
-        OH_Drawing_PathDestroy(drawingPath_);
+static bool IsSameState(const KRCanvasCommand &lhs, const KRCanvasCommand &rhs) {
+    // 引用资源（渐变、虚线、字体）的状态按资源下标比较，不同下标即视为不同
+    return lhs.type == rhs.type && lhs.index == rhs.index && lhs.value == rhs.value && lhs.args[0] == rhs.args[0] &&
+           lhs.args[1] == rhs.args[1];
+}
+
+void KRCanvasView::PushCommand(const KRCanvasCommand &command) {
+    auto type_index = static_cast<int>(command.type);
+    if (IsStateCommand(command.type)) {
+        // 与当前值相同的状态不改变绘制结果
+        if (has_current_state_[type_index] && IsSameState(current_state_commands_[type_index], command)) {
+            return;
+        }
+        current_state_commands_[type_index] = command;
+        has_current_state_[type_index] = true;
+        // 两次绘制之间重复设置的同类状态只保留最后一次
+        int pending = pending_state_commands_[type_index];
+        if (pending >= 0) {
+            commands_[pending] = command;
+            return;
+        }
+        pending_state_commands_[type_index] = static_cast<int>(commands_.size());
+    } else {
+        std::fill(std::begin(pending_state_commands_), std::end(pending_state_commands_), -1);
     }
-    drawingPath_ = OH_Drawing_PathCreate();
+    commands_.push_back(command);
 }
 
-void KRCanvasView::MoveTo(const std::string &params) {
-    if (drawingPath_ == nullptr) {
+void KRCanvasView::CompactIfNeeded() {
+    // 绘制指令都会影响画面，只在 reset 时整体清空；这里仅回收被状态合并、路径替换后不再引用的资源
+    if (commands_.size() >= kMaxCommandCount && !overflow_logged_) {
+        KR_LOG_ERROR << "KRCanvasView command count exceeds " << kMaxCommandCount << ", consider calling reset";
+        overflow_logged_ = true;
+    }
+    size_t resource_count = paths_.size() + shaders_.size() + path_effects_.size() + fonts_.size() + texts_.size();
+    if (resource_count < next_compact_resource_count_) {
         return;
     }
+    ReleaseUnreferencedResources();
+    // 回收后仍被引用的资源较多时提高阈值，避免每条指令都全量扫描
+    resource_count = paths_.size() + shaders_.size() + path_effects_.size() + fonts_.size() + texts_.size();
+    next_compact_resource_count_ = std::max(kResourceCompactThreshold, resource_count * 2);
+}
+
+void KRCanvasView::ReleaseUnreferencedResources() {
+    std::vector<bool> used_paths(paths_.size());
+    std::vector<bool> used_shaders(shaders_.size());
+    std::vector<bool> used_path_effects(path_effects_.size());
+    std::vector<bool> used_fonts(fonts_.size());
+    std::vector<bool> used_texts(texts_.size());
+    auto resources_of = [&](KRCanvasCommandType type) -> std::vector<bool> * {
+        switch (type) {
+        case KRCanvasCommandType::kStroke:
+        case KRCanvasCommandType::kFill:
+            return &used_paths;
+        case KRCanvasCommandType::kStrokeStyle:
+        case KRCanvasCommandType::kFillStyle:
+            return &used_shaders;
+        case KRCanvasCommandType::kLineDash:
+            return &used_path_effects;
+        case KRCanvasCommandType::kFont:
+            return &used_fonts;
+        case KRCanvasCommandType::kFillText:
+        case KRCanvasCommandType::kStrokeText:
+            return &used_texts;
+        default:
+            return nullptr;
+        }
+    };
+    for (const auto &command : commands_) {
+        auto used = resources_of(command.type);
+        if (used && command.index >= 0) {
+            (*used)[command.index] = true;
+        }
+    }
+    if (current_path_ >= 0) {
+        used_paths[current_path_] = true;  // 当前路径后续仍可能被修改和绘制
+    }
+
+    std::vector<int32_t> path_remap;
+    std::vector<int32_t> shader_remap;
+    std::vector<int32_t> path_effect_remap;
+    std::vector<int32_t> font_remap;
+    std::vector<int32_t> text_remap;
+    CompactResources(paths_, used_paths, path_remap, [](OH_Drawing_Path *path) { OH_Drawing_PathDestroy(path); });
+    CompactResources(shaders_, used_shaders, shader_remap, [](OH_Drawing_ShaderEffect *shader) {
+        if (shader) {
+            OH_Drawing_ShaderEffectDestroy(shader);
+        }
+    });
+    CompactResources(path_effects_, used_path_effects, path_effect_remap,
+                     [](OH_Drawing_PathEffect *path_effect) { OH_Drawing_PathEffectDestroy(path_effect); });
+    CompactResources(fonts_, used_fonts, font_remap, [](TextFeature &) {});
+    CompactResources(texts_, used_texts, text_remap, [](KRCanvasText &text) {
+        if (text.typography) {
+            OH_Drawing_DestroyTypography(text.typography);
+            text.typography = nullptr;
+        }
+    });
+    if (current_path_ >= 0) {
+        current_path_ = path_remap[current_path_];
+    }
+    auto remap_command = [&](KRCanvasCommand &command) {
+        if (command.index < 0) {
+            return;
+        }
+        auto used = resources_of(command.type);
+        if (used == &used_paths) {
+            command.index = path_remap[command.index];
+        } else if (used == &used_shaders) {
+            command.index = shader_remap[command.index];
+        } else if (used == &used_path_effects) {
+            command.index = path_effect_remap[command.index];
+        } else if (used == &used_fonts) {
+            command.index = font_remap[command.index];
+        } else if (used == &used_texts) {
+            command.index = text_remap[command.index];
+        }
+    };
+    for (auto &command : commands_) {
+        remap_command(command);
+    }
+    // 当前状态对应的指令一定仍在 commands_ 中，其资源不会被回收，只需更新下标
+    for (size_t i = 0; i < static_cast<size_t>(KRCanvasCommandType::kCount); i++) {
+        if (has_current_state_[i]) {
+            remap_command(current_state_commands_[i]);
+        }
+    }
+}
+
+void KRCanvasView::CompileLineCap(const std::string &params) {
+    auto obj = kuikly::util::JSONObject::Parse(params);
+    std::string str = obj->GetString("style");
+    OH_Drawing_PenLineCapStyle style = LINE_FLAT_CAP;
+    if (str == "round") {
+        style = LINE_ROUND_CAP;
+    } else if (str == "square") {
+        style = LINE_SQUARE_CAP;
+    }
+    KRCanvasCommand command{KRCanvasCommandType::kLineCap};
+    command.value = style;
+    PushCommand(command);
+}
+
+void KRCanvasView::CompileLineWidth(const std::string &params) {
     auto obj = kuikly::util::JSONObject::Parse(params);
-    float x = obj->GetNumber("x");
-    float y = obj->GetNumber("y");
+    KRCanvasCommand command{KRCanvasCommandType::kLineWidth};
+    command.args[0] = obj->GetNumber("width");
+    PushCommand(command);
+}
 
-    OH_Drawing_PathMoveTo(drawingPath_, x, y);
+void KRCanvasView::CompileLineDash(const std::string &params) {
+    auto obj = kuikly::util::JSONObject::Parse(params);
+    auto intervalsVector = obj->GetNumberArray("intervals");
+    KRCanvasCommand command{KRCanvasCommandType::kLineDash};
+    if (!intervalsVector.empty()) {
+        std::vector<float> intervals(intervalsVector.begin(), intervalsVector.end());
+        command.index = static_cast<int32_t>(path_effects_.size());
+        path_effects_.push_back(OH_Drawing_CreateDashPathEffect(intervals.data(), intervals.size(), 0));
+    }
+    PushCommand(command);
 }
 
-void KRCanvasView::LineTo(const std::string &params) {
-    if (drawingPath_ == nullptr) {
+void KRCanvasView::CompileStyle(KRCanvasCommandType type, const std::string &params) {
+    auto paramObj = kuikly::util::JSONObject::Parse(params);
+    if (paramObj == nullptr) {
         return;
     }
-    auto obj = kuikly::util::JSONObject::Parse(params);
-    float x = obj->GetNumber("x");
-    float y = obj->GetNumber("y");
-    OH_Drawing_PathLineTo(drawingPath_, x, y);
+    const std::string style = paramObj->GetString("style");
+    KRCanvasCommand command{type};
+    if (style.substr(0, LINEAR_GRADIENT.size()) == LINEAR_GRADIENT) {
+        command.index = static_cast<int32_t>(shaders_.size());
+        shaders_.push_back(parseGradientStyle(style));
+    } else if (type == KRCanvasCommandType::kStrokeStyle) {
+        command.value = kuikly::util::ConvertToHexColor(style);
+    } else {
+        command.value = kuikly::graphics::Color::FromString(style).value;
+    }
+    PushCommand(command);
 }
 
-void KRCanvasView::Arc(const std::string &params) {
-    if (drawingPath_ == nullptr) {
+void KRCanvasView::CompileBeginPath() {
+    if (current_path_ >= 0 && !current_path_referenced_) {
+        // 未被绘制指令引用的当前路径直接替换，只 beginPath 不绘制时路径数量不会增长
+        OH_Drawing_PathDestroy(paths_[current_path_]);
+        paths_[current_path_] = OH_Drawing_PathCreate();
         return;
     }
-    auto paramObj = kuikly::util::JSONObject::Parse(params);
-    if (paramObj) {
-        float x = paramObj->GetNumber("x");
-        float y = paramObj->GetNumber("y");
-        float r = paramObj->GetNumber("r");
-        float startAngle = paramObj->GetNumber("sAngle") * 180 / M_PI;
-        float endAngle = paramObj->GetNumber("eAngle") * 180 / M_PI;
-        bool ccw = paramObj->GetNumber("counterclockwise") == TYPE_COUNTER_CLOCKWISE;
-        float sweepAngle = endAngle - startAngle;
-        if (ccw) {
-            if (sweepAngle > 0) {
-                sweepAngle = std::fmod(sweepAngle, 360) - 360;
-            }
-        } else {
-            if (sweepAngle < 0) {
-                sweepAngle = std::fmod(sweepAngle, 360) + 360;
-            }
-        }
-        if (std::fabs(sweepAngle) < 360) {
-            OH_Drawing_PathArcTo(drawingPath_, x - r, y - r, x + r, y + r, startAngle, sweepAngle);
-        } else {
-            // TODO(userName):
-        }
+    current_path_ = static_cast<int>(paths_.size());
+    current_path_referenced_ = false;
+    paths_.push_back(OH_Drawing_PathCreate());
+}
+
+OH_Drawing_Path *KRCanvasView::MutableCurrentPath() {
+    if (current_path_ < 0) {
+        return nullptr;
+    }
+    if (current_path_referenced_) {
+        // 已被绘制指令引用的路径保持不变，后续修改作用在副本上
+        paths_.push_back(OH_Drawing_PathCopy(paths_[current_path_]));
+        current_path_ = static_cast<int>(paths_.size()) - 1;
+        current_path_referenced_ = false;
     }
+    return paths_[current_path_];
 }
 
-void KRCanvasView::ClosePath() {
-    if (drawingPath_) {
-        OH_Drawing_PathClose(drawingPath_);
+void KRCanvasView::CompileMoveTo(const std::string &params) {
+    auto path = MutableCurrentPath();
+    if (path == nullptr) {
+        return;
     }
+    auto obj = kuikly::util::JSONObject::Parse(params);
+    OH_Drawing_PathMoveTo(path, obj->GetNumber("x"), obj->GetNumber("y"));
 }
 
-void KRCanvasView::Stroke() {
-    if (canvas_ && drawingPath_) {
-        if (pen_) {
-            OH_Drawing_CanvasAttachPen(canvas_, pen_);
-        }
-        OH_Drawing_CanvasDrawPath(canvas_, drawingPath_);
-        if (pen_) {
-            OH_Drawing_CanvasDetachPen(canvas_);
-        }
+void KRCanvasView::CompileLineTo(const std::string &params) {
+    auto path = MutableCurrentPath();
+    if (path == nullptr) {
+        return;
     }
+    auto obj = kuikly::util::JSONObject::Parse(params);
+    OH_Drawing_PathLineTo(path, obj->GetNumber("x"), obj->GetNumber("y"));
 }
 
-void KRCanvasView::Fill() {
-    if (canvas_ && drawingPath_) {
-        if (brush_) {
-            OH_Drawing_CanvasAttachBrush(canvas_, brush_);
+void KRCanvasView::CompileArc(const std::string &params) {
+    auto paramObj = kuikly::util::JSONObject::Parse(params);
+    if (paramObj == nullptr) {
+        return;
+    }
+    auto path = MutableCurrentPath();
+    if (path == nullptr) {
+        return;
+    }
+    float x = paramObj->GetNumber("x");
+    float y = paramObj->GetNumber("y");
+    float r = paramObj->GetNumber("r");
+    float startAngle = paramObj->GetNumber("sAngle") * 180 / M_PI;
+    float endAngle = paramObj->GetNumber("eAngle") * 180 / M_PI;
+    bool ccw = paramObj->GetNumber("counterclockwise") == TYPE_COUNTER_CLOCKWISE;
+    float sweepAngle = endAngle - startAngle;
+    if (ccw) {
+        if (sweepAngle > 0) {
+            sweepAngle = std::fmod(sweepAngle, 360) - 360;
         }
-        OH_Drawing_CanvasDrawPath(canvas_, drawingPath_);
-        if (brush_) {
-            OH_Drawing_CanvasDetachBrush(canvas_);
+    } else {
+        if (sweepAngle < 0) {
+            sweepAngle = std::fmod(sweepAngle, 360) + 360;
         }
     }
+    if (std::fabs(sweepAngle) < 360) {
+        OH_Drawing_PathArcTo(path, x - r, y - r, x + r, y + r, startAngle, sweepAngle);
+    } else {
+        // TODO(userName):
+    }
+}
+
+void KRCanvasView::CompileClosePath() {
+    if (auto path = MutableCurrentPath()) {
+        OH_Drawing_PathClose(path);
+    }
 }
 
-void KRCanvasView::SetTextAlign(const std::string &params) {
+void KRCanvasView::CompileDrawPath(KRCanvasCommandType type) {
+    if (current_path_ < 0) {
+        return;
+    }
+    KRCanvasCommand command{type};
+    command.index = current_path_;
+    current_path_referenced_ = true;
+    PushCommand(command);
+}
+
+void KRCanvasView::CompileTextAlign(const std::string &params) {
+    KRCanvasCommand command{KRCanvasCommandType::kTextAlign};
     if (params == "left") {
-        text_feature_.textAlign = TEXT_ALIGN_LEFT;
+        command.value = TEXT_ALIGN_LEFT;
     } else if (params == "center") {
-        text_feature_.textAlign = TEXT_ALIGN_CENTER;
+        command.value = TEXT_ALIGN_CENTER;
     } else if (params == "right") {
-        text_feature_.textAlign = TEXT_ALIGN_RIGHT;
+        command.value = TEXT_ALIGN_RIGHT;
+    } else {
+        return;
     }
+    PushCommand(command);
 }
 
-void KRCanvasView::SetFont(const std::string &params) {
+void KRCanvasView::CompileFont(const std::string &params) {
     auto paramObj = kuikly::util::JSONObject::Parse(params);
-    auto size = paramObj->GetNumber("size");
-    auto style = paramObj->GetString("style");
-    auto weight = std::stoi(paramObj->GetString("weight"));
-    auto family = paramObj->GetString("family");
-
-    text_feature_.fontSize = size;
-    text_feature_.fontStyle = kuikly::util::ConvertToFontStyle(style);
-    text_feature_.fontWeight = kuikly::util::ConvertFontWeight(weight);
-    text_feature_.fontFamily = family;
-}
-
-void KRCanvasView::FillText(const std::string &params) {
-    if (canvas_) {
-        std::shared_ptr<struct KRFontCollectionWrapper> font_collection_wrapper =
-            std::make_shared<KRFontCollectionWrapper>();
-        DrawText(params, font_collection_wrapper, FILL_TEXT);
+    TextFeature feature;
+    feature.fontSize = paramObj->GetNumber("size");
+    feature.fontStyle = kuikly::util::ConvertToFontStyle(paramObj->GetString("style"));
+    feature.fontWeight = kuikly::util::ConvertFontWeight(std::stoi(paramObj->GetString("weight")));
+    feature.fontFamily = paramObj->GetString("family");
+    constexpr auto kFontIndex = static_cast<int>(KRCanvasCommandType::kFont);
+    if (has_current_state_[kFontIndex] && current_state_commands_[kFontIndex].index >= 0) {
+        // 与当前字体相同时不再新增字体资源
+        const auto &current = fonts_[current_state_commands_[kFontIndex].index];
+        if (current.fontSize == feature.fontSize && current.fontStyle == feature.fontStyle &&
+            current.fontWeight == feature.fontWeight && current.fontFamily == feature.fontFamily) {
+            return;
+        }
     }
+    KRCanvasCommand command{KRCanvasCommandType::kFont};
+    command.index = static_cast<int32_t>(fonts_.size());
+    fonts_.push_back(std::move(feature));
+    PushCommand(command);
 }
 
-void KRCanvasView::StrokeText(const std::string &params) {
-    if (canvas_) {
-        std::shared_ptr<struct KRFontCollectionWrapper> font_collection_wrapper =
-            std::make_shared<KRFontCollectionWrapper>();
-        DrawText(params, font_collection_wrapper, STROKE_TEXT);
-    }
+void KRCanvasView::CompileText(KRCanvasCommandType type, const std::string &params) {
+    auto paramObj = kuikly::util::JSONObject::Parse(params);
+    KRCanvasCommand command{type};
+    command.index = static_cast<int32_t>(texts_.size());
+    command.args[0] = paramObj->GetNumber("x");
+    command.args[1] = paramObj->GetNumber("y");
+    KRCanvasText text;
+    text.text = paramObj->GetString("text");
+    texts_.push_back(std::move(text));
+    PushCommand(command);
 }
 
-void KRCanvasView::DrawText(std::string params, std::shared_ptr<struct KRFontCollectionWrapper> wrapper,
-                            std::string_view type) {
-    OH_Drawing_TextStyle *txtStyle = OH_Drawing_CreateTextStyle();
+void KRCanvasView::DrawText(KRCanvasText &text, float x, float y, KRCanvasCommandType type) {
     // 设置文字大小、字重等属性
     float fontSizeScale = 1;
     auto rootView = GetRootView().lock();
@@ -363,60 +515,68 @@ void KRCanvasView::DrawText(std::string params, std::shared_ptr<struct KRFontCol
     if (auto context = rootView->GetContext()) {
         fontSizeScale = context->Config()->GetFontSizeScale();
     }
-    // 这里fontSize不用 * dpi 因为画布已经整体缩放
-    double fontSize = text_feature_.fontSize * fontSizeScale;
-    OH_Drawing_SetTextStyleFontSize(txtStyle, fontSize);
-    OH_Drawing_SetTextStyleFontWeight(txtStyle, text_feature_.fontWeight);
-    OH_Drawing_SetTextStyleBaseLine(txtStyle, TEXT_BASELINE_ALPHABETIC);
-    OH_Drawing_SetTextStyleFontHeight(txtStyle, 1);
-    OH_Drawing_SetTextStyleFontStyle(txtStyle, text_feature_.fontStyle);
-    OH_Drawing_SetTextStyleLocale(txtStyle, "en");
-
-    // 自定义字体
-    auto fontAdapters = KRFontAdapterManager::GetInstance()->AllAdapters();
-    if (!text_feature_.fontFamily.empty()) {
-        const char *fontFamilyPtr = text_feature_.fontFamily.c_str();
-        const char *fontFamilies[] = {fontFamilyPtr};
-        OH_Drawing_SetTextStyleFontFamilies(txtStyle, 1, fontFamilies);
-        auto nativeResMgr = rootView->GetNativeResourceManager();
-        SetCustomFontIfApplicable(nativeResMgr, wrapper, text_feature_.fontFamily, fontAdapters);
-    }
-
-    OH_Drawing_TypographyStyle *typoStyle = OH_Drawing_CreateTypographyStyle();
-    OH_Drawing_SetTypographyTextDirection(typoStyle, TEXT_DIRECTION_LTR);
-    // 使用左对齐
-    OH_Drawing_SetTypographyTextAlign(typoStyle, TEXT_ALIGN_LEFT);
-
-    if (type == FILL_TEXT) {
-        if (brush_ == nullptr) {
-            brush_ = OH_Drawing_BrushCreate();
+    if (text.typography != nullptr && text.font_size_scale != fontSizeScale) {
+        OH_Drawing_DestroyTypography(text.typography);
+        text.typography = nullptr;
+    }
+    if (text.typography == nullptr) {
+        // 指令回放前绘制状态会被重置，同一条指令每次回放时的画笔与字体一致，排版结果可复用
+        auto wrapper = KRFontCollectionWrapper::Shared();
+        OH_Drawing_TextStyle *txtStyle = OH_Drawing_CreateTextStyle();
+        // 这里fontSize不用 * dpi 因为画布已经整体缩放
+        double fontSize = text_feature_.fontSize * fontSizeScale;
+        OH_Drawing_SetTextStyleFontSize(txtStyle, fontSize);
+        OH_Drawing_SetTextStyleFontWeight(txtStyle, text_feature_.fontWeight);
+        OH_Drawing_SetTextStyleBaseLine(txtStyle, TEXT_BASELINE_ALPHABETIC);
+        OH_Drawing_SetTextStyleFontHeight(txtStyle, 1);
+        OH_Drawing_SetTextStyleFontStyle(txtStyle, text_feature_.fontStyle);
+        OH_Drawing_SetTextStyleLocale(txtStyle, "en");
+
+        // 自定义字体
+        if (!text_feature_.fontFamily.empty()) {
+            const char *fontFamilyPtr = text_feature_.fontFamily.c_str();
+            const char *fontFamilies[] = {fontFamilyPtr};
+            OH_Drawing_SetTextStyleFontFamilies(txtStyle, 1, fontFamilies);
+            auto nativeResMgr = rootView->GetNativeResourceManager();
+            SetCustomFontIfApplicable(nativeResMgr, wrapper, text_feature_.fontFamily);
         }
-        OH_Drawing_SetTextStyleForegroundBrush(txtStyle, brush_);
-    } else if (type == STROKE_TEXT) {
-        if (pen_ == nullptr) {
-            pen_ = OH_Drawing_PenCreate();
+
+        OH_Drawing_TypographyStyle *typoStyle = OH_Drawing_CreateTypographyStyle();
+        OH_Drawing_SetTypographyTextDirection(typoStyle, TEXT_DIRECTION_LTR);
+        // 使用左对齐
+        OH_Drawing_SetTypographyTextAlign(typoStyle, TEXT_ALIGN_LEFT);
+
+        if (type == KRCanvasCommandType::kFillText) {
+            if (brush_ == nullptr) {
+                brush_ = OH_Drawing_BrushCreate();
+            }
+            OH_Drawing_SetTextStyleForegroundBrush(txtStyle, brush_);
+        } else {
+            if (pen_ == nullptr) {
+                pen_ = OH_Drawing_PenCreate();
+            }
+            OH_Drawing_SetTextStyleForegroundPen(txtStyle, pen_);
         }
-        OH_Drawing_SetTextStyleForegroundPen(txtStyle, pen_);
-    }
 
-    auto paramObj = kuikly::util::JSONObject::Parse(params);
-    auto text = paramObj->GetString("text");
-    auto x = paramObj->GetNumber("x");
-    auto y = paramObj->GetNumber("y");
-
-    OH_Drawing_TypographyCreate *handler = OH_Drawing_CreateTypographyHandler(typoStyle, wrapper->fontCollection);
-    OH_Drawing_TypographyHandlerPushTextStyle(handler, txtStyle);
-    // 设置文字内容
-    OH_Drawing_TypographyHandlerAddText(handler, text.c_str());
-    OH_Drawing_TypographyHandlerPopTextStyle(handler);
-    OH_Drawing_Typography *typography = OH_Drawing_CreateTypography(handler);
-    // 设置页面最大宽度
-    auto default_width = 10000000;  // 无限宽
-    double maxWidth = default_width;
-    OH_Drawing_TypographyLayout(typography, maxWidth);
-
-    auto textWidth = OH_Drawing_TypographyGetLongestLine(typography);
-    auto baseLineHeight = OH_Drawing_TypographyGetAlphabeticBaseline(typography);
+        OH_Drawing_TypographyCreate *handler =
+            OH_Drawing_CreateTypographyHandler(typoStyle, wrapper->fontCollection);
+        OH_Drawing_TypographyHandlerPushTextStyle(handler, txtStyle);
+        // 设置文字内容
+        OH_Drawing_TypographyHandlerAddText(handler, text.text.c_str());
+        OH_Drawing_TypographyHandlerPopTextStyle(handler);
+        text.typography = OH_Drawing_CreateTypography(handler);
+        text.font_size_scale = fontSizeScale;
+        // 设置页面最大宽度
+        auto default_width = 10000000;  // 无限宽
+        double maxWidth = default_width;
+        OH_Drawing_TypographyLayout(text.typography, maxWidth);
+        OH_Drawing_DestroyTypographyHandler(handler);
+        OH_Drawing_DestroyTypographyStyle(typoStyle);
+        OH_Drawing_DestroyTextStyle(txtStyle);
+    }
+
+    auto textWidth = OH_Drawing_TypographyGetLongestLine(text.typography);
+    auto baseLineHeight = OH_Drawing_TypographyGetAlphabeticBaseline(text.typography);
     // 根据对齐方式计算实际位置
     double left = 0;
     if (text_feature_.textAlign == TEXT_ALIGN_CENTER) {
@@ -427,33 +587,11 @@ void KRCanvasView::DrawText(std::string params, std::shared_ptr<struct KRFontCol
         left = 0;
     }
 
-    x -= left;
     // 修改y为baseLine在屏幕上的位置
-    y -= baseLineHeight;
-
-    double position[2] = {x, y};
-    OH_Drawing_TypographyPaint(typography, canvas_, position[0], position[1]);
-    // 释放变量
-    OH_Drawing_DestroyTypography(typography);
-    OH_Drawing_DestroyTypographyHandler(handler);
-    OH_Drawing_DestroyTypographyStyle(typoStyle);
-    OH_Drawing_DestroyTextStyle(txtStyle);
+    OH_Drawing_TypographyPaint(text.typography, canvas_, x - left, y - baseLineHeight);
 }
 
-void KRCanvasView::QuadraticCurveTo(const std::string &params) {
-    // TODO(userName):
-}
-void KRCanvasView::BezierCurveTo(const std::string &params) {
-    // TODO(userName):
-}
-
-void KRCanvasView::Reset() {
-    ops_.clear();
-
-    if (drawingPath_) {
-        OH_Drawing_PathDestroy(drawingPath_);
-        drawingPath_ = nullptr;
-    }
+void KRCanvasView::ResetDrawState() {
     if (pen_) {
         OH_Drawing_PenDestroy(pen_);
         pen_ = nullptr;
@@ -462,10 +600,78 @@ void KRCanvasView::Reset() {
         OH_Drawing_BrushDestroy(brush_);
         brush_ = nullptr;
     }
+    text_feature_ = TextFeature();
+}
+
+void KRCanvasView::Reset() {
+    ResetDrawState();
+    commands_.clear();
+    for (auto path : paths_) {
+        OH_Drawing_PathDestroy(path);
+    }
+    paths_.clear();
+    for (auto shader : shaders_) {
+        if (shader) {
+            OH_Drawing_ShaderEffectDestroy(shader);
+        }
+    }
+    shaders_.clear();
+    for (auto path_effect : path_effects_) {
+        OH_Drawing_PathEffectDestroy(path_effect);
+    }
+    path_effects_.clear();
+    for (auto &text : texts_) {
+        if (text.typography) {
+            OH_Drawing_DestroyTypography(text.typography);
+        }
+    }
+    texts_.clear();
+    fonts_.clear();
+    current_path_ = -1;
+    current_path_referenced_ = false;
+    std::fill(std::begin(pending_state_commands_), std::end(pending_state_commands_), -1);
+    std::fill(std::begin(has_current_state_), std::end(has_current_state_), false);
+    next_compact_resource_count_ = kResourceCompactThreshold;
+    overflow_logged_ = false;
 }
 
 void KRCanvasView::AddOp(const std::string &method, const KRAnyValue &params) {
-    ops_.push_back(std::pair{method, params->toString()});
+    CompactIfNeeded();
+    const std::string &str = params->toString();
+    if (method == LINE_CAP) {
+        CompileLineCap(str);
+    } else if (method == LINE_WIDTH) {
+        CompileLineWidth(str);
+    } else if (method == LINE_DASH) {
+        CompileLineDash(str);
+    } else if (method == STROKE_STYLE) {
+        CompileStyle(KRCanvasCommandType::kStrokeStyle, str);
+    } else if (method == FILL_STYLE) {
+        CompileStyle(KRCanvasCommandType::kFillStyle, str);
+    } else if (method == BEGIN_PATH) {
+        CompileBeginPath();
+    } else if (method == MOVE_TO) {
+        CompileMoveTo(str);
+    } else if (method == LINE_TO) {
+        CompileLineTo(str);
+    } else if (method == ARC) {
+        CompileArc(str);
+    } else if (method == CLOSE_PATH) {
+        CompileClosePath();
+    } else if (method == STROKE) {
+        CompileDrawPath(KRCanvasCommandType::kStroke);
+    } else if (method == FILL) {
+        CompileDrawPath(KRCanvasCommandType::kFill);
+    } else if (method == TEXT_ALIGN) {
+        CompileTextAlign(str);
+    } else if (method == FONT) {
+        CompileFont(str);
+    } else if (method == FILL_TEXT) {
+        CompileText(KRCanvasCommandType::kFillText, str);
+    } else if (method == STROKE_TEXT) {
+        CompileText(KRCanvasCommandType::kStrokeText, str);
+    }
+    // createLinearGradient、quadraticCurveTo 暂未实现
 }
 
 void KRCanvasView::OnDraw(ArkUI_NodeCustomEvent *event) {
@@ -486,47 +692,82 @@ void KRCanvasView::OnDraw(ArkUI_NodeCustomEvent *event) {
     OH_Drawing_CanvasClipRect(canvas_, rect, OH_Drawing_CanvasClipOp::INTERSECT, true);
     OH_Drawing_RectDestroy(rect);
 
-    std::for_each(ops_.begin(), ops_.end(), [this](auto item) {
-        const std::string &method = item.first;
-        const std::string &params = item.second;
-        if (method == LINE_CAP) {
-            SetLineCap(params);
-        } else if (method == LINE_WIDTH) {
-            SetLineWidth(params);
-        } else if (method == LINE_DASH) {
-            SetLineDash(params);
-        } else if (method == STROKE_STYLE) {
-            SetStrokeStyle(params);
-        } else if (method == FILL_STYLE) {
-            SetFillStyle(params);
-        } else if (method == BEGIN_PATH) {
-            BeginPath();
-        } else if (method == MOVE_TO) {
-            MoveTo(params);
-        } else if (method == LINE_TO) {
-            LineTo(params);
-        } else if (method == ARC) {
-            Arc(params);
-        } else if (method == CLOSE_PATH) {
-            ClosePath();
-        } else if (method == STROKE) {
-            Stroke();
-        } else if (method == FILL) {
-            Fill();
-        } else if (method == CREATE_LINEAR_GRADIENT) {
-            //
-        } else if (method == QUADRATIC_CURVE_TO) {
-            QuadraticCurveTo(params);
-        } else if (method == TEXT_ALIGN) {
-            SetTextAlign(params);
-        } else if (method == FONT) {
-            SetFont(params);
-        } else if (method == FILL_TEXT) {
-            FillText(params);
-        } else if (method == STROKE_TEXT) {
-            StrokeText(params);
-        } else if (method == RESET) {
-            Reset();
+    ResetDrawState();
+    for (const auto &command : commands_) {
+        switch (command.type) {
+        case KRCanvasCommandType::kLineCap:
+            if (pen_ == nullptr) {
+                pen_ = OH_Drawing_PenCreate();
+            }
+            OH_Drawing_PenSetCap(pen_, static_cast<OH_Drawing_PenLineCapStyle>(command.value));
+            break;
+        case KRCanvasCommandType::kLineWidth:
+            if (pen_ == nullptr) {
+                pen_ = OH_Drawing_PenCreate();
+            }
+            OH_Drawing_PenSetWidth(pen_, command.args[0]);
+            break;
+        case KRCanvasCommandType::kLineDash:
+            if (pen_ == nullptr) {
+                pen_ = OH_Drawing_PenCreate();
+            }
+            OH_Drawing_PenSetPathEffect(pen_, command.index >= 0 ? path_effects_[command.index] : nullptr);
+            break;
+        case KRCanvasCommandType::kStrokeStyle:
+            if (pen_ == nullptr) {
+                pen_ = OH_Drawing_PenCreate();
+            }
+            if (command.index >= 0) {
+                OH_Drawing_PenSetShaderEffect(pen_, shaders_[command.index]);
+            } else {
+                OH_Drawing_PenSetShaderEffect(pen_, nullptr);
+                OH_Drawing_PenSetColor(pen_, command.value);
+            }
+            break;
+        case KRCanvasCommandType::kFillStyle:
+            if (brush_ == nullptr) {
+                brush_ = OH_Drawing_BrushCreate();
+            }
+            if (command.index >= 0) {
+                OH_Drawing_BrushSetShaderEffect(brush_, shaders_[command.index]);
+            } else {
+                OH_Drawing_BrushSetShaderEffect(brush_, nullptr);
+                OH_Drawing_BrushSetColor(brush_, command.value);
+            }
+            break;
+        case KRCanvasCommandType::kStroke:
+            if (pen_) {
+                OH_Drawing_CanvasAttachPen(canvas_, pen_);
+            }
+            OH_Drawing_CanvasDrawPath(canvas_, paths_[command.index]);
+            if (pen_) {
+                OH_Drawing_CanvasDetachPen(canvas_);
+            }
+            break;
+        case KRCanvasCommandType::kFill:
+            if (brush_) {
+                OH_Drawing_CanvasAttachBrush(canvas_, brush_);
+            }
+            OH_Drawing_CanvasDrawPath(canvas_, paths_[command.index]);
+            if (brush_) {
+                OH_Drawing_CanvasDetachBrush(canvas_);
+            }
+            break;
+        case KRCanvasCommandType::kTextAlign:
+            text_feature_.textAlign = static_cast<OH_Drawing_TextAlign>(command.value);
+            break;
+        case KRCanvasCommandType::kFont: {
+            auto align = text_feature_.textAlign;
+            text_feature_ = fonts_[command.index];
+            text_feature_.textAlign = align;
+            break;
         }
-    });
+        case KRCanvasCommandType::kFillText:
+        case KRCanvasCommandType::kStrokeText:
+            DrawText(texts_[command.index], command.args[0], command.args[1], command.type);
+            break;
+        default:
+            break;
+        }
+    }
 }
@@ -16,7 +16,9 @@
 #ifndef CORE_RENDER_OHOS_KRCANVASVIEW_H
 #define CORE_RENDER_OHOS_KRCANVASVIEW_H
 
+#include <cstdint>
 #include <unordered_set>
+#include <vector>
 
 #include "libohos_render/expand/components/richtext/KRRichTextShadow.h"
 #include "libohos_render/expand/components/view/KRView.h"
@@ -31,6 +33,37 @@ class TextFeature {
     OH_Drawing_FontWeight fontWeight = FONT_WEIGHT_400;
 };
 
+/**
+ * 编译后的画布指令，参数在 AddOp 时解析完毕，绘制时直接回放
+ */
+enum class KRCanvasCommandType : uint8_t {
+    kLineCap,
+    kLineWidth,
+    kLineDash,
+    kStrokeStyle,
+    kFillStyle,
+    kStroke,
+    kFill,
+    kTextAlign,
+    kFont,
+    kFillText,
+    kStrokeText,
+    kCount,
+};
+
+struct KRCanvasCommand {
+    KRCanvasCommandType type;
+    int32_t index = -1;  // 资源下标：路径 / 着色器 / 虚线 / 字体 / 文本，-1 表示无
+    uint32_t value = 0;  // 颜色或枚举值
+    float args[2] = {0, 0};
+};
+
+struct KRCanvasText {
+    std::string text;
+    OH_Drawing_Typography *typography = nullptr;  // 首次绘制时构建，reset 前复用
+    float font_size_scale = 0;
+};
+
 class KRCanvasView : public KRView {
  public:
     static constexpr std::string_view Name = "KRCanvasView";
@@ -46,28 +79,29 @@ class KRCanvasView : public KRView {
 
     void DidInit() override;
     void DidMoveToParentView() override;
+    void OnDestroy() override;
 
  private:
-    void SetLineCap(const std::string &params);
-    void SetLineWidth(const std::string &params);
-    void SetLineDash(const std::string &params);
-    void SetStrokeStyle(const std::string &params);
-    void SetFillStyle(const std::string &params);
-    void BeginPath();
-    void MoveTo(const std::string &params);
-    void LineTo(const std::string &params);
-    void Arc(const std::string &params);
-    void ClosePath();
-    void Stroke();
-    void Fill();
-    void FillText(const std::string &params);
-    void StrokeText(const std::string &params);
-    void SetTextAlign(const std::string &params);
-    void SetFont(const std::string &params);
-    void QuadraticCurveTo(const std::string &params);
-    void BezierCurveTo(const std::string &params);
+    void CompileLineCap(const std::string &params);
+    void CompileLineWidth(const std::string &params);
+    void CompileLineDash(const std::string &params);
+    void CompileStyle(KRCanvasCommandType type, const std::string &params);
+    void CompileBeginPath();
+    void CompileMoveTo(const std::string &params);
+    void CompileLineTo(const std::string &params);
+    void CompileArc(const std::string &params);
+    void CompileClosePath();
+    void CompileDrawPath(KRCanvasCommandType type);
+    void CompileTextAlign(const std::string &params);
+    void CompileFont(const std::string &params);
+    void CompileText(KRCanvasCommandType type, const std::string &params);
+    void PushCommand(const KRCanvasCommand &command);
+    void CompactIfNeeded();
+    void ReleaseUnreferencedResources();
+    OH_Drawing_Path *MutableCurrentPath();
     void Reset();
-    void DrawText(std::string params, std::shared_ptr<struct KRFontCollectionWrapper> wrapper, std::string_view type);
+    void ResetDrawState();
+    void DrawText(KRCanvasText &text, float x, float y, KRCanvasCommandType type);
 
     void AddOp(const std::string &method, const KRAnyValue &params);
     void OnDraw(ArkUI_NodeCustomEvent *event);
@@ -76,13 +110,30 @@ class KRCanvasView : public KRView {
     bool MarkDirtyIfNeeded(const std::string &method);
 
  private:
+    static constexpr size_t kMaxCommandCount = 100000;  // 超出时打印告警，绘制指令不会被丢弃
+    static constexpr size_t kResourceCompactThreshold = 2 * kMaxCommandCount;  // 资源数达到该值时回收未引用资源
+
     OH_Drawing_Canvas *canvas_ = nullptr;
-    OH_Drawing_Path *drawingPath_ = nullptr;
     OH_Drawing_Brush *brush_ = nullptr;
     OH_Drawing_Pen *pen_ = nullptr;
-    std::vector<std::pair<std::string, std::string>> ops_;
     std::unordered_set<std::string_view> cachable_methods_;
     TextFeature text_feature_;
+
+    std::vector<KRCanvasCommand> commands_;
+    std::vector<OH_Drawing_Path *> paths_;
+    std::vector<OH_Drawing_ShaderEffect *> shaders_;
+    std::vector<OH_Drawing_PathEffect *> path_effects_;
+    std::vector<TextFeature> fonts_;
+    std::vector<KRCanvasText> texts_;
+    int current_path_ = -1;
+    bool current_path_referenced_ = false;  // 当前路径已被 stroke/fill 引用，再修改需先复制
+    // 上次绘制指令之后各类状态指令在 commands_ 中的位置，用于合并被覆盖的状态
+    int pending_state_commands_[static_cast<int>(KRCanvasCommandType::kCount)];
+    // 各类状态最近一次设置的值，与之相同的状态指令是冗余的，不再记录
+    KRCanvasCommand current_state_commands_[static_cast<int>(KRCanvasCommandType::kCount)];
+    bool has_current_state_[static_cast<int>(KRCanvasCommandType::kCount)];
+    size_t next_compact_resource_count_ = kResourceCompactThreshold;
+    bool overflow_logged_ = false;
 };
 
 #endif  // CORE_RENDER_OHOS_KRCANVASVIEW_H
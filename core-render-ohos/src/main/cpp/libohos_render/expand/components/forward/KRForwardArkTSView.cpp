@@ -37,7 +37,8 @@ bool KRForwardArkTSView::ToSetBaseProp(const std::string &prop_key, const KRAnyV
                                        const KRRenderCallback event_call_back) {
     bool handled = IKRRenderViewExport::ToSetBaseProp(prop_key, prop_value, event_call_back);
     if (handled) {
-        if (prop_key == kBackgroundColor || prop_key == kBackgroundImage) {
+        auto key_id = KRGetPropKeyId(prop_key);
+        if (key_id == KRPropKeyId::kBackgroundColor || key_id == KRPropKeyId::kBackgroundImage) {
             KRArkTSManager::GetInstance().CallArkTSMethod(this->GetInstanceId(), KRNativeCallArkTSMethod::SetViewProp,
                                                           std::make_shared<KRRenderValue>(this->GetViewTag()),
                                                           std::make_shared<KRRenderValue>(prop_key), prop_value,
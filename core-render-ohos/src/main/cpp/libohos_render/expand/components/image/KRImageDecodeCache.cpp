@@ -0,0 +1,215 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 THL A29 Limited, a Tencent company. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/expand/components/image/KRImageDecodeCache.h"
+
+#include <multimedia/image_framework/image/image_source_native.h>
+#include <algorithm>
+#include <cmath>
+#include "libohos_render/foundation/thread/KRGCDQueue.h"
+#include "libohos_render/foundation/thread/KRMainThread.h"
+#include "libohos_render/utils/KRRenderLoger.h"
+
+KRDecodedImage::KRDecodedImage(OH_PixelmapNative *pixelmap, uint32_t width, uint32_t height)
+    : pixelmap_(pixelmap), width_(width), height_(height) {
+    drawable_ = OH_ArkUI_DrawableDescriptor_CreateFromPixelMap(pixelmap_);
+}
+
+KRDecodedImage::~KRDecodedImage() {
+    if (drawable_) {
+        OH_ArkUI_DrawableDescriptor_Dispose(drawable_);
+        drawable_ = nullptr;
+    }
+    if (pixelmap_) {
+        OH_PixelmapNative_Release(pixelmap_);
+        pixelmap_ = nullptr;
+    }
+}
+
+std::string KRImageDecodeRequest::CacheKey() const {
+    return source_id + "@" + std::to_string(target_width) + "x" + std::to_string(target_height);
+}
+
+KRImageDecodeCache &KRImageDecodeCache::GetInstance() {
+    static KRImageDecodeCache instance;
+    return instance;
+}
+
+void KRImageDecodeCache::Fetch(KRImageDecodeRequest request, KRImageDecodeCompletion completion) {
+    auto key = request.CacheKey();
+    std::shared_ptr<KRDecodedImage> cached;
+    bool cacheable = true;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (auto hit = cache_.Get(key)) {
+            if (IsSameSource(hit->source_content, request.source_content)) {
+                cached = hit->image;
+            } else {
+                cacheable = false;
+            }
+        }
+        if (cached == nullptr && cacheable) {
+            auto pending = pending_sources_.find(key);
+            if (pending != pending_sources_.end()) {
+                if (!IsSameSource(pending->second, request.source_content)) {
+                    cacheable = false;
+                } else {
+                    pending_requests_.Add(key, std::move(completion));
+                    return;
+                }
+            } else {
+                pending_requests_.Add(key, std::move(completion));
+                pending_sources_[key] = request.source_content;
+            }
+        }
+    }
+    if (cached) {
+        completion(cached);
+        return;
+    }
+    if (!cacheable) {
+        // key 相同但内容不同，单独解码且不写入缓存
+        KRGCDQueue::GetInstance().DispatchAsync(
+            [request = std::move(request), completion = std::move(completion)] {
+                auto image = Decode(request);
+                KRMainThread::RunOnMainThread([completion, image] { completion(image); });
+            });
+        return;
+    }
+    KRGCDQueue::GetInstance().DispatchAsync([this, key, request = std::move(request)] {
+        auto image = Decode(request);
+        KRMainThread::RunOnMainThread([this, key, image] { DidDecode(key, image); });
+    });
+}
+
+bool KRImageDecodeCache::IsSameSource(const std::shared_ptr<const std::string> &lhs,
+                                      const std::shared_ptr<const std::string> &rhs) {
+    if (lhs == rhs) {
+        return true;
+    }
+    return lhs != nullptr && rhs != nullptr && *lhs == *rhs;
+}
+
+std::shared_ptr<KRDecodedImage> KRImageDecodeCache::Decode(const KRImageDecodeRequest &request) {
+    std::vector<uint8_t> data;
+    if (!request.data_provider || !request.data_provider(data) || data.empty()) {
+        return nullptr;
+    }
+    OH_ImageSourceNative *source = nullptr;
+    Image_ErrorCode err = OH_ImageSourceNative_CreateFromData(data.data(), data.size(), &source);
+    if (err != IMAGE_SUCCESS) {
+        KR_LOG_ERROR << "KRImageDecodeCache create source failed, err:" << err;
+        return nullptr;
+    }
+    uint32_t width = 0;
+    uint32_t height = 0;
+    OH_ImageSource_Info *info = nullptr;
+    OH_ImageSourceInfo_Create(&info);
+    if (OH_ImageSourceNative_GetImageInfo(source, 0, info) == IMAGE_SUCCESS) {
+        OH_ImageSourceInfo_GetWidth(info, &width);
+        OH_ImageSourceInfo_GetHeight(info, &height);
+    }
+    OH_ImageSourceInfo_Release(info);
+
+    OH_DecodingOptions *ops = nullptr;
+    OH_DecodingOptions_Create(&ops);
+    OH_DecodingOptions_SetPixelFormat(ops, PIXEL_FORMAT_RGBA_8888);
+    if (width > 0 && height > 0 && request.target_width > 0 && request.target_height > 0) {
+        // 缩放到刚好覆盖目标尺寸，cover/contain/stretch 均不会因此模糊
+        double scale = std::max(static_cast<double>(request.target_width) / width,
+                                static_cast<double>(request.target_height) / height);
+        if (scale < 1) {
+            width = std::max<uint32_t>(1, static_cast<uint32_t>(std::ceil(width * scale)));
+            height = std::max<uint32_t>(1, static_cast<uint32_t>(std::ceil(height * scale)));
+            Image_Size desired_size = {width, height};
+            OH_DecodingOptions_SetDesiredSize(ops, &desired_size);
+        }
+    }
+    OH_PixelmapNative *pixelmap = nullptr;
+    err = OH_ImageSourceNative_CreatePixelmap(source, ops, &pixelmap);
+    OH_DecodingOptions_Release(ops);
+    OH_ImageSourceNative_Release(source);
+    if (err != IMAGE_SUCCESS || pixelmap == nullptr) {
+        KR_LOG_ERROR << "KRImageDecodeCache decode failed, err:" << err;
+        return nullptr;
+    }
+    // 解码器不一定按 desired size 输出，预算按实际产出的 pixelmap 尺寸计算
+    OH_Pixelmap_ImageInfo *pixelmap_info = nullptr;
+    OH_PixelmapImageInfo_Create(&pixelmap_info);
+    if (OH_PixelmapNative_GetImageInfo(pixelmap, pixelmap_info) == IMAGE_SUCCESS) {
+        OH_PixelmapImageInfo_GetWidth(pixelmap_info, &width);
+        OH_PixelmapImageInfo_GetHeight(pixelmap_info, &height);
+    } else {
+        width = 0;
+        height = 0;
+    }
+    OH_PixelmapImageInfo_Release(pixelmap_info);
+    return std::make_shared<KRDecodedImage>(pixelmap, width, height);
+}
+
+void KRImageDecodeCache::DidDecode(const std::string &key, std::shared_ptr<KRDecodedImage> image) {
+    std::vector<KRImageDecodeCompletion> completions;
+    std::vector<CachedImage> evicted;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        completions = pending_requests_.Take(key);
+        auto source_it = pending_sources_.find(key);
+        std::shared_ptr<const std::string> source_content;
+        if (source_it != pending_sources_.end()) {
+            source_content = std::move(source_it->second);
+            pending_sources_.erase(source_it);
+        }
+        // 尺寸未知（读取图片信息失败）时无法计入预算，不缓存
+        if (image && image->Bytes() > 0) {
+            cache_.Put(key, CachedImage{image, std::move(source_content)}, image->Bytes(), evicted);
+        }
+    }
+    KRReleaseOnSubThread(std::move(evicted));
+    for (const auto &completion : completions) {
+        completion(image);
+    }
+}
+
+void KRImageDecodeCache::SetByteBudget(size_t bytes) {
+    std::vector<CachedImage> evicted;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        cache_.SetByteBudget(bytes, evicted);
+    }
+    KRReleaseOnSubThread(std::move(evicted));
+}
+
+void KRImageDecodeCache::TrimToSize(size_t target_bytes) {
+    std::vector<CachedImage> evicted;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        cache_.Evict(target_bytes, evicted);
+    }
+    KRReleaseOnSubThread(std::move(evicted));
+}
+
+void KRImageDecodeCache::OnMemoryLevel(int level) {
+    std::vector<CachedImage> evicted;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        cache_.OnMemoryLevel(level, evicted);
+    }
+    KRReleaseOnSubThread(std::move(evicted));
+}
+
+size_t KRImageDecodeCache::TotalBytes() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return cache_.TotalBytes();
+}
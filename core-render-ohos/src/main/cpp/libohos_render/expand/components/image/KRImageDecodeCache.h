@@ -0,0 +1,121 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 THL A29 Limited, a Tencent company. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRIMAGEDECODECACHE_H
+#define CORE_RENDER_OHOS_KRIMAGEDECODECACHE_H
+
+#include <arkui/drawable_descriptor.h>
+#include <multimedia/image_framework/image/pixelmap_native.h>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "libohos_render/utils/KRByteLruCache.h"
+
+/**
+ * 解码后的图片，析构时释放 pixelmap 与 drawable
+ */
+class KRDecodedImage {
+ public:
+    KRDecodedImage(OH_PixelmapNative *pixelmap, uint32_t width, uint32_t height);
+    ~KRDecodedImage();
+    KRDecodedImage(const KRDecodedImage &) = delete;
+    KRDecodedImage &operator=(const KRDecodedImage &) = delete;
+
+    ArkUI_DrawableDescriptor *GetDrawable() const {
+        return drawable_;
+    }
+    uint32_t Width() const {
+        return width_;
+    }
+    uint32_t Height() const {
+        return height_;
+    }
+    size_t Bytes() const {
+        return static_cast<size_t>(width_) * height_ * 4;
+    }
+
+ private:
+    OH_PixelmapNative *pixelmap_ = nullptr;
+    ArkUI_DrawableDescriptor *drawable_ = nullptr;
+    uint32_t width_ = 0;
+    uint32_t height_ = 0;
+};
+
+/**
+ * 解码请求：source_id 唯一标识图片内容，target 为 0 时按原图尺寸解码
+ */
+struct KRImageDecodeRequest {
+    std::string source_id;
+    // 可选，source_id 不能唯一确定内容时提供完整内容，命中缓存时比较内容，避免 key 冲突显示错图
+    std::shared_ptr<const std::string> source_content;
+    uint32_t target_width = 0;   // 单位 px
+    uint32_t target_height = 0;  // 单位 px
+    // 在工作线程读取编码数据（base64 解码、读文件等），返回 false 表示数据不可用
+    std::function<bool(std::vector<uint8_t> &data)> data_provider;
+
+    std::string CacheKey() const;
+};
+
+using KRImageDecodeCompletion = std::function<void(std::shared_ptr<KRDecodedImage>)>;
+
+/**
+ * 进程级解码图片缓存
+ *
+ * 在 KRGCDQueue 上解码并降采样到目标尺寸，按 (source, 目标尺寸) 缓存，超出字节预算时按 LRU 淘汰；
+ * 相同 key 的并发请求只解码一次，结果在主线程回调，失败回调 nullptr。
+ */
+class KRImageDecodeCache {
+ public:
+    static KRImageDecodeCache &GetInstance();
+
+    void Fetch(KRImageDecodeRequest request, KRImageDecodeCompletion completion);
+
+    void SetByteBudget(size_t bytes);
+    void TrimToSize(size_t target_bytes);
+
+    /**
+     * 内存压力回调（level 与 AbilityConstant.MemoryLevel 一致：0 中等，1 低，2 严重）
+     */
+    void OnMemoryLevel(int level);
+
+    size_t TotalBytes();
+
+ private:
+    KRImageDecodeCache() = default;
+
+    struct CachedImage {
+        std::shared_ptr<KRDecodedImage> image;
+        std::shared_ptr<const std::string> source_content;
+    };
+
+    static constexpr size_t kDefaultByteBudget = 64 * 1024 * 1024;
+
+    std::mutex mutex_;
+    KRByteLruCache<std::string, CachedImage> cache_{kDefaultByteBudget};
+    KRRequestCoalescer<std::string, KRImageDecodeCompletion> pending_requests_;
+    std::unordered_map<std::string, std::shared_ptr<const std::string>> pending_sources_;
+
+    static std::shared_ptr<KRDecodedImage> Decode(const KRImageDecodeRequest &request);
+    static bool IsSameSource(const std::shared_ptr<const std::string> &lhs,
+                             const std::shared_ptr<const std::string> &rhs);
+    void DidDecode(const std::string &key, std::shared_ptr<KRDecodedImage> image);
+};
+
+#endif  // CORE_RENDER_OHOS_KRIMAGEDECODECACHE_H
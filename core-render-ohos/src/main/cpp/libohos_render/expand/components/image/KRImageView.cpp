@@ -16,10 +16,13 @@
 #include "libohos_render/expand/components/image/KRImageView.h"
 
 #include <resourcemanager/ohresmgr.h>
+#include <cmath>
+#include <fstream>
 #include <string_view>
 #include "libohos_render/expand/components/image/KRImageAdapterManager.h"
 #include "libohos_render/expand/modules/cache/KRMemoryCacheModule.h"
 #include "libohos_render/manager/KRSnapshotManager.h"
+#include "libohos_render/utils/KRBase64Util.h"
 #include "libohos_render/utils/KRURIHelper.h"
 #include "libohos_render/utils/KRStringUtil.h"
 
@@ -30,25 +33,13 @@ constexpr char kHttpsPrefix[] = "https:";
 constexpr char kFilePrefix[] = "file:";
 constexpr char kAssetsPrefix[] = "assets:";
 
-constexpr char kPropNameResize[] = "resize";
 constexpr char kResizeModeCover[] = "cover";
 constexpr char kResizeModeContain[] = "contain";
 constexpr char kResizeModeStretch[] = "stretch";
 
-constexpr char kPropNameDragEnable[] = "dragEnable";
-
-constexpr char kPropNameBlurRadius[] = "blurRadius";
-constexpr char kPropNameTintColor[] = "tintColor";
-constexpr char kPropNameCapInsets[] = "capInsets";
-constexpr char kPropNameDotNineImage[] = "dotNineImage";
-
-constexpr char kEventNameLoadSuccess[] = "loadSuccess";
-constexpr char kEventNameLoadResolution[] = "loadResolution";
-constexpr char kEventNameLoadFailure[] = "loadFailure";
 constexpr char kEventNameLoadErrorCode[] = "errorCode";
 constexpr char kParamKeyImageWidth[] = "imageWidth";
 constexpr char kParamKeyImageHeight[] = "imageHeight";
-constexpr char kPropNameMaskLinearGradient[] = "maskLinearGradient";
 
 bool isBase64(const std::string &src) {
     return src.find(kBase64Prefix) == 0;
@@ -80,76 +71,114 @@ bool KRImageView::ReuseEnable() {
 
 void KRImageView::OnDestroy() {
     ResetMaskLinearGradientNode();
+    CancelNativeDecode();
+    decoded_image_ = nullptr;
+}
+
+void KRImageView::SetRenderViewFrame(const KRRect &frame) {
+    if (decode_request_ == nullptr || frame.width <= 0 || frame.height <= 0) {
+        return;
+    }
+    if (!decode_started_) {
+        StartNativeDecode();
+        return;
+    }
+    // 视图变大超出已解码尺寸时按新尺寸重新解码，避免模糊
+    double dpi = KRConfig::GetDpi();
+    auto target_width = static_cast<uint32_t>(std::ceil(frame.width * dpi));
+    auto target_height = static_cast<uint32_t>(std::ceil(frame.height * dpi));
+    if (decode_request_->target_width > 0 &&
+        (target_width > decode_request_->target_width || target_height > decode_request_->target_height)) {
+        StartNativeDecode();
+    }
 }
 
 bool KRImageView::SetProp(const std::string &prop_key, const KRAnyValue &prop_value,
                           const KRRenderCallback event_call_back) {
     auto didHanded = false;
-    if (kuikly::util::isEqual(prop_key, kPropNameSrc)) {
-        didHanded = SetImageSrc(prop_value);
-    } else if (kuikly::util::isEqual(prop_key, kPropNameResize)) {
-        didHanded = SetResizeMode(prop_value);
-    } else if (kuikly::util::isEqual(prop_key, kPropNameBlurRadius)) {
-        didHanded = SetBlurRadius(prop_value);
-    } else if (kuikly::util::isEqual(prop_key, kPropNameTintColor)) {
-        didHanded = SetTintColor(prop_value);
-    } else if (kuikly::util::isEqual(prop_key, kPropNameCapInsets)) {
-        didHanded = SetCapInsets(prop_value);
-    } else if (kuikly::util::isEqual(prop_key, kPropNameDotNineImage)) {
-        didHanded = SetDotNineImage(prop_value);
-    } else if (kuikly::util::isEqual(prop_key, kPropNameMaskLinearGradient)) {
-        didHanded = SetMaskLinearGradient(prop_value);        
-    } else if (kuikly::util::isEqual(prop_key, kEventNameLoadSuccess)) {
-        didHanded = RegisterLoadSuccessCallback(event_call_back);
-    } else if (kuikly::util::isEqual(prop_key, kEventNameLoadResolution)) {
-        didHanded = RegisterLoadResolutionCallback(event_call_back);
-    } else if (kuikly::util::isEqual(prop_key, kEventNameLoadFailure)) {
-        didHanded = RegisterLoadFailureCallback(event_call_back);
-    } else if (kuikly::util::isEqual(prop_key, kPropNameDragEnable)) {
-        didHanded = SetDragEnable(prop_value);
+    switch (KRGetPropKeyId(prop_key)) {
+        case KRPropKeyId::kSrc:
+            didHanded = SetImageSrc(prop_value);
+            break;
+        case KRPropKeyId::kResize:
+            didHanded = SetResizeMode(prop_value);
+            break;
+        case KRPropKeyId::kBlurRadius:
+            didHanded = SetBlurRadius(prop_value);
+            break;
+        case KRPropKeyId::kTintColor:
+            didHanded = SetTintColor(prop_value);
+            break;
+        case KRPropKeyId::kCapInsets:
+            didHanded = SetCapInsets(prop_value);
+            break;
+        case KRPropKeyId::kDotNineImage:
+            didHanded = SetDotNineImage(prop_value);
+            break;
+        case KRPropKeyId::kMaskLinearGradient:
+            didHanded = SetMaskLinearGradient(prop_value);
+            break;
+        case KRPropKeyId::kLoadSuccess:
+            didHanded = RegisterLoadSuccessCallback(event_call_back);
+            break;
+        case KRPropKeyId::kLoadResolution:
+            didHanded = RegisterLoadResolutionCallback(event_call_back);
+            break;
+        case KRPropKeyId::kLoadFailure:
+            didHanded = RegisterLoadFailureCallback(event_call_back);
+            break;
+        case KRPropKeyId::kDragEnable:
+            didHanded = SetDragEnable(prop_value);
+            break;
+        default:
+            break;
     }
     return didHanded;
 }
 
 bool KRImageView::ResetProp(const std::string &prop_key) {
-    auto didHanded = false;
-    if (kuikly::util::isEqual(prop_key, kPropNameSrc)) {
-        image_src_ = "";
-        kuikly::util::ResetArkUIImageSrc(GetNode());
-        didHanded = true;
-    } else if (kuikly::util::isEqual(prop_key, kPropNameResize)) {
-        SetResizeMode(NewKRRenderValue(kResizeModeCover));
-        didHanded = true;
-    } else if (kuikly::util::isEqual(prop_key, kPropNameBlurRadius)) {
-        kuikly::util::ResetArkUIImageBlurRadius(GetNode());
-        didHanded = true;
-    } else if (kuikly::util::isEqual(prop_key, kPropNameTintColor)) {
-        kuikly::util::ResetArkUIImageTintColor(GetNode());
-        didHanded = true;
-    } else if (kuikly::util::isEqual(prop_key, kPropNameCapInsets)) {
-        kuikly::util::ResetArkUIImageCapInsets(GetNode());
-        didHanded = true;
-    } else if (kuikly::util::isEqual(prop_key, kPropNameDotNineImage)) {
-        this->is_dot_nine_image_ = false;
-        didHanded = true;
-    } else if (kuikly::util::isEqual(prop_key, kPropNameMaskLinearGradient)) {
-        ResetMaskLinearGradientNode();
-        kuikly::util::ResetArkUIImageBlendMode(GetNode());
-        didHanded = true;
-    } else if (kuikly::util::isEqual(prop_key, kEventNameLoadSuccess)) {
-        didHanded = true;
-        had_register_on_complete_event_ = false;
-        load_success_callback_ = nullptr;
-    } else if (kuikly::util::isEqual(prop_key, kEventNameLoadResolution)) {
-        didHanded = true;
-        had_register_on_complete_event_ = false;
-        load_resolution_callback_ = nullptr;
-    } else if (kuikly::util::isEqual(prop_key, kEventNameLoadFailure)) {
-        didHanded = true;
-        had_register_on_error_event_ = false;
-        load_failure_callback_ = nullptr;
-    } else {
-        didHanded = IKRRenderViewExport::ResetProp(prop_key);
+    auto didHanded = true;
+    switch (KRGetPropKeyId(prop_key)) {
+        case KRPropKeyId::kSrc:
+            image_src_ = "";
+            CancelNativeDecode();
+            kuikly::util::ResetArkUIImageSrc(GetNode());
+            decoded_image_ = nullptr;
+            break;
+        case KRPropKeyId::kResize:
+            SetResizeMode(NewKRRenderValue(kResizeModeCover));
+            break;
+        case KRPropKeyId::kBlurRadius:
+            kuikly::util::ResetArkUIImageBlurRadius(GetNode());
+            break;
+        case KRPropKeyId::kTintColor:
+            kuikly::util::ResetArkUIImageTintColor(GetNode());
+            break;
+        case KRPropKeyId::kCapInsets:
+            kuikly::util::ResetArkUIImageCapInsets(GetNode());
+            break;
+        case KRPropKeyId::kDotNineImage:
+            this->is_dot_nine_image_ = false;
+            break;
+        case KRPropKeyId::kMaskLinearGradient:
+            ResetMaskLinearGradientNode();
+            kuikly::util::ResetArkUIImageBlendMode(GetNode());
+            break;
+        case KRPropKeyId::kLoadSuccess:
+            had_register_on_complete_event_ = false;
+            load_success_callback_ = nullptr;
+            break;
+        case KRPropKeyId::kLoadResolution:
+            had_register_on_complete_event_ = false;
+            load_resolution_callback_ = nullptr;
+            break;
+        case KRPropKeyId::kLoadFailure:
+            had_register_on_error_event_ = false;
+            load_failure_callback_ = nullptr;
+            break;
+        default:
+            didHanded = IKRRenderViewExport::ResetProp(prop_key);
+            break;
     }
     return didHanded;
 }
@@ -389,6 +418,7 @@ std::shared_ptr<KRImageLoadOption> KRImageView::ToImageLoadOption(const std::str
 }
 
 void KRImageView::LoadFromSrc(const std::string image_src) {
+    CancelNativeDecode();
     image_option_ = ToImageLoadOption(image_src);
     image_src_ = image_option_->src_;
 
@@ -418,16 +448,113 @@ void KRImageView::LoadFromBase64(const std::shared_ptr<KRImageLoadOption> image_
         auto module_name = std::string(kMemoryCacheModuleName);
         auto memory_cache_module = std::dynamic_pointer_cast<KRMemoryCacheModule>(GetModule(module_name));
         if (memory_cache_module) {
-            auto base64Str = memory_cache_module->Get(image_option->src_)->toString();
-            if (!base64Str.empty()) {
-                kuikly::util::SetArkUIImageSrc(GetNode(), base64Str);
+            // 持有缓存中的共享值，避免拷贝整段 data uri
+            auto cached_value = memory_cache_module->Get(image_option->src_);
+            if (!cached_value->toString().empty()) {
+                LoadFromCachedBase64(image_option->src_, cached_value);
+                return;
             }
+            // 已被淘汰：请求 Kotlin 侧重发，回填时 src 未变才加载
+            std::weak_ptr<IKRRenderViewExport> weak_self = shared_from_this();
+            auto cache_key = image_option->src_;
+            memory_cache_module->RequestValue(cache_key, [weak_self, cache_key](const KRAnyValue &value) {
+                auto self = std::static_pointer_cast<KRImageView>(weak_self.lock());
+                if (self == nullptr || self->image_src_ != cache_key || value->toString().empty()) {
+                    return;
+                }
+                self->LoadFromCachedBase64(cache_key, value);
+            });
         }
     }
 }
 
+void KRImageView::LoadFromCachedBase64(const std::string &cache_key, const KRAnyValue &cached_value) {
+    const auto &base64Str = cached_value->toString();
+    KRImageDecodeRequest request;
+    // 以缓存 key 标识内容，不在主线程对整段 data uri 求哈希；key 冲突由解码缓存比较完整内容识别
+    request.source_id = "base64:" + cache_key + ":" + std::to_string(base64Str.size());
+    request.source_content = std::shared_ptr<const std::string>(cached_value, &base64Str);
+    request.data_provider = [cached_value](std::vector<uint8_t> &data) {
+        const auto &data_uri = cached_value->toString();
+        auto comma = data_uri.find(',');
+        if (comma == std::string::npos) {
+            return false;
+        }
+        auto bytes = KRBase64Util::Decode(std::string_view(data_uri).substr(comma + 1));
+        data.assign(bytes.begin(), bytes.end());
+        return true;
+    };
+    LoadWithNativeDecoder(std::move(request), base64Str);
+}
+
 void KRImageView::LoadFromFile(const std::shared_ptr<KRImageLoadOption> image_option) {
-    kuikly::util::SetArkUIImageSrc(GetNode(), image_option->src_);
+    constexpr std::string_view kFileScheme = "file://";
+    const auto &src = image_option->src_;
+    if (src.rfind(kFileScheme, 0) != 0) {
+        kuikly::util::SetArkUIImageSrc(GetNode(), src);
+        return;
+    }
+    KRImageDecodeRequest request;
+    request.source_id = src;
+    request.data_provider = [path = src.substr(kFileScheme.size())](std::vector<uint8_t> &data) {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file) {
+            return false;
+        }
+        data.resize(static_cast<size_t>(file.tellg()));
+        file.seekg(0);
+        return static_cast<bool>(file.read(reinterpret_cast<char *>(data.data()), data.size()));
+    };
+    LoadWithNativeDecoder(std::move(request), src);
+}
+
+void KRImageView::LoadWithNativeDecoder(KRImageDecodeRequest request, const std::string &fallback_src) {
+    decode_request_ = std::make_unique<KRImageDecodeRequest>(std::move(request));
+    decode_fallback_src_ = fallback_src;
+    decode_started_ = false;
+    const auto &frame = GetFrame();
+    if (frame.width > 0 && frame.height > 0) {
+        StartNativeDecode();
+    }  // 否则等 frame 确定后再按视图尺寸解码
+}
+
+void KRImageView::StartNativeDecode() {
+    if (decode_request_ == nullptr) {
+        return;
+    }
+    decode_started_ = true;
+    // 点九图和分辨率回调依赖原图尺寸，不做降采样
+    if (is_dot_nine_image_ || load_resolution_callback_) {
+        decode_request_->target_width = 0;
+        decode_request_->target_height = 0;
+    } else {
+        double dpi = KRConfig::GetDpi();
+        decode_request_->target_width = static_cast<uint32_t>(std::ceil(GetFrame().width * dpi));
+        decode_request_->target_height = static_cast<uint32_t>(std::ceil(GetFrame().height * dpi));
+    }
+    auto seq = ++decode_seq_;
+    std::weak_ptr<IKRRenderViewExport> weak_self = shared_from_this();
+    auto completion = [weak_self, seq](std::shared_ptr<KRDecodedImage> image) {
+        auto self = std::static_pointer_cast<KRImageView>(weak_self.lock());
+        if (self == nullptr || self->decode_seq_ != seq || self->GetNode() == nullptr) {
+            return;
+        }
+        if (image && image->GetDrawable()) {
+            kuikly::util::SetArkUIImageSrc(self->GetNode(), image->GetDrawable());
+            self->decoded_image_ = image;
+        } else {
+            kuikly::util::SetArkUIImageSrc(self->GetNode(), self->decode_fallback_src_);
+            self->decoded_image_ = nullptr;
+        }
+    };
+    KRImageDecodeCache::GetInstance().Fetch(*decode_request_, completion);
+}
+
+void KRImageView::CancelNativeDecode() {
+    decode_seq_++;
+    decode_request_ = nullptr;
+    decode_fallback_src_.clear();
+    decode_started_ = false;
 }
 
 void KRImageView::LoadFromNetwork(const std::shared_ptr<KRImageLoadOption> image_option) {
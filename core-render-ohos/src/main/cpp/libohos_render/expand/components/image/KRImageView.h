@@ -16,6 +16,7 @@
 #ifndef CORE_RENDER_OHOS_KRIMAGEVIEW_H
 #define CORE_RENDER_OHOS_KRIMAGEVIEW_H
 
+#include "libohos_render/expand/components/image/KRImageDecodeCache.h"
 #include "libohos_render/expand/components/image/KRImageLoadOption.h"
 #include "libohos_render/export/IKRRenderViewExport.h"
 
@@ -37,6 +38,7 @@ class KRImageView : public IKRRenderViewExport {
                  const KRRenderCallback event_call_back = nullptr) override;
     bool ResetProp(const std::string &prop_key) override;
     void OnEvent(ArkUI_NodeEvent *event, const ArkUI_NodeEventType &event_type) override;
+    void SetRenderViewFrame(const KRRect &frame) override;
     void OnDestroy() override;
 
  private:
@@ -58,9 +60,13 @@ class KRImageView : public IKRRenderViewExport {
     void LoadFromSrc(const std::string image_src);
     void LoadFromNetwork(const std::shared_ptr<KRImageLoadOption> image_option);
     void LoadFromBase64(const std::shared_ptr<KRImageLoadOption> image_option);
+    void LoadFromCachedBase64(const std::string &cache_key, const KRAnyValue &cached_value);
     void LoadFromFile(const std::shared_ptr<KRImageLoadOption> image_option);
     void LoadFromResourceMedia(const std::shared_ptr<KRImageLoadOption> image_option);
     void LoadFromAssets(const std::shared_ptr<KRImageLoadOption> image_option);
+    void LoadWithNativeDecoder(KRImageDecodeRequest request, const std::string &fallback_src);
+    void StartNativeDecode();
+    void CancelNativeDecode();
 
  private:
     std::string image_src_;
@@ -72,6 +78,11 @@ class KRImageView : public IKRRenderViewExport {
     bool had_register_on_error_event_ = false;
     bool is_dot_nine_image_ = false;
     ArkUI_NodeHandle mask_linear_gradient_node_ = nullptr;
+    std::shared_ptr<KRDecodedImage> decoded_image_ = nullptr;  // 正在显示的原生解码图片
+    std::unique_ptr<KRImageDecodeRequest> decode_request_ = nullptr;  // 当前 src 的原生解码请求
+    std::string decode_fallback_src_;  // 原生解码失败时交给 ArkUI 加载的 src
+    uint32_t decode_seq_ = 0;          // src 变化时递增，丢弃过期的解码结果
+    bool decode_started_ = false;
 };
 
 #endif  // CORE_RENDER_OHOS_KRIMAGEVIEW_H
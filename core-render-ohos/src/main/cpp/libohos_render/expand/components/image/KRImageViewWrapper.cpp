@@ -15,9 +15,7 @@
 
 #include "libohos_render/expand/components/image/KRImageViewWrapper.h"
 
-constexpr char kPropNameResize[] = "resize";
 constexpr char kPropNameSrc[] = "src";
-constexpr char kPropNamePlaceHolder[] = "placeholder";
 
 void KRImageViewWrapper::DidInit() {
     place_holder_image_view_ = std::make_shared<KRImageView>();
@@ -58,11 +56,16 @@ bool KRImageViewWrapper::SetProp(const std::string &prop_key, const KRAnyValue &
                                  const KRRenderCallback event_call_back) {
     auto didHanded = false;
     didHanded = image_view_->SetProp(prop_key, prop_value, event_call_back);
-    if (std::strcmp(prop_key.c_str(), kPropNameResize) == 0) {
-        place_holder_image_view_->SetProp(prop_key, prop_value, event_call_back);
-    } else if (std::strcmp(prop_key.c_str(), kPropNamePlaceHolder) == 0) {
-        place_holder_image_view_->SetProp(kPropNameSrc, prop_value, event_call_back);
-        didHanded = true;
+    switch (KRGetPropKeyId(prop_key)) {
+        case KRPropKeyId::kResize:
+            place_holder_image_view_->SetProp(prop_key, prop_value, event_call_back);
+            break;
+        case KRPropKeyId::kPlaceholder:
+            place_holder_image_view_->SetProp(kPropNameSrc, prop_value, event_call_back);
+            didHanded = true;
+            break;
+        default:
+            break;
     }
     return didHanded;
 }
@@ -70,17 +73,24 @@ bool KRImageViewWrapper::SetProp(const std::string &prop_key, const KRAnyValue &
 bool KRImageViewWrapper::ResetProp(const std::string &prop_key) {
     IKRRenderViewExport::ResetProp(prop_key);
     auto didHanded = image_view_->ResetProp(prop_key);
-    if (std::strcmp(prop_key.c_str(), kPropNameResize) == 0) {
-        place_holder_image_view_->ResetProp(kPropNameResize);
-    } else if (std::strcmp(prop_key.c_str(), kPropNamePlaceHolder) == 0) {
-        place_holder_image_view_->ResetProp(kPropNameSrc);
-        didHanded = true;
+    switch (KRGetPropKeyId(prop_key)) {
+        case KRPropKeyId::kResize:
+            place_holder_image_view_->ResetProp(prop_key);
+            break;
+        case KRPropKeyId::kPlaceholder:
+            place_holder_image_view_->ResetProp(kPropNameSrc);
+            didHanded = true;
+            break;
+        default:
+            break;
     }
     return didHanded;
 }
 
 void KRImageViewWrapper::SetRenderViewFrame(const KRRect &frame) {
     IKRRenderViewExport::SetRenderViewFrame(frame);
-    kuikly::util::UpdateNodeFrame(image_view_->GetNode(), KRRect(0, 0, frame.width, frame.height));
-    kuikly::util::UpdateNodeFrame(place_holder_image_view_->GetNode(), KRRect(0, 0, frame.width, frame.height));
+    // 经 ToSetFrame 设置子视图 frame，子 KRImageView 才能拿到尺寸并触发 native 解码
+    KRRect child_frame(0, 0, frame.width, frame.height);
+    image_view_->ToSetFrame(child_frame);
+    place_holder_image_view_->ToSetFrame(child_frame);
 }
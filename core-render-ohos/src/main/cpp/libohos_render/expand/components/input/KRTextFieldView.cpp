@@ -17,32 +17,12 @@
 
 #include "libohos_render/manager/KRKeyboardManager.h"
 
-constexpr char *kText = "text";
-constexpr char *kPlaceholder = "placeholder";
-constexpr char *kPlaceholderColor = "placeholderColor";
-constexpr char *kFontSize = "fontSize";
-constexpr char *kFontWeight = "fontWeight";
-constexpr char *kColor = "color";
-constexpr char *kEditable = "editable";
-constexpr char *kTintColor = "tintColor";
-constexpr char *kTextAlign = "textAlign";
-constexpr char *kKeyboardType = "keyboardType";    // 键盘类型
-constexpr char *kReturnKeyType = "returnKeyType";  // return类型
-constexpr char *kMaxTextLength = "maxTextLength";  // 最大长度
-
 constexpr char kMethodFocus[] = "focus";
 constexpr char kMethodBlur[] = "blur";
 constexpr char kMethodSetText[] = "setText";
 constexpr char kMethodGetCursorIndex[] = "getCursorIndex";
 constexpr char kMethodSetCursorIndex[] = "setCursorIndex";
 
-constexpr char kEventTextDidChanged[] = "textDidChange";
-constexpr char kEventInputFocus[] = "inputFocus";
-constexpr char kEventInputBlur[] = "inputBlur";
-constexpr char kEventInputReturn[] = "inputReturn";
-constexpr char kEventTextLengthBeyondLimit[] = "textLengthBeyondLimit";
-constexpr char kEventKeyboardHeightChange[] = "keyboardHeightChange";  // 键盘高度变化
-
 ArkUI_NodeHandle KRTextFieldView::CreateNode() {
     return kuikly::util::GetNodeApi()->createNode(ARKUI_NODE_TEXT_INPUT);
 }
@@ -65,110 +45,90 @@ void KRTextFieldView::OnDestroy() {
 
 bool KRTextFieldView::SetProp(const std::string &prop_key, const KRAnyValue &prop_value,
                               const KRRenderCallback event_call_back) {
-    if (kuikly::util::isEqual(prop_key, kText)) {  // 占位
-        SetContentText(prop_value->toString());
-        return true;
-    }
-    if (kuikly::util::isEqual(prop_key, kPlaceholder)) {  // 占位
-        kuikly::util::UpdateInputNodePlaceholder(GetNode(), prop_value->toString());
-        return true;
-    }
-    if (kuikly::util::isEqual(prop_key, kPlaceholderColor)) {  // 占位颜色
-        kuikly::util::UpdateInputNodePlaceholderColor(GetNode(), kuikly::util::ConvertToHexColor(prop_value->toString()));
-        return true;
-    }
-    if (kuikly::util::isEqual(prop_key, kFontSize)) {  // 字体大小
-        font_size_ = prop_value->toFloat();
-        SetFont(font_size_, font_weight_);
-        return true;
-    }
-    if (kuikly::util::isEqual(prop_key, kFontWeight)) {  // 字重
-        font_weight_ = kuikly::util::ConvertArkUIFontWeight(prop_value->toInt());
-        SetFont(font_size_, font_weight_);
-        return true;
-    }
-    if (kuikly::util::isEqual(prop_key, kColor)) {  // 字体颜色
-        kuikly::util::UpdateInputNodeColor(GetNode(), kuikly::util::ConvertToHexColor(prop_value->toString()));
-        return true;
-    }
-
-    if (kuikly::util::isEqual(prop_key, kTintColor)) {  // 光标颜色
-        kuikly::util::UpdateInputNodeCaretrColor(GetNode(), kuikly::util::ConvertToHexColor(prop_value->toString()));
-        return true;
-    }
-
-    if (kuikly::util::isEqual(prop_key, kTextAlign)) {  // 文本对齐
-        kuikly::util::UpdateInputNodeTextAlign(GetNode(), prop_value->toString());
-        return true;
-    }
-
-    if (kuikly::util::isEqual(prop_key, kEditable)) {  // 是否可以编辑输入
-        focusable_ = prop_value->toBool();
-        kuikly::util::UpdateInputNodeFocusable(GetNode(), prop_value->toInt());
-        return true;
-    }
-
-    if (kuikly::util::isEqual(prop_key, kKeyboardType)) {  // 键盘输入类型
-        kuikly::util::UpdateInputNodeKeyboardType(GetNode(), kuikly::util::ConvertToInputType(prop_value->toString()));
-        return true;
-    }
-
-    if (kuikly::util::isEqual(prop_key, kReturnKeyType)) {  // 完成键类型
-        kuikly::util::UpdateInputNodeEnterKeyType(GetNode(), kuikly::util::ConvertToEnterKeyType(prop_value->toString()));
-        return true;
-    }
-
-    if (kuikly::util::isEqual(prop_key, kMaxTextLength)) {  // 输入长度限制
-        max_length_ = prop_value->toInt();
-        LimitInputContentTextInMaxLength();
-        if (!text_length_beyond_limit_callback_) {
-            kuikly::util::UpdateInputNodeMaxLength(GetNode(), max_length_);  // 直接限制
+    switch (KRGetPropKeyId(prop_key)) {
+        case KRPropKeyId::kText:  // 文本
+            SetContentText(prop_value->toString());
+            return true;
+        case KRPropKeyId::kPlaceholder:  // 占位
+            kuikly::util::UpdateInputNodePlaceholder(GetNode(), prop_value->toString());
+            return true;
+        case KRPropKeyId::kPlaceholderColor:  // 占位颜色
+            kuikly::util::UpdateInputNodePlaceholderColor(GetNode(),
+                                                          kuikly::util::ConvertToHexColor(prop_value->toString()));
+            return true;
+        case KRPropKeyId::kFontSize:  // 字体大小
+            font_size_ = prop_value->toFloat();
+            SetFont(font_size_, font_weight_);
+            return true;
+        case KRPropKeyId::kFontWeight:  // 字重
+            font_weight_ = kuikly::util::ConvertArkUIFontWeight(prop_value->toInt());
+            SetFont(font_size_, font_weight_);
+            return true;
+        case KRPropKeyId::kColor:  // 字体颜色
+            kuikly::util::UpdateInputNodeColor(GetNode(), kuikly::util::ConvertToHexColor(prop_value->toString()));
+            return true;
+        case KRPropKeyId::kTintColor:  // 光标颜色
+            kuikly::util::UpdateInputNodeCaretrColor(GetNode(),
+                                                     kuikly::util::ConvertToHexColor(prop_value->toString()));
+            return true;
+        case KRPropKeyId::kTextAlign:  // 文本对齐
+            kuikly::util::UpdateInputNodeTextAlign(GetNode(), prop_value->toString());
+            return true;
+        case KRPropKeyId::kEditable:  // 是否可以编辑输入
+            focusable_ = prop_value->toBool();
+            kuikly::util::UpdateInputNodeFocusable(GetNode(), prop_value->toInt());
+            return true;
+        case KRPropKeyId::kKeyboardType:  // 键盘输入类型
+            kuikly::util::UpdateInputNodeKeyboardType(GetNode(),
+                                                      kuikly::util::ConvertToInputType(prop_value->toString()));
+            return true;
+        case KRPropKeyId::kReturnKeyType:  // 完成键类型
+            kuikly::util::UpdateInputNodeEnterKeyType(GetNode(),
+                                                      kuikly::util::ConvertToEnterKeyType(prop_value->toString()));
+            return true;
+        case KRPropKeyId::kMaxTextLength:  // 输入长度限制
+            max_length_ = prop_value->toInt();
+            LimitInputContentTextInMaxLength();
+            if (!text_length_beyond_limit_callback_) {
+                kuikly::util::UpdateInputNodeMaxLength(GetNode(), max_length_);  // 直接限制
+            }
+            return true;
+        // 事件
+        case KRPropKeyId::kTextDidChange:  // 文本变化事件
+            text_did_change_callback_ = event_call_back;
+            RegisterEvent(ArkUI_NodeEventType::NODE_ON_FOCUS);
+            RegisterEvent(ArkUI_NodeEventType::NODE_ON_BLUR);
+            return true;
+        case KRPropKeyId::kInputFocus:  // 获焦事件
+            input_focus_callback_ = event_call_back;
+            RegisterEvent(ArkUI_NodeEventType::NODE_ON_FOCUS);
+            return true;
+        case KRPropKeyId::kInputBlur:  // 失焦事件
+            input_blur_callback_ = event_call_back;
+            RegisterEvent(ArkUI_NodeEventType::NODE_ON_BLUR);
+            return true;
+        case KRPropKeyId::kInputReturn:  // 按下完成键回调事件
+            input_return_callback_ = event_call_back;
+            RegisterEvent(GetOnSubmitEventType());
+            return true;
+        case KRPropKeyId::kTextLengthBeyondLimit:  // 监听文字是否超过输入最大的限制事件
+            text_length_beyond_limit_callback_ = event_call_back;
+            kuikly::util::UpdateInputNodeMaxLength(GetNode(), 10000000);  // 不限制，通过LimitInputContentTextInMaxLength
+            return true;
+        case KRPropKeyId::kKeyboardHeightChange: {  // 键盘高度变化事件
+            keyboard_height_changed_callback_ = event_call_back;
+            auto key = NewKRRenderValue(GetViewTag())->toString();
+            KRKeyboardManager::GetInstance().AddKeyboardTask(key, [event_call_back](float height, int duration_ms) {
+                KRRenderValueMap map;
+                map["height"] = NewKRRenderValue(height);
+                map["duration"] = NewKRRenderValue(duration_ms / 1000.0);
+                event_call_back(NewKRRenderValue(map));
+            });
+            return true;
         }
-        return true;
+        default:
+            break;
     }
-
-    // 事件
-    if (kuikly::util::isEqual(prop_key, kEventTextDidChanged)) {  // 文本变化事件
-        text_did_change_callback_ = event_call_back;
-        RegisterEvent(ArkUI_NodeEventType::NODE_ON_FOCUS);
-        RegisterEvent(ArkUI_NodeEventType::NODE_ON_BLUR);
-        return true;
-    }
-
-    if (kuikly::util::isEqual(prop_key, kEventInputFocus)) {  // 获焦事件
-        input_focus_callback_ = event_call_back;
-        RegisterEvent(ArkUI_NodeEventType::NODE_ON_FOCUS);
-        return true;
-    }
-
-    if (kuikly::util::isEqual(prop_key, kEventInputBlur)) {  // 失焦事件
-        input_blur_callback_ = event_call_back;
-        RegisterEvent(ArkUI_NodeEventType::NODE_ON_BLUR);
-        return true;
-    }
-    if (kuikly::util::isEqual(prop_key, kEventInputReturn)) {  // 按下完成键回调事件
-        input_return_callback_ = event_call_back;
-        RegisterEvent(GetOnSubmitEventType());
-        return true;
-    }
-    if (kuikly::util::isEqual(prop_key, kEventTextLengthBeyondLimit)) {  // 监听文字是否超过输入最大的限制事件
-        text_length_beyond_limit_callback_ = event_call_back;
-        kuikly::util::UpdateInputNodeMaxLength(GetNode(), 10000000);  // 不限制，通过LimitInputContentTextInMaxLength
-        return true;
-    }
-
-    if (kuikly::util::isEqual(prop_key, kEventKeyboardHeightChange)) {  // 监听文字是否超过输入最大的限制事件
-        keyboard_height_changed_callback_ = event_call_back;
-        auto key = NewKRRenderValue(GetViewTag())->toString();
-        KRKeyboardManager::GetInstance().AddKeyboardTask(key, [event_call_back](float height, int duration_ms) {
-            KRRenderValueMap map;
-            map["height"] = NewKRRenderValue(height);
-            map["duration"] = NewKRRenderValue(duration_ms / 1000.0);
-            event_call_back(NewKRRenderValue(map));
-        });
-        return true;
-    }
-
     return IKRRenderViewExport::SetProp(prop_key, prop_value, event_call_back);
 }
 
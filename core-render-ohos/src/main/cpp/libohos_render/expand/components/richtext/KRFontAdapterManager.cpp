@@ -32,3 +32,9 @@ std::unordered_map<std::string, KRFontAdapter> KRFontAdapterManager::AllAdapters
     std::lock_guard<std::mutex> lock(mutex_);
     return adapterMap_;
 }
+
+KRFontAdapter KRFontAdapterManager::GetAdapter(const std::string &fontFamily) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = adapterMap_.find(fontFamily);
+    return it != adapterMap_.end() ? it->second : nullptr;
+}
@@ -26,6 +26,7 @@ class KRFontAdapterManager final {
     void RegisterFontAdapter(KRFontAdapter adapter, const char *fontFamily);
 
     std::unordered_map<std::string, KRFontAdapter> AllAdapters();
+    KRFontAdapter GetAdapter(const std::string &fontFamily);
 
  private:
     KRFontAdapterManager() = default;
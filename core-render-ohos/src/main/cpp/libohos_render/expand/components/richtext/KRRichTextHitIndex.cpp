@@ -0,0 +1,85 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 THL A29 Limited, a Tencent company. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/expand/components/richtext/KRRichTextHitIndex.h"
+
+#include <algorithm>
+
+void KRRichTextHitIndex::AddRun(int span_index, float left, float top, float right, float bottom) {
+    if (right <= left || bottom <= top) {
+        return;
+    }
+    runs_.push_back(Run{left, top, right, bottom, span_index});
+}
+
+void KRRichTextHitIndex::Build() {
+    lines_.clear();
+    std::sort(runs_.begin(), runs_.end(), [](const Run &a, const Run &b) {
+        if (a.top != b.top) {
+            return a.top < b.top;
+        }
+        if (a.left != b.left) {
+            return a.left < b.left;
+        }
+        return a.span_index < b.span_index;
+    });
+    // 同一行的文本框（RECT_HEIGHT_STYLE_MAX）top 相同
+    size_t begin = 0;
+    while (begin < runs_.size()) {
+        Line line{runs_[begin].top, runs_[begin].bottom, 0, begin, begin + 1};
+        while (line.end < runs_.size() && runs_[line.end].top == line.top) {
+            line.bottom = std::max(line.bottom, runs_[line.end].bottom);
+            line.end++;
+        }
+        line.max_bottom = lines_.empty() ? line.bottom : std::max(line.bottom, lines_.back().max_bottom);
+        lines_.push_back(line);
+        begin = line.end;
+    }
+}
+
+int KRRichTextHitIndex::HitTest(float x, float y) const {
+    // 二分找到最后一个 top <= y 的行，再按前缀最大 bottom 回溯（通常只检查一行）
+    auto it = std::upper_bound(lines_.begin(), lines_.end(), y,
+                               [](float value, const Line &line) { return value < line.top; });
+    int result = -1;
+    while (it != lines_.begin()) {
+        --it;
+        if (y >= it->max_bottom) {
+            break;
+        }
+        if (y >= it->bottom) {
+            continue;
+        }
+        auto run_begin = runs_.begin() + it->begin;
+        auto run_end = runs_.begin() + it->end;
+        auto run = std::upper_bound(run_begin, run_end, x, [](float value, const Run &r) { return value < r.left; });
+        // 行内文本框互不重叠，通常只需检查左侧相邻的一个
+        while (run != run_begin) {
+            --run;
+            if (x >= run->right) {
+                break;
+            }
+            if (result == -1 || run->span_index < result) {
+                result = run->span_index;
+            }
+        }
+    }
+    return result;
+}
+
+void KRRichTextHitIndex::Clear() {
+    runs_.clear();
+    lines_.clear();
+}
@@ -0,0 +1,70 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 THL A29 Limited, a Tencent company. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRRICHTEXTHITINDEX_H
+#define CORE_RENDER_OHOS_KRRICHTEXTHITINDEX_H
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * 富文本点击命中索引：按行（top 排序）组织 span 的文本框，命中时先二分查找行再在行内二分查找 span
+ * 与 OH_Drawing 解耦，坐标单位由调用方决定
+ */
+class KRRichTextHitIndex {
+ public:
+    struct Run {
+        float left;
+        float top;
+        float right;
+        float bottom;
+        int span_index;
+    };
+
+    /**
+     * 添加一个 span 的文本框，所有框添加完成后需调用 Build
+     */
+    void AddRun(int span_index, float left, float top, float right, float bottom);
+
+    /**
+     * 对已添加的文本框分行并排序
+     */
+    void Build();
+
+    /**
+     * 返回命中的 span 下标，未命中返回 -1
+     */
+    int HitTest(float x, float y) const;
+
+    void Clear();
+
+    bool Empty() const {
+        return lines_.empty();
+    }
+
+ private:
+    struct Line {
+        float top;
+        float bottom;
+        float max_bottom;  // 当前行及之前所有行的最大 bottom
+        size_t begin;  // runs_ 中的区间 [begin, end)
+        size_t end;
+    };
+
+    std::vector<Run> runs_;
+    std::vector<Line> lines_;
+};
+
+#endif  // CORE_RENDER_OHOS_KRRICHTEXTHITINDEX_H
@@ -0,0 +1,162 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 THL A29 Limited, a Tencent company. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/expand/components/richtext/KRRichTextMeasureCache.h"
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <vector>
+
+namespace {
+uint64_t Mix(uint64_t x) {
+    // splitmix64 finalizer
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return x;
+}
+
+void AppendString(const std::string &value, std::string &out) {
+    // 带长度前缀，避免不同的值拼接出相同的序列
+    out += std::to_string(value.size());
+    out += ':';
+    out += value;
+}
+
+template <typename T> void AppendRaw(T value, std::string &out) {
+    out.append(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+}  // namespace
+
+size_t KRRichTextMeasureKeyHash::operator()(const KRRichTextMeasureKey &key) const {
+    uint64_t hash = KRRichTextMeasureCache::HashDouble(key.constraint_width);
+    hash = KRRichTextMeasureCache::Combine(hash, KRRichTextMeasureCache::HashDouble(key.constraint_height));
+    hash = KRRichTextMeasureCache::Combine(hash, KRRichTextMeasureCache::HashDouble(key.dpi));
+    hash = KRRichTextMeasureCache::Combine(hash, KRRichTextMeasureCache::HashDouble(key.font_size_scale));
+    hash = KRRichTextMeasureCache::Combine(hash, KRRichTextMeasureCache::HashDouble(key.font_weight_scale));
+    return static_cast<size_t>(KRRichTextMeasureCache::Combine(key.content_hash, hash));
+}
+
+KRRichTextMeasureCache &KRRichTextMeasureCache::GetInstance() {
+    static KRRichTextMeasureCache *instance = new KRRichTextMeasureCache();
+    return *instance;
+}
+
+bool KRRichTextMeasureCache::Get(const KRRichTextMeasureKey &key, KRRichTextMeasureResult &result) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = index_.find(key);
+    if (it == index_.end()) {
+        return false;
+    }
+    lru_.splice(lru_.begin(), lru_, it->second);
+    result = it->second->second;
+    return true;
+}
+
+void KRRichTextMeasureCache::Put(const KRRichTextMeasureKey &key, const KRRichTextMeasureResult &result) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = index_.find(key);
+    if (it != index_.end()) {
+        it->second->second = result;
+        lru_.splice(lru_.begin(), lru_, it->second);
+        return;
+    }
+    lru_.emplace_front(key, result);
+    index_[key] = lru_.begin();
+    if (lru_.size() > kMaxEntries) {
+        index_.erase(lru_.back().first);
+        lru_.pop_back();
+    }
+}
+
+void KRRichTextMeasureCache::Clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    index_.clear();
+    lru_.clear();
+}
+
+uint64_t KRRichTextMeasureCache::HashDouble(double value) {
+    uint64_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return Mix(bits);
+}
+
+uint64_t KRRichTextMeasureCache::Combine(uint64_t seed, uint64_t value) {
+    return Mix(seed ^ (value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2)));
+}
+
+uint64_t KRRichTextMeasureCache::HashContent(const std::string &content) {
+    return Mix(std::hash<std::string>()(content));
+}
+
+void KRRichTextMeasureCache::AppendMap(const KRRenderValue::Map &map, std::string &out) {
+    // unordered_map 遍历顺序不稳定，按 key 排序后再序列化
+    std::vector<const KRRenderValue::Map::value_type *> entries;
+    entries.reserve(map.size());
+    for (const auto &it : map) {
+        entries.push_back(&it);
+    }
+    std::sort(entries.begin(), entries.end(), [](const auto *a, const auto *b) { return a->first < b->first; });
+    out += '{';
+    AppendRaw(entries.size(), out);
+    for (const auto *entry : entries) {
+        AppendString(entry->first, out);
+        AppendValue(entry->second, out);
+    }
+}
+
+void KRRichTextMeasureCache::AppendValue(const KRAnyValue &value, std::string &out) {
+    if (value == nullptr || value->isNull()) {
+        out += 'n';
+        return;
+    }
+    if (value->isString()) {
+        out += 's';
+        AppendString(value->toString(), out);
+        return;
+    }
+    if (value->isBool()) {
+        out += value->toBool() ? 't' : 'f';
+        return;
+    }
+    if (value->isInt() || value->isLong()) {
+        out += 'i';
+        AppendRaw(value->toLong(), out);
+        return;
+    }
+    if (value->isFloat() || value->isDouble()) {
+        out += 'd';
+        AppendRaw(value->toDouble(), out);
+        return;
+    }
+    if (value->isMap()) {
+        AppendMap(value->toMap(), out);
+        return;
+    }
+    if (value->isArray()) {
+        const auto &array = value->toArray();
+        out += '[';
+        AppendRaw(array.size(), out);
+        for (const auto &item : array) {
+            AppendValue(item, out);
+        }
+        return;
+    }
+    out += 'o';
+    AppendString(value->toString(), out);
+}
@@ -0,0 +1,99 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 THL A29 Limited, a Tencent company. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRRICHTEXTMEASURECACHE_H
+#define CORE_RENDER_OHOS_KRRICHTEXTMEASURECACHE_H
+
+#include <native_drawing/drawing_text_typography.h>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include "libohos_render/foundation/KRCommon.h"
+#include "libohos_render/foundation/KRSize.h"
+
+/**
+ * 文本测量缓存的 key：span 属性内容 + 约束尺寸 + 影响排版的全局参数
+ * 哈希只用于分桶，相等比较时逐字节比较内容，避免哈希碰撞时复用错误的测量结果
+ */
+struct KRRichTextMeasureKey {
+    std::shared_ptr<const std::string> content;  // 属性内容的规范序列化，由 AppendValue 生成
+    uint64_t content_hash = 0;
+    double dpi = 0;
+    double font_size_scale = 0;
+    double font_weight_scale = 0;
+    double constraint_width = 0;
+    double constraint_height = 0;
+
+    bool operator==(const KRRichTextMeasureKey &other) const {
+        if (content_hash != other.content_hash || dpi != other.dpi || font_size_scale != other.font_size_scale ||
+            font_weight_scale != other.font_weight_scale || constraint_width != other.constraint_width ||
+            constraint_height != other.constraint_height) {
+            return false;
+        }
+        if (content == other.content) {
+            return true;
+        }
+        return content != nullptr && other.content != nullptr && *content == *other.content;
+    }
+};
+
+struct KRRichTextMeasureKeyHash {
+    size_t operator()(const KRRichTextMeasureKey &key) const;
+};
+
+/**
+ * 文本测量结果（不包含 typography，typography 会在主线程按 view 宽度重新排版，不能跨 shadow 共享）
+ */
+struct KRRichTextMeasureResult {
+    KRSize size;
+    float draw_offset_y = 0;
+    OH_Drawing_TextAlign text_align = TEXT_ALIGN_LEFT;
+};
+
+/**
+ * 进程级有界 LRU 文本测量缓存，列表中重复的文本 cell 可直接复用测量结果
+ */
+class KRRichTextMeasureCache {
+ public:
+    static KRRichTextMeasureCache &GetInstance();
+
+    bool Get(const KRRichTextMeasureKey &key, KRRichTextMeasureResult &result);
+    void Put(const KRRichTextMeasureKey &key, const KRRichTextMeasureResult &result);
+    void Clear();
+
+    /**
+     * 将属性值规范序列化追加到 out，Map 按 key 排序，结果与遍历顺序无关
+     */
+    static void AppendValue(const KRAnyValue &value, std::string &out);
+    static void AppendMap(const KRRenderValue::Map &map, std::string &out);
+    static uint64_t HashContent(const std::string &content);
+    static uint64_t HashDouble(double value);
+    static uint64_t Combine(uint64_t seed, uint64_t value);
+
+ private:
+    KRRichTextMeasureCache() = default;
+
+    static constexpr size_t kMaxEntries = 512;
+
+    using Entry = std::pair<KRRichTextMeasureKey, KRRichTextMeasureResult>;
+    std::list<Entry> lru_;
+    std::unordered_map<KRRichTextMeasureKey, std::list<Entry>::iterator, KRRichTextMeasureKeyHash> index_;
+    std::mutex mutex_;
+};
+
+#endif  // CORE_RENDER_OHOS_KRRICHTEXTMEASURECACHE_H
@@ -24,6 +24,8 @@
 
 #include <cassert>
 #include <codecvt>
+#include <map>
+#include <tuple>
 #include <unordered_set>
 
 #include "libohos_render/utils/KRConvertUtil.h"
@@ -38,6 +40,12 @@ template <class Facet> struct deletable_facet : Facet {
 
 constexpr char kRawFilePrefix[] = "rawfile:";
 
+// fontSize, fontWeight, color, fontFamily, lineHeight, lineSpacing, decoration, fontStyle, letterSpacing,
+// textShadow, strokeWidth, strokeColor
+using KRTextStyleKey =
+    std::tuple<double, OH_Drawing_FontWeight, uint32_t, std::string, double, double, OH_Drawing_TextDecoration,
+               OH_Drawing_FontStyle, double, std::string, float, uint32_t>;
+
 static bool isRawFilePath(const std::string &src) {
     return src.find(kRawFilePrefix) == 0;
 }
@@ -55,6 +63,7 @@ KRRichTextShadow::~KRRichTextShadow() {
  * @param prop_value 属性数据
  */
 void KRRichTextShadow::SetProp(const std::string &prop_key, const KRAnyValue &prop_value) {
+    content_dirty_ = true;
     if (prop_key == "values") {
         values_ = prop_value->toArray();
         return;
@@ -82,16 +91,91 @@ KRAnyValue KRRichTextShadow::Call(const std::string &method_name, const std::str
  * @return
  */
 KRSize KRRichTextShadow::CalculateRenderViewSize(double constraint_width, double constraint_height) {
+    KRRichTextMeasureKey key;
+    if (!MakeMeasureKey(constraint_width, constraint_height, key)) {
+        has_last_measure_ = false;
+        ReleaseLastTypography();
+        BuildTextTypography(constraint_width, constraint_height);
+        return context_measure_size_;
+    }
+    auto extra_hash = ExtraMeasureHash();
+    if (has_last_measure_ && last_measure_key_ == key && last_extra_hash_ == extra_hash) {
+        // 内容与约束均未变化，直接复用已排版的 typography
+        return context_measure_size_;
+    }
     ReleaseLastTypography();
+    last_measure_key_ = key;
+    last_extra_hash_ = extra_hash;
+    has_last_measure_ = true;
+
+    auto &cache = KRRichTextMeasureCache::GetInstance();
+    KRRichTextMeasureResult result;
+    if (cache.Get(key, result)) {
+        context_measure_size_ = result.size;
+        context_thread_drawOffsetY_ = result.draw_offset_y;
+        context_thread_text_align_ = result.text_align;
+        return context_measure_size_;
+    }
     BuildTextTypography(constraint_width, constraint_height);
+    if (context_thread_typography_ != nullptr) {
+        result.size = context_measure_size_;
+        result.draw_offset_y = context_thread_drawOffsetY_;
+        result.text_align = context_thread_text_align_;
+        cache.Put(key, result);
+    }
     return context_measure_size_;
 }
 
+bool KRRichTextShadow::MakeMeasureKey(double constraint_width, double constraint_height, KRRichTextMeasureKey &key) {
+    auto config = config_.lock();
+    if (config == nullptr) {
+        // 仅首次测量时经 rootView 取 config，之后直接持有 config 的弱引用，命中缓存时无需再抛主线程
+        auto rootView = GetRootView().lock();
+        if (rootView == nullptr) {
+            return false;
+        }
+        config = rootView->GetContext()->Config();
+        config_ = config;
+        // rootView 可能是最后一个持有者，需回到主线程释放
+        KRMainThread::RunOnMainThread([rootView] { rootView.get(); });
+        if (config == nullptr) {
+            return false;
+        }
+    }
+
+    if (content_dirty_) {
+        auto content = std::make_shared<std::string>();
+        KRRichTextMeasureCache::AppendMap(props_, *content);
+        for (const auto &span : values_) {
+            KRRichTextMeasureCache::AppendValue(span, *content);
+        }
+        content_hash_ = KRRichTextMeasureCache::HashContent(*content);
+        content_ = std::move(content);
+        content_dirty_ = false;
+    }
+    key.content = content_;
+    key.content_hash = content_hash_;
+    key.dpi = KRConfig::GetDpi();
+    key.font_size_scale = config->GetFontSizeScale();
+    key.font_weight_scale = config->GetFontWeightScale();
+    key.constraint_width = constraint_width;
+    key.constraint_height = constraint_height;
+    return true;
+}
+
+void KRRichTextShadow::EnsureTypography() {
+    if (context_thread_typography_ != nullptr || !has_last_measure_) {
+        return;
+    }
+    BuildTextTypography(last_measure_key_.constraint_width, last_measure_key_.constraint_height);
+}
+
 /**
  * 将要SetShadow调用
  * @return
  */
 KRSchedulerTask KRRichTextShadow::TaskToMainQueueWhenWillSetShadowToView() {
+    EnsureTypography();
     auto self = shared_from_this();
     auto typography = context_thread_typography_;
     auto offsetY = context_thread_drawOffsetY_;
@@ -130,46 +214,56 @@ KRFontCollectionWrapper::~KRFontCollectionWrapper() {
     }
 }
 
+std::shared_ptr<KRFontCollectionWrapper> KRFontCollectionWrapper::Shared() {
+    static std::shared_ptr<KRFontCollectionWrapper> instance = std::make_shared<KRFontCollectionWrapper>();
+    return instance;
+}
+
 void SetCustomFontIfApplicable(NativeResourceManager *resMgr, std::shared_ptr<struct KRFontCollectionWrapper> wrapper,
-                               const std::string &fontFamily,
-                               const std::unordered_map<std::string, KRFontAdapter> &fontAdapters) {
-    auto adapter = fontAdapters.find(fontFamily);
-    if (adapter != fontAdapters.end() && wrapper->registered.find(fontFamily) == wrapper->registered.end()) {
-        char *fontBuffer = nullptr;
-        size_t len = 0;
-        KRFontDataDeallocator deallocator = nullptr;
-        char *fontSrc = adapter->second(fontFamily.c_str(), &fontBuffer, &len, &deallocator);
-        if (fontSrc) {
-            uint32_t error = 0;
-            auto fontStrString = std::string(fontSrc);
-            if (isRawFilePath(std::string(fontSrc))) {
-                auto newRawPath = fontStrString.substr(strlen(kRawFilePrefix));
-                RawFile *rawFile = OH_ResourceManager_OpenRawFile(resMgr, newRawPath.c_str());
+                               const std::string &fontFamily) {
+    std::lock_guard<std::mutex> lock(wrapper->mutex);
+    if (wrapper->registered.find(fontFamily) != wrapper->registered.end()) {
+        return;
+    }
+    auto adapter = KRFontAdapterManager::GetInstance()->GetAdapter(fontFamily);
+    if (adapter == nullptr) {
+        return;
+    }
+    char *fontBuffer = nullptr;
+    size_t len = 0;
+    KRFontDataDeallocator deallocator = nullptr;
+    char *fontSrc = adapter(fontFamily.c_str(), &fontBuffer, &len, &deallocator);
+    if (fontSrc) {
+        uint32_t error = 1;
+        auto fontStrString = std::string(fontSrc);
+        if (isRawFilePath(fontStrString)) {
+            auto newRawPath = fontStrString.substr(strlen(kRawFilePrefix));
+            RawFile *rawFile = OH_ResourceManager_OpenRawFile(resMgr, newRawPath.c_str());
+            if (rawFile != nullptr) {
                 long len = OH_ResourceManager_GetRawFileSize(rawFile);
                 std::unique_ptr<uint8_t[]> data = std::make_unique<uint8_t[]>(len);
                 int res = OH_ResourceManager_ReadRawFile(rawFile, data.get(), len);
                 OH_ResourceManager_CloseRawFile(rawFile);
                 error = OH_Drawing_RegisterFontBuffer(wrapper->fontCollection, fontFamily.c_str(), data.get(), len);
-            } else {
-                error = OH_Drawing_RegisterFont(wrapper->fontCollection, fontFamily.c_str(), fontSrc);
-            }
-            if (error == 0) {
-                wrapper->registered.emplace(fontFamily);
             }
+        } else {
+            error = OH_Drawing_RegisterFont(wrapper->fontCollection, fontFamily.c_str(), fontSrc);
+        }
+        if (error == 0) {
+            wrapper->registered.emplace(fontFamily);
+        }
 
-            if (deallocator) {
-                deallocator(fontSrc);
-            }
-        } else if (fontBuffer != nullptr && len > 0) {
-            uint32_t error =
-                OH_Drawing_RegisterFontBuffer(wrapper->fontCollection, fontFamily.c_str(),
-                                              reinterpret_cast<uint8_t *>(fontBuffer), len);
-            if (error == 0) {
-                wrapper->registered.emplace(fontFamily);
-            }
-            if (deallocator) {
-                deallocator(fontBuffer);
-            }
+        if (deallocator) {
+            deallocator(fontSrc);
+        }
+    } else if (fontBuffer != nullptr && len > 0) {
+        uint32_t error = OH_Drawing_RegisterFontBuffer(wrapper->fontCollection, fontFamily.c_str(),
+                                                       reinterpret_cast<uint8_t *>(fontBuffer), len);
+        if (error == 0) {
+            wrapper->registered.emplace(fontFamily);
+        }
+        if (deallocator) {
+            deallocator(fontBuffer);
         }
     }
 }
@@ -237,13 +331,13 @@ OH_Drawing_Typography *KRRichTextShadow::BuildTextTypography(double constraint_w
     double dpi = KRConfig::GetDpi();
     OH_Drawing_TypographyStyle *typoStyle = nullptr;
     OH_Drawing_TypographyCreate *handler = nullptr;
-    bool isFirst = true;
+    std::map<KRTextStyleKey, OH_Drawing_TextStyle *> textStyles;
+    OH_Drawing_TextStyle *pushedStyle = nullptr;
     int spanIndex = 0;
     int placeholder_count = 0;
     OH_Drawing_TextAlign text_align = TEXT_ALIGN_LEFT;
     int charOffset = 0;
-    font_collection_wrapper_ = std::make_shared<KRFontCollectionWrapper>();
-    auto fontAdapters = KRFontAdapterManager::GetInstance()->AllAdapters();
+    font_collection_wrapper_ = KRFontCollectionWrapper::Shared();
     for (auto span : spans) {
         auto spanMap = span->toMap();
         auto fontSize = (GetKRValue("fontSize", spanMap, props_)->toFloat() ?: 15.0) * dpi * fontSizeScale;
@@ -296,71 +390,86 @@ OH_Drawing_Typography *KRRichTextShadow::BuildTextTypography(double constraint_w
             }
 
             handler = OH_Drawing_CreateTypographyHandler(typoStyle, font_collection_wrapper_->fontCollection);
-        } else {
-            isFirst = false;
         }
         auto placeholderWidth = GetKRValue("placeholderWidth", spanMap, spanMap)->toDouble();
-        // 创建文本样式对象txtStyle
-        OH_Drawing_TextStyle *txtStyle = OH_Drawing_CreateTextStyle();
-        OH_Drawing_Pen *textForegroundPen = nullptr;
-        OH_Drawing_Brush *textForegroundBrush = OH_Drawing_BrushCreate();
-        // 设置文字大小、字重等属性设置到文本样式对象中
-        OH_Drawing_SetTextStyleColor(txtStyle, color);
-        if (textShadowStr.length()) {
-            auto textShadow = OH_Drawing_CreateTextShadow();
-            kuikly::util::SetTextShadow(textShadow, textShadowStr);
-            OH_Drawing_TextStyleAddShadow(txtStyle, textShadow);
-            OH_Drawing_DestroyTextShadow(textShadow);
+        if (lineSpacing <= 0 && lineHeight > 0) {
+            lineHeight = std::max(lineHeight, 1.0);
+            context_thread_drawOffsetY_ = (fontSize * lineHeight - fontSize) / 4;  // cai系统绘制存在偏移问题，手动校准
         }
-        if (strokeColorStr.length() && strokeWidth > 0) {
-            if (textForegroundPen == nullptr) {
+        // 样式完全相同的 span 复用同一个文本样式对象，相邻相同时也无需重新 push
+        KRTextStyleKey styleKey(fontSize, fontWeight, color, fontFamily, lineHeight, lineSpacing, textDecoration,
+                                fontStyle, letterSpacing, textShadowStr, strokeWidth,
+                                strokeColorStr.length() ? strokeColor : 0);
+        OH_Drawing_TextStyle *txtStyle = nullptr;
+        auto cachedStyle = textStyles.find(styleKey);
+        if (cachedStyle != textStyles.end()) {
+            txtStyle = cachedStyle->second;
+        } else {
+            // 创建文本样式对象txtStyle
+            txtStyle = OH_Drawing_CreateTextStyle();
+            OH_Drawing_Pen *textForegroundPen = nullptr;
+            OH_Drawing_Brush *textForegroundBrush = OH_Drawing_BrushCreate();
+            // 设置文字大小、字重等属性设置到文本样式对象中
+            OH_Drawing_SetTextStyleColor(txtStyle, color);
+            if (textShadowStr.length()) {
+                auto textShadow = OH_Drawing_CreateTextShadow();
+                kuikly::util::SetTextShadow(textShadow, textShadowStr);
+                OH_Drawing_TextStyleAddShadow(txtStyle, textShadow);
+                OH_Drawing_DestroyTextShadow(textShadow);
+            }
+            if (strokeColorStr.length() && strokeWidth > 0) {
                 textForegroundPen = OH_Drawing_PenCreate();
                 OH_Drawing_PenSetAntiAlias(textForegroundPen, true);
+                OH_Drawing_PenSetColor(textForegroundPen, strokeColor);
+                OH_Drawing_PenSetWidth(textForegroundPen, strokeWidth);
             }
-            OH_Drawing_PenSetColor(textForegroundPen, strokeColor);
-            OH_Drawing_PenSetWidth(textForegroundPen, strokeWidth);
-        }
 
-        if (textForegroundPen) {
-            OH_Drawing_SetTextStyleForegroundPen(txtStyle, textForegroundPen);
-        }
-        if (textForegroundBrush) {
-            OH_Drawing_BrushSetColor(textForegroundBrush, color);
-            OH_Drawing_SetTextStyleForegroundBrush(txtStyle, textForegroundBrush);
-        }
-        OH_Drawing_SetTextStyleFontSize(txtStyle, fontSize);
-        OH_Drawing_SetTextStyleFontWeight(txtStyle, fontWeight);
-        OH_Drawing_SetTextStyleBaseLine(txtStyle, TEXT_BASELINE_ALPHABETIC);
-        OH_Drawing_SetTextStyleDecoration(txtStyle, textDecoration);
-        OH_Drawing_SetTextStyleFontStyle(txtStyle, fontStyle);
-        if (letterSpacing > 0) {
-            OH_Drawing_SetTextStyleLetterSpacing(txtStyle, letterSpacing * dpi);
-        }
-        if (lineSpacing > 0) {
-            OH_Drawing_SetTextStyleFontHeight(txtStyle, lineSpacing + std::max(lineHeight, 1.0));
-        } else if (lineHeight > 0) {
-            lineHeight = std::max(lineHeight, 1.0);
-            OH_Drawing_SetTextStyleFontHeight(txtStyle, lineHeight);
-            context_thread_drawOffsetY_ = (fontSize * lineHeight - fontSize) / 4;  // cai系统绘制存在偏移问题，手动校准
-        }
-        // fontFamily
-        if (!fontFamily.empty()) {
-            const char *fontFamilyPtr = fontFamily.c_str();
-            const char *fontFamilies[] = {fontFamilyPtr};
-            OH_Drawing_SetTextStyleFontFamilies(txtStyle, 1, fontFamilies);
-            auto rootView = GetRootView();
-            auto rootViewLock = rootView.lock();
-            auto nativeResMgr = rootViewLock->GetNativeResourceManager();
-            SetCustomFontIfApplicable(nativeResMgr, font_collection_wrapper_, fontFamily, fontAdapters);
+            if (textForegroundPen) {
+                OH_Drawing_SetTextStyleForegroundPen(txtStyle, textForegroundPen);
+            }
+            if (textForegroundBrush) {
+                OH_Drawing_BrushSetColor(textForegroundBrush, color);
+                OH_Drawing_SetTextStyleForegroundBrush(txtStyle, textForegroundBrush);
+            }
+            OH_Drawing_SetTextStyleFontSize(txtStyle, fontSize);
+            OH_Drawing_SetTextStyleFontWeight(txtStyle, fontWeight);
+            OH_Drawing_SetTextStyleBaseLine(txtStyle, TEXT_BASELINE_ALPHABETIC);
+            OH_Drawing_SetTextStyleDecoration(txtStyle, textDecoration);
+            OH_Drawing_SetTextStyleFontStyle(txtStyle, fontStyle);
+            if (letterSpacing > 0) {
+                OH_Drawing_SetTextStyleLetterSpacing(txtStyle, letterSpacing * dpi);
+            }
+            if (lineSpacing > 0) {
+                OH_Drawing_SetTextStyleFontHeight(txtStyle, lineSpacing + std::max(lineHeight, 1.0));
+            } else if (lineHeight > 0) {
+                OH_Drawing_SetTextStyleFontHeight(txtStyle, lineHeight);
+            }
+            // fontFamily
+            if (!fontFamily.empty()) {
+                const char *fontFamilyPtr = fontFamily.c_str();
+                const char *fontFamilies[] = {fontFamilyPtr};
+                OH_Drawing_SetTextStyleFontFamilies(txtStyle, 1, fontFamilies);
+                SetCustomFontIfApplicable(rootView->GetNativeResourceManager(), font_collection_wrapper_, fontFamily);
+            }
+            OH_Drawing_SetTextStyleFontStyle(txtStyle, FONT_STYLE_NORMAL);
+            OH_Drawing_SetTextStyleLocale(txtStyle, "en");
+            DidBuildTextStyle(txtStyle, dpi);
+            if (textForegroundPen) {
+                OH_Drawing_PenDestroy(textForegroundPen);
+            }
+            if (textForegroundBrush) {
+                OH_Drawing_BrushDestroy(textForegroundBrush);
+            }
+            textStyles.emplace(std::move(styleKey), txtStyle);
         }
-        OH_Drawing_SetTextStyleFontStyle(txtStyle, FONT_STYLE_NORMAL);
-        OH_Drawing_SetTextStyleLocale(txtStyle, "en");
         // 将文本样式对象加入到handler中
-        if (!isFirst) {
-            OH_Drawing_TypographyHandlerPopTextStyle(handler);
+        if (txtStyle != pushedStyle) {
+            if (pushedStyle != nullptr) {
+                OH_Drawing_TypographyHandlerPopTextStyle(handler);
+            }
+            OH_Drawing_TypographyHandlerPushTextStyle(handler, txtStyle);
+            pushedStyle = txtStyle;
         }
-        DidBuildTextStyle(txtStyle, dpi);
-        OH_Drawing_TypographyHandlerPushTextStyle(handler, txtStyle);
         if (placeholderWidth != 0) {  // 添加占位Span
             auto placeholderHeight = GetKRValue("placeholderHeight", spanMap, spanMap)->toDouble();
             OH_Drawing_PlaceholderSpan inlineView = {
@@ -381,17 +490,11 @@ OH_Drawing_Typography *KRRichTextShadow::BuildTextTypography(double constraint_w
             span_offsets_.emplace_back(std::tuple(spanIndex, charOffset, charOffset + codePointCount));
             charOffset += codePointCount;
         }
-        OH_Drawing_DestroyTextStyle(txtStyle);
-        if (textForegroundPen) {
-            OH_Drawing_PenDestroy(textForegroundPen);
-            textForegroundPen = nullptr;
-        }
-        if (textForegroundBrush) {
-            OH_Drawing_BrushDestroy(textForegroundBrush);
-            textForegroundBrush = nullptr;
-        }
         spanIndex++;
     }
+    for (auto &it : textStyles) {
+        OH_Drawing_DestroyTextStyle(it.second);
+    }
     // 根据handler对象生成文本排版布局typography
     context_thread_typography_ = OH_Drawing_CreateTypography(handler);
     if (constraint_width == 0) {
@@ -449,6 +552,7 @@ void KRRichTextShadow::ReleaseLastTypography() {
  * 调用获取Span位置方法
  */
 KRAnyValue KRRichTextShadow::SpanRect(int spanIndex) {
+    EnsureTypography();
     if (placeholder_index_map_.find(spanIndex) != placeholder_index_map_.end()) {
         auto placeholderIndex = placeholder_index_map_[spanIndex];
         auto placeholderRects = OH_Drawing_TypographyGetRectsForPlaceholders(context_thread_typography_);
@@ -468,29 +572,40 @@ KRAnyValue KRRichTextShadow::SpanRect(int spanIndex) {
 }
 
 int KRRichTextShadow::SpanIndexAt(float spanX, float spanY) {
-    int resultIndex = -1;
-    for (int index = 0; index < span_offsets_.size(); ++index) {
-        int lastSpanIndex = std::get<0>(span_offsets_[index]);
-        int lastSpanBegin = std::get<1>(span_offsets_[index]);
-        int lastSpanEnd = std::get<2>(span_offsets_[index]);
-        OH_Drawing_TextBox *box = OH_Drawing_TypographyGetRectsForRange(
-            main_thread_typography_, lastSpanBegin, lastSpanEnd, RECT_HEIGHT_STYLE_MAX, RECT_WIDTH_STYLE_MAX);
+    EnsureHitIndex();
+    return hit_index_.HitTest(spanX, spanY);
+}
+
+void KRRichTextShadow::EnsureHitIndex() {
+    if (main_thread_typography_ == nullptr) {
+        hit_index_.Clear();
+        hit_index_typography_ = nullptr;
+        return;
+    }
+    double layout_width = OH_Drawing_TypographyGetMaxWidth(main_thread_typography_);
+    if (hit_index_typography_ == main_thread_typography_ && hit_index_layout_width_ == layout_width) {
+        return;
+    }
+    hit_index_.Clear();
+    hit_index_typography_ = main_thread_typography_;
+    hit_index_layout_width_ = layout_width;
+    auto dpi = KRConfig::GetDpi();
+    for (const auto &span_offset : span_offsets_) {
+        int spanIndex = std::get<0>(span_offset);
+        OH_Drawing_TextBox *box =
+            OH_Drawing_TypographyGetRectsForRange(main_thread_typography_, std::get<1>(span_offset),
+                                                  std::get<2>(span_offset), RECT_HEIGHT_STYLE_MAX, RECT_WIDTH_STYLE_MAX);
+        if (box == nullptr) {
+            continue;
+        }
         int n = OH_Drawing_GetSizeOfTextBox(box);
-        auto dpi = KRConfig::GetDpi();
         for (int boxIndex = 0; boxIndex < n; ++boxIndex) {
-            float left = OH_Drawing_GetLeftFromTextBox(box, boxIndex) / dpi;
-            float right = OH_Drawing_GetRightFromTextBox(box, boxIndex) / dpi;
-            float top = OH_Drawing_GetTopFromTextBox(box, boxIndex) / dpi;
-            float bottom = OH_Drawing_GetBottomFromTextBox(box, boxIndex) / dpi;
-            if (spanX < left || spanX >= right || spanY < top || spanY >= bottom) {
-                continue;
-            }
-            resultIndex = lastSpanIndex;
-            break;
-        }
-        if (resultIndex != -1) {
-            break;
+            hit_index_.AddRun(spanIndex, OH_Drawing_GetLeftFromTextBox(box, boxIndex) / dpi,
+                              OH_Drawing_GetTopFromTextBox(box, boxIndex) / dpi,
+                              OH_Drawing_GetRightFromTextBox(box, boxIndex) / dpi,
+                              OH_Drawing_GetBottomFromTextBox(box, boxIndex) / dpi);
         }
+        OH_Drawing_TypographyDestroyTextBox(box);
     }
-    return resultIndex;
+    hit_index_.Build();
 }
@@ -19,15 +19,24 @@
 #include <native_drawing/drawing_text_declaration.h>
 #include <native_drawing/drawing_text_typography.h>
 #include <native_drawing/drawing_types.h>
+#include <mutex>
 #include <unordered_set>
 #include "libohos_render/expand/components/richtext/KRFontAdapterManager.h"
+#include "libohos_render/expand/components/richtext/KRRichTextHitIndex.h"
+#include "libohos_render/expand/components/richtext/KRRichTextMeasureCache.h"
 #include "libohos_render/export/IKRRenderShadowExport.h"
+#include "libohos_render/foundation/KRConfig.h"
 
 struct KRFontCollectionWrapper {
     KRFontCollectionWrapper();
     ~KRFontCollectionWrapper();
+    /**
+     * 进程共享的字体集合，自定义字体只在首次使用时注册一次
+     */
+    static std::shared_ptr<KRFontCollectionWrapper> Shared();
     OH_Drawing_FontCollection *fontCollection;
     std::unordered_set<std::string> registered;
+    std::mutex mutex;
 };
 
 class KRRichTextShadow : public IKRRenderShadowExport {
@@ -64,6 +73,13 @@ class KRRichTextShadow : public IKRRenderShadowExport {
      */
     virtual void DidBuildTextStyle(OH_Drawing_TextStyle *textStyle, double dpi) {}
 
+    /**
+     * 子类中影响 typography 构建（但不影响测量尺寸）的额外状态哈希，参与 shadow 内的测量缓存命中判断
+     */
+    virtual uint64_t ExtraMeasureHash() const {
+        return 0;
+    }
+
     /**
      * 将要SetShadow调用
      * @return
@@ -92,6 +108,7 @@ class KRRichTextShadow : public IKRRenderShadowExport {
 
     void SetMainThreadTypography(OH_Drawing_Typography *typography) {
         main_thread_typography_ = typography;
+        hit_index_typography_ = nullptr;
     }
 
  private:
@@ -115,7 +132,21 @@ class KRRichTextShadow : public IKRRenderShadowExport {
     std::vector<std::tuple<int, int, int>> span_offsets_;  // span, begin, end
     std::shared_ptr<struct KRFontCollectionWrapper> font_collection_wrapper_;
 
+    // 测量缓存
+    std::shared_ptr<const std::string> content_;
+    uint64_t content_hash_ = 0;
+    bool content_dirty_ = true;
+    std::weak_ptr<KRConfig> config_;
+    bool has_last_measure_ = false;
+    KRRichTextMeasureKey last_measure_key_;
+    uint64_t last_extra_hash_ = 0;
+
     OH_Drawing_Typography *BuildTextTypography(double constraint_width, double constraint_height);
+    /**
+     * 命中全局测量缓存时未构建 typography，在真正需要时按上次约束补建
+     */
+    void EnsureTypography();
+    bool MakeMeasureKey(double constraint_width, double constraint_height, KRRichTextMeasureKey &key);
 
     void ReleaseLastTypography();
     /**
@@ -125,11 +156,20 @@ class KRRichTextShadow : public IKRRenderShadowExport {
 
     int SpanIndexAt(float x, float y);
 
+    /**
+     * 主线程 typography 变化或重新排版后重建命中索引
+     */
+    void EnsureHitIndex();
+
+    // 主线程命中索引
+    KRRichTextHitIndex hit_index_;
+    OH_Drawing_Typography *hit_index_typography_ = nullptr;
+    double hit_index_layout_width_ = 0;
+
     friend class KRRichTextView;
 };
 
 void SetCustomFontIfApplicable(NativeResourceManager *resMgr, std::shared_ptr<struct KRFontCollectionWrapper> wrapper,
-                               const std::string &fontFamily,
-                               const std::unordered_map<std::string, KRFontAdapter> &fontAdapters);
+                               const std::string &fontFamily);
 
 #endif  // CORE_RENDER_OHOS_KRRICHTEXTSHADOW_H
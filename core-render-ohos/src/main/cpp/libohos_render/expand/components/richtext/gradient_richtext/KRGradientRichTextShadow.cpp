@@ -53,6 +53,12 @@ KRSize KRGradientRichTextShadow::CalculateRenderViewSize(double constraint_width
     return size;
 }
 
+uint64_t KRGradientRichTextShadow::ExtraMeasureHash() const {
+    uint64_t hash = reinterpret_cast<uintptr_t>(text_linearGradient_.get());
+    hash = KRRichTextMeasureCache::Combine(hash, KRRichTextMeasureCache::HashDouble(calculate_width_));
+    return KRRichTextMeasureCache::Combine(hash, KRRichTextMeasureCache::HashDouble(calculate_height_));
+}
+
 void KRGradientRichTextShadow::DidBuildTextStyle(OH_Drawing_TextStyle *textStyle, double dpi) {
     if (calculate_width_ != 0 && calculate_height_ != 0 && text_linearGradient_ != nullptr) {
         // 文字渐变
@@ -39,6 +39,11 @@ class KRGradientRichTextShadow : public KRRichTextShadow {
      */
     void DidBuildTextStyle(OH_Drawing_TextStyle *textStyle, double dpi) override;
 
+    /**
+     * 渐变画刷依赖渐变参数与首次测量尺寸
+     */
+    uint64_t ExtraMeasureHash() const override;
+
  private:
     std::shared_ptr<kuikly::util::KRLinearGradientParser> text_linearGradient_;
     double calculate_width_ = 0.0;
@@ -16,26 +16,14 @@
 #include "libohos_render/expand/components/scroller/KRScrollerView.h"
 
 #include "libohos_render/expand/components/view/KRView.h"
+#include "libohos_render/foundation/thread/KRMainThread.h"
 #include "libohos_render/foundation/type/KRRenderValue.h"
 #include "libohos_render/utils/KRJSONObject.h"
 
-constexpr char kPropNameDirectionRow[] = "directionRow";
-constexpr char kPropNamePagingEnabled[] = "pagingEnabled";
-constexpr char kPropNameScrollEnabled[] = "scrollEnabled";
-constexpr char kPropNameVerticalBounces[] = "verticalbounces";
-constexpr char kPropNameHorizontalBounces[] = "horizontalbounces";
-constexpr char kPropNameBouncesEnable[] = "bouncesEnable";
-constexpr char kPropNameLimitHeaderBounces[] = "limitHeaderBounces";
-constexpr char kPropNameShowScrollerIndicator[] = "showScrollerIndicator";
-constexpr char kPropNameNestedScroll[] = "nestedScroll";
 constexpr char kPropKeyNestedScrollForward[] = "forward";
 constexpr char kPropKeyNestedScrollBackward[] = "backward";
 
 constexpr char kEventNameScroll[] = "scroll";
-constexpr char kEventNameDragBegin[] = "dragBegin";
-constexpr char kEventNameWillDragEnd[] = "willDragEnd";
-constexpr char kEventNameDragEnd[] = "dragEnd";
-constexpr char kEventNameScrollEnd[] = "scrollEnd";
 constexpr char kEventKeyOffsetX[] = "offsetX";
 constexpr char kEventKeyOffsetY[] = "offsetY";
 constexpr char kEventKeyContentWidth[] = "contentWidth";
@@ -82,13 +70,6 @@ void KRScrollerContentView::DidInsertSubRenderView(const std::shared_ptr<IKRRend
     }
 }
 
-bool isBouncesEnableProp(const std::string &prop_key) {
-    auto prop_key_c_str = prop_key.c_str();
-    return std::strcmp(prop_key_c_str, kPropNameVerticalBounces) == 0 ||
-           std::strcmp(prop_key_c_str, kPropNameHorizontalBounces) == 0 ||
-           std::strcmp(prop_key_c_str, kPropNameBouncesEnable) == 0;
-}
-
 void KRScrollerView::SetRenderViewFrame(const KRRect &frame) {
     IKRRenderViewExport::SetRenderViewFrame(frame);
     if (!is_set_frame_) {
@@ -124,30 +105,47 @@ void KRScrollerView::DidInit() {
 bool KRScrollerView::SetProp(const std::string &prop_key, const KRAnyValue &prop_value,
                              const KRRenderCallback event_call_back) {
     auto didHanded = false;
-    if (std::strcmp(prop_key.c_str(), kPropNameDirectionRow) == 0) {
-        didHanded = SetScrollDirection(prop_value);
-    } else if (std::strcmp(prop_key.c_str(), kPropNamePagingEnabled) == 0) {
-        didHanded = SetPagingEnabled(prop_value);
-    } else if (std::strcmp(prop_key.c_str(), kEventNameScroll) == 0) {
-        didHanded = RegisterOnScrollEvent(event_call_back);
-    } else if (std::strcmp(prop_key.c_str(), kPropNameScrollEnabled) == 0) {
-        didHanded = SetScrollEnabled(prop_value);
-    } else if (isBouncesEnableProp(prop_key)) {
-        didHanded = SetBouncesEnable(prop_value);
-    } else if (std::strcmp(prop_key.c_str(), kPropNameShowScrollerIndicator) == 0) {
-        didHanded = SetShowScrollerIndicator(prop_value);
-    } else if (kuikly::util::isEqual(prop_key, kEventNameDragBegin)) {
-        didHanded = RegisterOnDragBeginEvent(event_call_back);
-    } else if (kuikly::util::isEqual(prop_key, kEventNameDragEnd)) {
-        didHanded = RegisterOnDragEndEvent(event_call_back);
-    } else if (kuikly::util::isEqual(prop_key, kEventNameScrollEnd)) {
-        didHanded = RegisterOnScrollEndEvent(event_call_back);
-    } else if (kuikly::util::isEqual(prop_key, kEventNameWillDragEnd)) {
-        didHanded = RegisterWillDragEndEvent(event_call_back);
-    } else if (kuikly::util::isEqual(prop_key, kPropNameLimitHeaderBounces)) {
-        didHanded = SetLimitHeaderBounces(prop_value);
-    } else if (kuikly::util::isEqual(prop_key, kPropNameNestedScroll)) {
-        didHanded = SetNestedScroll(prop_value);
+    switch (KRGetPropKeyId(prop_key)) {
+        case KRPropKeyId::kDirectionRow:
+            didHanded = SetScrollDirection(prop_value);
+            break;
+        case KRPropKeyId::kPagingEnabled:
+            didHanded = SetPagingEnabled(prop_value);
+            break;
+        case KRPropKeyId::kScroll:
+            didHanded = RegisterOnScrollEvent(event_call_back);
+            break;
+        case KRPropKeyId::kScrollEnabled:
+            didHanded = SetScrollEnabled(prop_value);
+            break;
+        case KRPropKeyId::kVerticalBounces:
+        case KRPropKeyId::kHorizontalBounces:
+        case KRPropKeyId::kBouncesEnable:
+            didHanded = SetBouncesEnable(prop_value);
+            break;
+        case KRPropKeyId::kShowScrollerIndicator:
+            didHanded = SetShowScrollerIndicator(prop_value);
+            break;
+        case KRPropKeyId::kDragBegin:
+            didHanded = RegisterOnDragBeginEvent(event_call_back);
+            break;
+        case KRPropKeyId::kDragEnd:
+            didHanded = RegisterOnDragEndEvent(event_call_back);
+            break;
+        case KRPropKeyId::kScrollEnd:
+            didHanded = RegisterOnScrollEndEvent(event_call_back);
+            break;
+        case KRPropKeyId::kWillDragEnd:
+            didHanded = RegisterWillDragEndEvent(event_call_back);
+            break;
+        case KRPropKeyId::kLimitHeaderBounces:
+            didHanded = SetLimitHeaderBounces(prop_value);
+            break;
+        case KRPropKeyId::kNestedScroll:
+            didHanded = SetNestedScroll(prop_value);
+            break;
+        default:
+            break;
     }
     return didHanded;
 }
@@ -160,7 +158,7 @@ bool KRScrollerView::ResetProp(const std::string &prop_key) {
     first_animate_ = false;
     auto didHanded = IKRRenderViewExport::ResetProp(prop_key);
     if (!didHanded) {
-        if (prop_key == kPropNameNestedScroll) {
+        if (KRGetPropKeyId(prop_key) == KRPropKeyId::kNestedScroll) {
             didHanded = true;
             kuikly::util::ResetArkUINestedScroll(GetNode());
         }
@@ -199,40 +197,79 @@ void KRScrollerView::OnEvent(ArkUI_NodeEvent *event, const ArkUI_NodeEventType &
 void KRScrollerView::FireOnScrollEvent(ArkUI_NodeEvent *event) {
     // 分发滚动事件
     DispatchDidScrollToObservers();
-    if (!on_scroll_callback_) {
-        return;
-    }
-    on_scroll_callback_(GetCommonScrollParams());
+    EnqueueScrollEvent();
 }
 
 void KRScrollerView::FireBeginDragEvent(ArkUI_NodeEvent *event) {
-    if (!on_drag_begin_callback_) {
-        return;
-    }
-    on_drag_begin_callback_(GetCommonScrollParams());
+    DispatchScrollEdgeEvent(KRScrollEventType::kDragBegin);
 }
 
 void KRScrollerView::FireWillDragEndEvent(ArkUI_NodeEvent *event) {
     KR_LOG_INFO << "fire will drag end";
-    if (!on_will_drag_end_callback_) {
-        return;
-    }
     // TODO(userName): 补充加速度参数
-    on_will_drag_end_callback_(GetCommonScrollParams());
+    DispatchScrollEdgeEvent(KRScrollEventType::kWillDragEnd);
 }
 
 void KRScrollerView::FireEndDragEvent(ArkUI_NodeEvent *event) {
-    if (!on_drag_end_callback_) {
+    DispatchScrollEdgeEvent(KRScrollEventType::kDragEnd);
+}
+
+void KRScrollerView::FireEndScrollEvent(ArkUI_NodeEvent *event) {
+    DispatchScrollEdgeEvent(KRScrollEventType::kScrollEnd);
+}
+
+void KRScrollerView::EnqueueScrollEvent() {
+    if (!on_scroll_callback_) {
         return;
     }
-    on_drag_end_callback_(GetCommonScrollParams());
+    pending_scroll_params_ = GetCommonScrollParams();
+    has_pending_scroll_event_ = true;
+    if (scroll_event_flush_scheduled_) {
+        return;
+    }
+    scroll_event_flush_scheduled_ = true;
+    std::weak_ptr<KRScrollerView> weak_self = std::static_pointer_cast<KRScrollerView>(shared_from_this());
+    KRMainThread::RunOnMainThreadForNextLoop([weak_self] {
+        if (auto self = weak_self.lock()) {
+            self->scroll_event_flush_scheduled_ = false;
+            self->FlushScrollEvent();
+        }
+    });
 }
 
-void KRScrollerView::FireEndScrollEvent(ArkUI_NodeEvent *event) {
-    if (!on_scroll_end_callback_) {
+void KRScrollerView::FlushScrollEvent() {
+    if (!has_pending_scroll_event_) {
         return;
     }
-    on_scroll_end_callback_(GetCommonScrollParams());
+    has_pending_scroll_event_ = false;
+    if (on_scroll_callback_) {
+        on_scroll_callback_(ToRenderValue(pending_scroll_params_));
+    }
+}
+
+void KRScrollerView::DispatchScrollEdgeEvent(KRScrollEventType type) {
+    // 先投递尚未发出的 scroll，保证 Kotlin 侧收到的事件顺序与原生一致
+    FlushScrollEvent();
+    const auto &callback = GetScrollEventCallback(type);
+    if (callback) {
+        callback(ToRenderValue(GetCommonScrollParams()));
+    }
+}
+
+const KRRenderCallback &KRScrollerView::GetScrollEventCallback(KRScrollEventType type) const {
+    switch (type) {
+        case KRScrollEventType::kScroll:
+            return on_scroll_callback_;
+        case KRScrollEventType::kDragBegin:
+            return on_drag_begin_callback_;
+        case KRScrollEventType::kWillDragEnd:
+            return on_will_drag_end_callback_;
+        case KRScrollEventType::kDragEnd:
+            return on_drag_end_callback_;
+        case KRScrollEventType::kScrollEnd:
+        default:
+            return on_scroll_end_callback_;
+    }
 }
 
 void KRScrollerView::DidInsertSubRenderView(const std::shared_ptr<IKRRenderViewExport> &sub_render_view, int index) {
@@ -244,6 +281,8 @@ void KRScrollerView::DidInsertSubRenderView(const std::shared_ptr<IKRRenderViewE
 }
 
 void KRScrollerView::OnDestroy() {
+    // 销毁后不再投递未完成的滚动事件
+    has_pending_scroll_event_ = false;
     if (!content_view_) {
         return;
     }
@@ -509,24 +548,41 @@ bool KRScrollerView::IsDraggingStateToIdeaState(ArkUI_ScrollState new_scroll_sta
            new_scroll_state == ArkUI_ScrollState::ARKUI_SCROLL_STATE_IDLE;
 }
 
-std::shared_ptr<KRRenderValue> KRScrollerView::GetCommonScrollParams() {
-    KRRenderValueMap map;
+KRScrollEventParams KRScrollerView::GetCommonScrollParams() {
+    KRScrollEventParams params;
     auto point = kuikly::util::GetArkUIScrollContentOffset(GetNode());
-    map[kEventKeyOffsetX] = NewKRRenderValue(point.x);
-    map[kEventKeyOffsetY] = NewKRRenderValue(point.y);
+    params.offset_x = point.x;
+    params.offset_y = point.y;
 
-    auto frame = GetFrame();
-    map[kEventKeyViewWidth] = NewKRRenderValue(frame.width);
-    map[kEventKeyViewHeight] = NewKRRenderValue(frame.height);
+    const auto &frame = GetFrame();
+    params.view_width = frame.width;
+    params.view_height = frame.height;
 
     if (content_view_) {
-        auto content_view_frame = content_view_->GetFrame();
-        map[kEventKeyContentWidth] = NewKRRenderValue(content_view_frame.width);
-        map[kEventKeyContentHeight] = NewKRRenderValue(content_view_frame.height);
+        const auto &content_view_frame = content_view_->GetFrame();
+        params.has_content = true;
+        params.content_width = content_view_frame.width;
+        params.content_height = content_view_frame.height;
     }
-    map[kEventKeyIsDragging] = NewKRRenderValue(is_dragging_ ? 1 : 0);
-    map[kEventKeyVelocityX] = NewKRRenderValue(velocity_x_);
-    map[kEventKeyVelocityY] = NewKRRenderValue(velocity_y_);
+    params.is_dragging = is_dragging_;
+    params.velocity_x = velocity_x_;
+    params.velocity_y = velocity_y_;
+    return params;
+}
+
+std::shared_ptr<KRRenderValue> KRScrollerView::ToRenderValue(const KRScrollEventParams &params) {
+    KRRenderValueMap map;
+    map[kEventKeyOffsetX] = NewKRRenderValue(params.offset_x);
+    map[kEventKeyOffsetY] = NewKRRenderValue(params.offset_y);
+    map[kEventKeyViewWidth] = NewKRRenderValue(params.view_width);
+    map[kEventKeyViewHeight] = NewKRRenderValue(params.view_height);
+    if (params.has_content) {
+        map[kEventKeyContentWidth] = NewKRRenderValue(params.content_width);
+        map[kEventKeyContentHeight] = NewKRRenderValue(params.content_height);
+    }
+    map[kEventKeyIsDragging] = NewKRRenderValue(params.is_dragging ? 1 : 0);
+    map[kEventKeyVelocityX] = NewKRRenderValue(params.velocity_x);
+    map[kEventKeyVelocityY] = NewKRRenderValue(params.velocity_y);
     return NewKRRenderValue(std::move(map));
 }
 
@@ -23,6 +23,30 @@
 #include "libohos_render/utils/animate/KRAnimation.h"
 #include "libohos_render/expand/components/view/SuperTouchHandler.h"
 
+enum class KRScrollEventType : uint8_t {
+    kScroll,
+    kDragBegin,
+    kWillDragEnd,
+    kDragEnd,
+    kScrollEnd,
+};
+
+/**
+ * 滚动事件参数，以值类型按帧合并投递，仅在存在 Kotlin 侧回调时才转换为 KRRenderValueMap
+ */
+struct KRScrollEventParams {
+    float offset_x = 0;
+    float offset_y = 0;
+    float view_width = 0;
+    float view_height = 0;
+    float content_width = 0;
+    float content_height = 0;
+    float velocity_x = 0;
+    float velocity_y = 0;
+    bool has_content = false;
+    bool is_dragging = false;
+};
+
 class IKRScrollObserver {
  public:
     // 滚动变化回调
@@ -115,7 +139,12 @@ class KRScrollerView : public IKRRenderViewExport {
     bool IsFlingStateToDraggingState(ArkUI_ScrollState new_scroll_state);
     bool IsDraggingStateToFlingState(ArkUI_ScrollState new_scroll_state);
     bool IsDraggingStateToIdeaState(ArkUI_ScrollState new_scroll_state);
-    std::shared_ptr<KRRenderValue> GetCommonScrollParams();
+    KRScrollEventParams GetCommonScrollParams();
+    static std::shared_ptr<KRRenderValue> ToRenderValue(const KRScrollEventParams &params);
+    const KRRenderCallback &GetScrollEventCallback(KRScrollEventType type) const;
+    void EnqueueScrollEvent();
+    void FlushScrollEvent();
+    void DispatchScrollEdgeEvent(KRScrollEventType type);
     void ApplyContentInsetWhenDragEnd();
     void InnerSetBouncesEnable(bool enable);
     void AdjustHeaderBouncesEnableWhenWillScroll(ArkUI_NodeEvent *event);
@@ -151,6 +180,11 @@ class KRScrollerView : public IKRRenderViewExport {
     float velocity_x_ = 0;
     float velocity_y_ = 0;
     std::weak_ptr<SuperTouchHandler> weak_super_touch_handler_;
+
+    // 同一帧内的 scroll 事件只保留最新参数，在下一个主线程循环投递；拖拽/结束等边沿事件同步投递
+    KRScrollEventParams pending_scroll_params_;
+    bool has_pending_scroll_event_ = false;
+    bool scroll_event_flush_scheduled_ = false;
 };
 
 #endif  // CORE_RENDER_OHOS_KRSCROLLERVIEW_H
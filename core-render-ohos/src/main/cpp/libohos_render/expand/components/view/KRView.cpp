@@ -23,9 +23,6 @@ constexpr char kPropNameTouchDown[] = "touchDown";
 constexpr char kPropNameTouchMove[] = "touchMove";
 constexpr char kPropNameTouchUp[] = "touchUp";
 constexpr char kPropNameTouchCancel[] = "touchCancel";
-constexpr char kPropNamePreventTouch[] = "preventTouch";
-constexpr char kPropNameSuperTouch[] = "superTouch";
-constexpr char kPropNameHitTestModeOhos[] = "hit-test-ohos";
 
 constexpr char kOhosHitTestModeDefault[] = "default";
 constexpr char kOhosHitTestModeBlock[] = "block";
@@ -44,30 +41,39 @@ void KRView::WillReuse() {
 bool KRView::SetProp(const std::string &prop_key, const KRAnyValue &prop_value,
                      const KRRenderCallback event_call_back) {
     auto didHand = false;
-    if (kuikly::util::isEqual(prop_key, kPropNameTouchDown)) {
-        didHand = RegisterTouchDownEvent(event_call_back);
-    } else if (kuikly::util::isEqual(prop_key, kPropNameTouchMove)) {
-        didHand = RegisterTouchMoveEvent(event_call_back);
-    } else if (kuikly::util::isEqual(prop_key, kPropNameTouchUp)) {
-        didHand = RegisterTouchUpEvent(event_call_back);
-    } else if (kuikly::util::isEqual(prop_key, kPropNamePreventTouch)) {
-        if (super_touch_handler_) {
-            super_touch_handler_->PreventTouch(prop_value->toBool());
-        }
-        didHand = true;
-    } else if (kuikly::util::isEqual(prop_key, kPropNameSuperTouch)) {
-        if (prop_value->toBool()) {
-            if (!super_touch_handler_) {
-                super_touch_handler_ = std::make_shared<SuperTouchHandler>();
-            }
-        } else {
+    switch (KRGetPropKeyId(prop_key)) {
+        case KRPropKeyId::kTouchDown:
+            didHand = RegisterTouchDownEvent(event_call_back);
+            break;
+        case KRPropKeyId::kTouchMove:
+            didHand = RegisterTouchMoveEvent(event_call_back);
+            break;
+        case KRPropKeyId::kTouchUp:
+            didHand = RegisterTouchUpEvent(event_call_back);
+            break;
+        case KRPropKeyId::kPreventTouch:
             if (super_touch_handler_) {
-                super_touch_handler_ = nullptr;
+                super_touch_handler_->PreventTouch(prop_value->toBool());
+            }
+            didHand = true;
+            break;
+        case KRPropKeyId::kSuperTouch:
+            if (prop_value->toBool()) {
+                if (!super_touch_handler_) {
+                    super_touch_handler_ = std::make_shared<SuperTouchHandler>();
+                }
+            } else {
+                if (super_touch_handler_) {
+                    super_touch_handler_ = nullptr;
+                }
             }
-        }
-        didHand = true;
-    } else if (kuikly::util::isEqual(prop_key, kPropNameHitTestModeOhos)) {
-        didHand = SetTargetHitTestMode(prop_value->toString());
+            didHand = true;
+            break;
+        case KRPropKeyId::kHitTestModeOhos:
+            didHand = SetTargetHitTestMode(prop_value->toString());
+            break;
+        default:
+            break;
     }
     return didHand;
 }
@@ -89,27 +95,35 @@ void KRView::OnEvent(ArkUI_NodeEvent *event, const ArkUI_NodeEventType &event_ty
 bool KRView::ResetProp(const std::string &prop_key) {
     auto didHande = false;
     register_touch_event_ = false;
-    if (kuikly::util::isEqual(prop_key, kPropNameTouchDown)) {
-        touch_down_callback_ = nullptr;
-        didHande = true;
-    } else if (kuikly::util::isEqual(prop_key, kPropNameTouchMove)) {
-        touch_move_callback_ = nullptr;
-        didHande = true;
-    } else if (kuikly::util::isEqual(prop_key, kPropNameTouchUp)) {
-        touch_up_callback_ = nullptr;
-        didHande = true;
-    } else if (kuikly::util::isEqual(prop_key, kPropNamePreventTouch)) {
-        // reset handled by kPropNameSuperTouch, do nothing here
-        didHande = true;
-    } else if (kuikly::util::isEqual(prop_key, kPropNameSuperTouch)) {
-        super_touch_handler_ = nullptr;
-        didHande = true;
-    } else if (kuikly::util::isEqual(prop_key, kPropNameHitTestModeOhos)) {
-        target_hit_test_mode = ARKUI_HIT_TEST_MODE_DEFAULT;
-        UpdateHitTestMode(HasBaseEvent() || HasTouchEvent());
-        didHande = true;
-    } else {
-        didHande = IKRRenderViewExport::ResetProp(prop_key);
+    switch (KRGetPropKeyId(prop_key)) {
+        case KRPropKeyId::kTouchDown:
+            touch_down_callback_ = nullptr;
+            didHande = true;
+            break;
+        case KRPropKeyId::kTouchMove:
+            touch_move_callback_ = nullptr;
+            didHande = true;
+            break;
+        case KRPropKeyId::kTouchUp:
+            touch_up_callback_ = nullptr;
+            didHande = true;
+            break;
+        case KRPropKeyId::kPreventTouch:
+            // reset handled by kSuperTouch, do nothing here
+            didHande = true;
+            break;
+        case KRPropKeyId::kSuperTouch:
+            super_touch_handler_ = nullptr;
+            didHande = true;
+            break;
+        case KRPropKeyId::kHitTestModeOhos:
+            target_hit_test_mode = ARKUI_HIT_TEST_MODE_DEFAULT;
+            UpdateHitTestMode(HasBaseEvent() || HasTouchEvent());
+            didHande = true;
+            break;
+        default:
+            didHande = IKRRenderViewExport::ResetProp(prop_key);
+            break;
     }
     return didHande;
 }
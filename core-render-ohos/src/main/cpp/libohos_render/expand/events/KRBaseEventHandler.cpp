@@ -21,13 +21,6 @@
 #include "libohos_render/utils/KRRenderLoger.h"
 #include "libohos_render/utils/KRStringUtil.h"
 
-constexpr char kClickEventName[] = "click";
-constexpr char kDoubleClickEventName[] = "doubleClick";
-constexpr char kLongPressEventName[] = "longPress";
-constexpr char kPanEventName[] = "pan";
-constexpr char kPinchEventName[] = "pinch";
-constexpr char kCaptureAttrName[] = "capture";
-
 constexpr char kParamKeyX[] = "x";
 constexpr char kParamKeyY[] = "y";
 constexpr char kParamKeyPageX[] = "pageX";
@@ -41,20 +34,33 @@ KRBaseEventHandler::KRBaseEventHandler(const std::shared_ptr<KRConfig> &kr_confi
 
 bool KRBaseEventHandler::SetProp(const std::shared_ptr<IKRRenderViewExport> &view_export, const std::string &prop_key,
                                  const KRAnyValue &prop_value, const KRRenderCallback event_call_back) {
+    return SetProp(view_export, KRGetPropKeyId(prop_key), prop_value, event_call_back);
+}
+
+bool KRBaseEventHandler::SetProp(const std::shared_ptr<IKRRenderViewExport> &view_export, KRPropKeyId key_id,
+                                 const KRAnyValue &prop_value, const KRRenderCallback event_call_back) {
     auto didHanded = false;
     if (event_call_back != nullptr) {
-        if (kuikly::util::isEqual(prop_key, kClickEventName)) {
-            didHanded = RegisterOnClick(view_export, event_call_back);
-        } else if (kuikly::util::isEqual(prop_key, kDoubleClickEventName)) {
-            didHanded = RegisterOnDoubleClick(view_export, event_call_back);
-        } else if (kuikly::util::isEqual(prop_key, kLongPressEventName)) {
-            didHanded = RegisterOnLongPress(view_export, event_call_back);
-        } else if (kuikly::util::isEqual(prop_key, kPanEventName)) {
-            didHanded = RegisterOnPan(view_export, event_call_back);
-        } else if (kuikly::util::isEqual(prop_key, kPinchEventName)) {
-            didHanded = RegisterOnPinch(view_export, event_call_back);
+        switch (key_id) {
+            case KRPropKeyId::kClick:
+                didHanded = RegisterOnClick(view_export, event_call_back);
+                break;
+            case KRPropKeyId::kDoubleClick:
+                didHanded = RegisterOnDoubleClick(view_export, event_call_back);
+                break;
+            case KRPropKeyId::kLongPress:
+                didHanded = RegisterOnLongPress(view_export, event_call_back);
+                break;
+            case KRPropKeyId::kPan:
+                didHanded = RegisterOnPan(view_export, event_call_back);
+                break;
+            case KRPropKeyId::kPinch:
+                didHanded = RegisterOnPinch(view_export, event_call_back);
+                break;
+            default:
+                break;
         }
-    } else if (kuikly::util::isEqual(prop_key, kCaptureAttrName)) {
+    } else if (key_id == KRPropKeyId::kCapture) {
         didHanded = SetCaptureRule(view_export, prop_value->toString());
     }
     return didHanded;
@@ -86,26 +92,39 @@ bool KRBaseEventHandler::OnGestureEvent(const std::shared_ptr<KRGestureEventData
 }
 
 bool KRBaseEventHandler::ResetProp(const std::string &prop_key) {
+    return ResetProp(KRGetPropKeyId(prop_key));
+}
+
+bool KRBaseEventHandler::ResetProp(KRPropKeyId key_id) {
     auto didHanded = false;
-    if (kuikly::util::isEqual(prop_key, kClickEventName)) {
-        click_callback_ = nullptr;
-        didHanded = true;
-    } else if (kuikly::util::isEqual(prop_key, kDoubleClickEventName)) {
-        double_click_callback_ = nullptr;
-        didHanded = true;
-    } else if (kuikly::util::isEqual(prop_key, kLongPressEventName)) {
-        long_press_callback_ = nullptr;
-        didHanded = true;
-    } else if (kuikly::util::isEqual(prop_key, kPanEventName)) {
-        pan_event_callback_ = nullptr;
-        didHanded = true;
-    } else if (kuikly::util::isEqual(prop_key, kPinchEventName)) {
-        pinch_event_callback_ = nullptr;
-        didHanded = true;
-    } else if (kuikly::util::isEqual(prop_key, kCaptureAttrName)) {
-        // KREventDispatchCenter has reset by view_export->UnregisterEvent()
-        has_capture_rule_ = false;
-        didHanded = true;
+    switch (key_id) {
+        case KRPropKeyId::kClick:
+            click_callback_ = nullptr;
+            didHanded = true;
+            break;
+        case KRPropKeyId::kDoubleClick:
+            double_click_callback_ = nullptr;
+            didHanded = true;
+            break;
+        case KRPropKeyId::kLongPress:
+            long_press_callback_ = nullptr;
+            didHanded = true;
+            break;
+        case KRPropKeyId::kPan:
+            pan_event_callback_ = nullptr;
+            didHanded = true;
+            break;
+        case KRPropKeyId::kPinch:
+            pinch_event_callback_ = nullptr;
+            didHanded = true;
+            break;
+        case KRPropKeyId::kCapture:
+            // KREventDispatchCenter has reset by view_export->UnregisterEvent()
+            has_capture_rule_ = false;
+            didHanded = true;
+            break;
+        default:
+            break;
     }
     return didHanded;
 }
@@ -20,6 +20,7 @@
 #include <string>
 #include "gesture/KRGestueEventType.h"
 #include "libohos_render/foundation/KRCommon.h"
+#include "libohos_render/foundation/KRPropKey.h"
 #include "libohos_render/utils/KREventUtil.h"
 #include "libohos_render/view/IKRRenderView.h"
 
@@ -33,11 +34,14 @@ class KRBaseEventHandler : public std::enable_shared_from_this<KRBaseEventHandle
 
     bool SetProp(const std::shared_ptr<IKRRenderViewExport> &view_export, const std::string &prop_key,
                  const KRAnyValue &prop_value, const KRRenderCallback event_call_back = nullptr);
+    bool SetProp(const std::shared_ptr<IKRRenderViewExport> &view_export, KRPropKeyId key_id,
+                 const KRAnyValue &prop_value, const KRRenderCallback event_call_back = nullptr);
     bool OnEvent(ArkUI_NodeEvent *event, const ArkUI_NodeEventType &event_type);
     bool OnCustomEvent(ArkUI_NodeCustomEvent *event, const ArkUI_NodeCustomEventType &event_type);
     bool OnGestureEvent(const std::shared_ptr<KRGestureEventData> &gesture_event_data,
                         const KRGestureEventType &event_type);
     bool ResetProp(const std::string &prop_key);
+    bool ResetProp(KRPropKeyId key_id);
     void OnDestroy();
     // 是否含有手势事件监听
     bool HasTouchEvent();
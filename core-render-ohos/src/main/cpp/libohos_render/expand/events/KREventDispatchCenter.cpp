@@ -45,29 +45,21 @@ KREventDispatchCenter::KREventDispatchCenter() {
 void KREventDispatchCenter::OnReceiverEvent(ArkUI_NodeEvent *event) {
     KREnsureMainThread();
 
-    auto ark_ui_node_handle = kuikly::util::GetArkUINodeHandle(event);
-    if (returnIfNull(ark_ui_node_handle)) {
-        return;
-    }
-    auto it = event_handler_map_.find(ark_ui_node_handle);
-    if (it == event_handler_map_.end()) {
+    auto record = static_cast<KRNodeEventRecord *>(kuikly::util::GetUserData(event));
+    if (record == nullptr) {
         return;
     }
-    it->second->ViewExport()->ToOnEvent(event, kuikly::util::GetArkUINodeEventType(event));
+    record->ViewExport()->ToOnEvent(event, kuikly::util::GetArkUINodeEventType(event));
 }
 
 void KREventDispatchCenter::OnReceiverCustomEvent(ArkUI_NodeCustomEvent *event) {
     KREnsureMainThread();
 
-    auto ark_ui_node_handle = OH_ArkUI_NodeCustomEvent_GetNodeHandle(event);
-    if (returnIfNull(ark_ui_node_handle)) {
-        return;
-    }
-    auto it = custom_event_handler_map_.find(ark_ui_node_handle);
-    if (it == custom_event_handler_map_.end()) {
+    auto record = static_cast<KRNodeEventRecord *>(OH_ArkUI_NodeCustomEvent_GetUserData(event));
+    if (record == nullptr) {
         return;
     }
-    it->second->ViewExport()->ToOnCustomEvent(event, OH_ArkUI_NodeCustomEvent_GetEventType(event));
+    record->ViewExport()->ToOnCustomEvent(event, OH_ArkUI_NodeCustomEvent_GetEventType(event));
 }
 
 static void KRNodeEventReceiver(ArkUI_NodeEvent *event) {
@@ -88,17 +80,13 @@ void KREventDispatchCenter::RegisterEvent(const std::shared_ptr<IKRRenderViewExp
         return;
     }
 
-    auto it = event_handler_map_.find(ark_ui_node_handle);
-    if (it == event_handler_map_.end()) {
+    auto &record = view_export->EventRecord();
+    if (!record.HasEvent()) {
         kuikly::util::GetNodeApi()->addNodeEventReceiver(ark_ui_node_handle, KRNodeEventReceiver);
-        auto entry = std::make_shared<KREventRegisterEntry>(view_export);
-        entry->AddEvent(event_type);
-        event_handler_map_[ark_ui_node_handle] = entry;
-    } else {
-        it->second->AddEvent(event_type);
     }
-
-    kuikly::util::GetNodeApi()->registerNodeEvent(ark_ui_node_handle, event_type, event_type, nullptr);
+    if (record.AddEvent(event_type)) {
+        kuikly::util::GetNodeApi()->registerNodeEvent(ark_ui_node_handle, event_type, event_type, &record);
+    }
 }
 
 void KREventDispatchCenter::UnregisterEvent(const std::shared_ptr<IKRRenderViewExport> &view_export) {
@@ -108,17 +96,18 @@ void KREventDispatchCenter::UnregisterEvent(const std::shared_ptr<IKRRenderViewE
     if (returnIfNull(ark_ui_node_handle)) {
         return;
     }
-    auto it = event_handler_map_.find(ark_ui_node_handle);
-    if (it == event_handler_map_.end()) {
+    UnregisterEvent(ark_ui_node_handle, view_export->EventRecord());
+}
+
+void KREventDispatchCenter::UnregisterEvent(ArkUI_NodeHandle node_handle, KRNodeEventRecord &record) {
+    if (!record.HasEvent()) {
         return;
     }
-
-    kuikly::util::GetNodeApi()->removeNodeEventReceiver(ark_ui_node_handle, KRNodeEventReceiver);
-    const auto &register_event = it->second->RegisterEvents();
-    std::for_each(register_event.begin(), register_event.end(), [ark_ui_node_handle](auto event_type){
-        kuikly::util::GetNodeApi()->unregisterNodeEvent(ark_ui_node_handle, event_type);
+    kuikly::util::GetNodeApi()->removeNodeEventReceiver(node_handle, KRNodeEventReceiver);
+    record.ForEachEvent([node_handle](ArkUI_NodeEventType event_type) {
+        kuikly::util::GetNodeApi()->unregisterNodeEvent(node_handle, event_type);
     });
-    event_handler_map_.erase(ark_ui_node_handle);
+    record.ClearEvents();
 }
 
 void KREventDispatchCenter::RegisterCustomEvent(const std::shared_ptr<IKRRenderViewExport> &view_export,
@@ -129,18 +118,15 @@ void KREventDispatchCenter::RegisterCustomEvent(const std::shared_ptr<IKRRenderV
     if (returnIfNull(ark_ui_node_handle)) {
         return;
     }
-    kuikly::util::GetNodeApi()->addNodeCustomEventReceiver(ark_ui_node_handle, KRNodeCustomEventReceiver);
-
-    auto it = custom_event_handler_map_.find(ark_ui_node_handle);
-    if (it == custom_event_handler_map_.end()) {
-        auto entry = std::make_shared<KRCustomEventRegisterEntry>(view_export);
-        entry->AddEvent(event_type);
-        custom_event_handler_map_[ark_ui_node_handle] = entry;
-    } else {
-        it->second->AddEvent(event_type);
+    auto &record = view_export->EventRecord();
+    if (!record.HasCustomEvent()) {
+        kuikly::util::GetNodeApi()->addNodeCustomEventReceiver(ark_ui_node_handle, KRNodeCustomEventReceiver);
+    }
+    if (record.AddCustomEvent(event_type)) {
+        kuikly::util::GetNodeApi()->registerNodeCustomEvent(ark_ui_node_handle, event_type, 0, &record);
     }
-    kuikly::util::GetNodeApi()->registerNodeCustomEvent(ark_ui_node_handle, event_type, 0, nullptr);
 }
+
 void KREventDispatchCenter::UnregisterCustomEvent(const std::shared_ptr<IKRRenderViewExport> &view_export) {
     KREnsureMainThread();
 
@@ -148,17 +134,26 @@ void KREventDispatchCenter::UnregisterCustomEvent(const std::shared_ptr<IKRRende
     if (returnIfNull(ark_ui_node_handle)) {
         return;
     }
-    auto it = custom_event_handler_map_.find(ark_ui_node_handle);
-    if (it == custom_event_handler_map_.end()) {
+    UnregisterCustomEvent(ark_ui_node_handle, view_export->EventRecord());
+}
+
+void KREventDispatchCenter::UnregisterCustomEvent(ArkUI_NodeHandle node_handle, KRNodeEventRecord &record) {
+    if (!record.HasCustomEvent()) {
         return;
     }
-    kuikly::util::GetNodeApi()->removeNodeCustomEventReceiver(ark_ui_node_handle, KRNodeCustomEventReceiver);
-
-    const auto &register_event = it->second->RegisterEvents();
-    std::for_each(register_event.begin(), register_event.end(), [ark_ui_node_handle](auto event_type){
-        kuikly::util::GetNodeApi()->unregisterNodeCustomEvent(ark_ui_node_handle, event_type);
+    kuikly::util::GetNodeApi()->removeNodeCustomEventReceiver(node_handle, KRNodeCustomEventReceiver);
+    record.ForEachCustomEvent([node_handle](ArkUI_NodeCustomEventType event_type) {
+        kuikly::util::GetNodeApi()->unregisterNodeCustomEvent(node_handle, event_type);
     });
-    custom_event_handler_map_.erase(ark_ui_node_handle);
+    record.ClearCustomEvents();
+}
+
+void KREventDispatchCenter::ReleaseEventRecord(ArkUI_NodeHandle node_handle, KRNodeEventRecord &record) {
+    if (returnIfNull(node_handle)) {
+        return;
+    }
+    UnregisterEvent(node_handle, record);
+    UnregisterCustomEvent(node_handle, record);
 }
 
 KREventDispatchCenter::KRGestureEventRegisterEntry::KRGestureEventRegisterEntry(
@@ -19,13 +19,101 @@
 #include <arkui/native_gesture.h>
 #include <arkui/native_node.h>
 #include <arkui/native_type.h>
-#include <set>
+#include <algorithm>
+#include <cstdint>
 #include <unordered_map>
+#include <vector>
 #include "gesture/KRGestueEventType.h"
 #include "libohos_render/expand/events/gesture/KRGestureGroupHandler.h"
 #include "libohos_render/utils/KRViewUtil.h"
 #include "libohos_render/view/IKRRenderView.h"
 
+/**
+ * 节点事件注册记录，内嵌在 view 中并作为 ArkUI 事件的 userData，事件回调直接取回 view，无需查表
+ * 公共事件（类型值 < 64）与自定义事件用位图记录，组件作用域的事件类型值较大，记录在 extra_events_ 中
+ */
+class KRNodeEventRecord {
+ public:
+    explicit KRNodeEventRecord(IKRRenderViewExport *view_export) : view_export_(view_export) {}
+    KRNodeEventRecord(const KRNodeEventRecord &) = delete;
+    KRNodeEventRecord &operator=(const KRNodeEventRecord &) = delete;
+
+    IKRRenderViewExport *ViewExport() const {
+        return view_export_;
+    }
+
+    /**
+     * 记录事件类型，返回是否首次注册
+     */
+    bool AddEvent(ArkUI_NodeEventType event_type) {
+        auto type = static_cast<uint32_t>(event_type);
+        if (type < kMaskEventCount) {
+            auto bit = uint64_t(1) << type;
+            if (event_mask_ & bit) {
+                return false;
+            }
+            event_mask_ |= bit;
+            return true;
+        }
+        if (std::find(extra_events_.begin(), extra_events_.end(), event_type) != extra_events_.end()) {
+            return false;
+        }
+        extra_events_.push_back(event_type);
+        return true;
+    }
+
+    bool AddCustomEvent(ArkUI_NodeCustomEventType event_type) {
+        auto bit = static_cast<uint32_t>(event_type);
+        if (custom_event_mask_ & bit) {
+            return false;
+        }
+        custom_event_mask_ |= bit;
+        return true;
+    }
+
+    bool HasEvent() const {
+        return event_mask_ != 0 || !extra_events_.empty();
+    }
+
+    bool HasCustomEvent() const {
+        return custom_event_mask_ != 0;
+    }
+
+    template <typename F>
+    void ForEachEvent(F &&func) const {
+        for (auto mask = event_mask_; mask != 0; mask &= mask - 1) {
+            func(static_cast<ArkUI_NodeEventType>(__builtin_ctzll(mask)));
+        }
+        for (auto event_type : extra_events_) {
+            func(event_type);
+        }
+    }
+
+    template <typename F>
+    void ForEachCustomEvent(F &&func) const {
+        for (auto mask = custom_event_mask_; mask != 0; mask &= mask - 1) {
+            func(static_cast<ArkUI_NodeCustomEventType>(uint32_t(1) << __builtin_ctz(mask)));
+        }
+    }
+
+    void ClearEvents() {
+        event_mask_ = 0;
+        extra_events_.clear();
+    }
+
+    void ClearCustomEvents() {
+        custom_event_mask_ = 0;
+    }
+
+ private:
+    static constexpr uint32_t kMaskEventCount = 64;
+
+    IKRRenderViewExport *view_export_ = nullptr;
+    uint64_t event_mask_ = 0;
+    std::vector<ArkUI_NodeEventType> extra_events_;
+    uint32_t custom_event_mask_ = 0;
+};
+
 class KREventDispatchCenter {
  public:
     KREventDispatchCenter(const KREventDispatchCenter &) = delete;
@@ -39,6 +127,10 @@ class KREventDispatchCenter {
     void RegisterCustomEvent(const std::shared_ptr<IKRRenderViewExport> &view_export,
                              const ArkUI_NodeCustomEventType &event_type);
     void UnregisterCustomEvent(const std::shared_ptr<IKRRenderViewExport> &view_export);
+    /**
+     * 注销节点上所有通过 record 注册的事件，供 view 析构时兜底使用
+     */
+    void ReleaseEventRecord(ArkUI_NodeHandle node_handle, KRNodeEventRecord &record);
 
     void RegisterGestureEvent(const std::shared_ptr<IKRRenderViewExport> &view_export,
                               const KRGestureEventType &event_type);
@@ -58,50 +150,6 @@ class KREventDispatchCenter {
     ArkUI_GestureInterruptResult OnInterruptGestureEvent(const ArkUI_GestureInterruptInfo *info);
 
  public:
-    class KREventRegisterEntry {
-     private:
-        std::shared_ptr<IKRRenderViewExport> view_export_;
-        std::set<ArkUI_NodeEventType> register_events_;
-
-     public:
-        explicit KREventRegisterEntry(const std::shared_ptr<IKRRenderViewExport> &view_export)
-            : view_export_(view_export) {}
-
-        void AddEvent(const ArkUI_NodeEventType event_type) {
-            register_events_.insert(event_type);
-        }
-
-        const std::set<ArkUI_NodeEventType> &RegisterEvents() {
-            return register_events_;
-        }
-
-        std::shared_ptr<IKRRenderViewExport> &ViewExport() {
-            return view_export_;
-        }
-    };
-
-    class KRCustomEventRegisterEntry {
-     private:
-        std::shared_ptr<IKRRenderViewExport> view_export_;
-        std::set<ArkUI_NodeCustomEventType> register_events_;
-
-     public:
-        explicit KRCustomEventRegisterEntry(const std::shared_ptr<IKRRenderViewExport> &view_export)
-            : view_export_(view_export) {}
-
-        void AddEvent(const ArkUI_NodeCustomEventType event_type) {
-            register_events_.insert(event_type);
-        }
-
-        std::set<ArkUI_NodeCustomEventType> &RegisterEvents() {
-            return register_events_;
-        }
-
-        std::shared_ptr<IKRRenderViewExport> &ViewExport() {
-            return view_export_;
-        }
-    };
-
     class KRGestureEventRegisterEntry {
      private:
         std::shared_ptr<IKRRenderViewExport> view_export_;
@@ -131,9 +179,10 @@ class KREventDispatchCenter {
  private:
     KREventDispatchCenter();
 
+    void UnregisterEvent(ArkUI_NodeHandle node_handle, KRNodeEventRecord &record);
+    void UnregisterCustomEvent(ArkUI_NodeHandle node_handle, KRNodeEventRecord &record);
+
  private:
-    std::unordered_map<ArkUI_NodeHandle, std::shared_ptr<KREventRegisterEntry>> event_handler_map_;
-    std::unordered_map<ArkUI_NodeHandle, std::shared_ptr<KRCustomEventRegisterEntry>> custom_event_handler_map_;
     std::unordered_map<ArkUI_NodeHandle, std::shared_ptr<KRGestureEventRegisterEntry>> gesture_event_handler_map_;
     std::unordered_map<ArkUI_NodeHandle, std::shared_ptr<KRGestureEventRegisterEntry>> gesture_interrupter_handler_map_;
     std::unordered_map<std::string, std::shared_ptr<KRGestureEventRegisterEntry>> legacy_gesture_interrupter_handler_map_;
@@ -15,36 +15,153 @@
 
 #include "libohos_render/expand/modules/cache/KRMemoryCacheModule.h"
 
+#include <cstring>
+#include "libohos_render/utils/KRRenderLoger.h"
+
 constexpr char kMethodNameSetObject[] = "setObject";
+constexpr char kMethodNameGetStats[] = "getStats";
+constexpr char kMethodNameListenCacheMiss[] = "listenCacheMiss";
 constexpr char kParamNameKey[] = "key";
 constexpr char kParamNameValue[] = "value";
+constexpr size_t kEntryOverheadBytes = 64;  // 链表节点、索引及 KRRenderValue 自身的开销估算
+constexpr size_t kScalarValueBytes = 16;
 
 KRAnyValue KRMemoryCacheModule::Get(const std::string &key) {
-    auto it = cache_map_.find(key);
-    if (it == cache_map_.end()) {
-        return KREmptyValue();
-    } else {
-        return it->second;
-    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto value = cache_.Get(key);
+    return value != nullptr ? *value : KREmptyValue();
 }
 
 void KRMemoryCacheModule::Set(const std::string &key, const KRAnyValue &value) {
-    cache_map_[key] = value;
+    if (value == nullptr) {
+        Remove(key);
+        return;
+    }
+    auto bytes = EstimateBytes(value) + key.size() + kEntryOverheadBytes;
+    std::vector<KRAnyValue> evicted;
+    std::vector<std::function<void(const KRAnyValue &)>> waiters;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!cache_.Put(key, value, bytes, evicted)) {
+            KR_LOG_ERROR << "KRMemoryCacheModule value too large, key:" << key << " bytes:" << bytes;
+        }
+        // 超出预算的值也交给等待方使用一次，避免其反复请求重发
+        waiters = pending_requests_.Take(key);
+    }
+    KRReleaseOnSubThread(std::move(evicted));
+    if (!waiters.empty()) {
+        KRMainThread::RunOnMainThread([waiters = std::move(waiters), value] {
+            for (const auto &waiter : waiters) {
+                waiter(value);
+            }
+        });
+    }
+}
+
+void KRMemoryCacheModule::Remove(const std::string &key) {
+    std::vector<KRAnyValue> removed;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        cache_.Remove(key, removed);
+    }
+    KRReleaseOnSubThread(std::move(removed));
+}
+
+bool KRMemoryCacheModule::RequestValue(const std::string &key, std::function<void(const KRAnyValue &)> on_ready) {
+    KRRenderCallback listener;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (miss_listener_ == nullptr) {
+            return false;
+        }
+        if (!pending_requests_.Add(key, std::move(on_ready))) {
+            return true;  // 已在等待 Kotlin 重发
+        }
+        listener = miss_listener_;
+    }
+    KRRenderValue::Map params;
+    params[kParamNameKey] = NewKRRenderValue(key);
+    listener(NewKRRenderValue(std::move(params)));
+    return true;
+}
+
+void KRMemoryCacheModule::OnMemoryLevel(int level) {
+    std::vector<KRAnyValue> evicted;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        cache_.OnMemoryLevel(level, evicted);
+    }
+    KRReleaseOnSubThread(std::move(evicted));
+}
+
+void KRMemoryCacheModule::OnDestroy() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    miss_listener_ = nullptr;
+    pending_requests_ = KRRequestCoalescer<std::string, std::function<void(const KRAnyValue &)>>();
+}
+
+size_t KRMemoryCacheModule::EstimateBytes(const KRAnyValue &value) {
+    if (value == nullptr) {
+        return 0;
+    }
+    if (value->isString()) {
+        return value->toString().size();
+    }
+    if (value->isByteArray()) {
+        auto byte_array = value->toByteArray();
+        return byte_array ? byte_array->size() : 0;
+    }
+    if (value->isMap()) {
+        size_t bytes = 0;
+        for (const auto &pair : value->toMap()) {
+            bytes += pair.first.size() + EstimateBytes(pair.second) + kScalarValueBytes;
+        }
+        return bytes;
+    }
+    if (value->isArray()) {
+        size_t bytes = 0;
+        for (const auto &item : value->toArray()) {
+            bytes += EstimateBytes(item) + kScalarValueBytes;
+        }
+        return bytes;
+    }
+    return kScalarValueBytes;
 }
 
 KRAnyValue KRMemoryCacheModule::CallMethod(bool sync, const std::string &method, KRAnyValue params,
                                            const KRRenderCallback &callback) {
     if (std::strcmp(method.c_str(), kMethodNameSetObject) == 0) {
         return SetObject(params);
+    } else if (std::strcmp(method.c_str(), kMethodNameGetStats) == 0) {
+        return GetStats();
+    } else if (std::strcmp(method.c_str(), kMethodNameListenCacheMiss) == 0) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        miss_listener_ = callback;
+        return KREmptyValue();
     } else {
         return KREmptyValue();
     }
 }
 
 KRAnyValue KRMemoryCacheModule::SetObject(const KRAnyValue &params) {
-    auto map = params->toMap();
-    auto key = map[kParamNameKey]->toString();
-    auto value = map[kParamNameValue];
-    cache_map_[key] = value;
+    const auto &map = params->toMap();
+    auto key_it = map.find(kParamNameKey);
+    if (key_it == map.end() || key_it->second == nullptr) {
+        return KREmptyValue();
+    }
+    auto value_it = map.find(kParamNameValue);
+    Set(key_it->second->toString(), value_it != map.end() ? value_it->second : nullptr);
     return KREmptyValue();
 }
+
+KRAnyValue KRMemoryCacheModule::GetStats() {
+    KRRenderValue::Map stats;
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats["hits"] = NewKRRenderValue(static_cast<int64_t>(cache_.HitCount()));
+    stats["misses"] = NewKRRenderValue(static_cast<int64_t>(cache_.MissCount()));
+    stats["evictions"] = NewKRRenderValue(static_cast<int64_t>(cache_.EvictionCount()));
+    stats["bytes"] = NewKRRenderValue(static_cast<int64_t>(cache_.TotalBytes()));
+    stats["maxBytes"] = NewKRRenderValue(static_cast<int64_t>(cache_.ByteBudget()));
+    stats["count"] = NewKRRenderValue(static_cast<int64_t>(cache_.Count()));
+    return NewKRRenderValue(std::move(stats));
+}
@@ -16,24 +16,59 @@
 #ifndef CORE_RENDER_OHOS_KRMEMORYCACHEMODULE_H
 #define CORE_RENDER_OHOS_KRMEMORYCACHEMODULE_H
 
+#include <functional>
+#include <mutex>
 #include "libohos_render/export/IKRRenderModuleExport.h"
+#include "libohos_render/utils/KRByteLruCache.h"
 
 constexpr char kMemoryCacheModuleName[] = "KRMemoryCacheModule";
 
+/**
+ * 实例级内存缓存（如 base64 图片数据），按字节预算 LRU 淘汰
+ * Kotlin 侧每个 key 只下发一次（Pager.keyValueMap 记录后不再重发），因此读取未命中时
+ * 通过 Kotlin 注册的 listenCacheMiss 回调请求重发，值回填后再通知等待该 key 的视图
+ */
 class KRMemoryCacheModule : public IKRRenderModuleExport {
  public:
     KRMemoryCacheModule() = default;
     KRAnyValue CallMethod(bool sync, const std::string &method, KRAnyValue params,
                           const KRRenderCallback &callback) override;
+    void OnDestroy() override;
 
+    /**
+     * 返回缓存中的共享值（不拷贝），调用方只读不写；未命中返回空值
+     */
     KRAnyValue Get(const std::string &key);
     void Set(const std::string &key, const KRAnyValue &value);
+    void Remove(const std::string &key);
+
+    /**
+     * Get 未命中（如已被淘汰）时调用：请求 Kotlin 侧重发该 key，值回填后在主线程以该值执行 on_ready
+     * Kotlin 侧未注册重发回调时返回 false，on_ready 不会被执行
+     */
+    bool RequestValue(const std::string &key, std::function<void(const KRAnyValue &)> on_ready);
+
+    /**
+     * 系统内存告警时按等级收缩缓存
+     */
+    void OnMemoryLevel(int level);
+
+    /**
+     * 估算值占用的内存，字符串/字节数组按实际长度，Map/Array 递归累加
+     */
+    static size_t EstimateBytes(const KRAnyValue &value);
 
  private:
     KRAnyValue SetObject(const KRAnyValue &params);
+    KRAnyValue GetStats();
 
  private:
-    std::unordered_map<std::string, KRAnyValue> cache_map_;
+    static constexpr size_t kMaxCacheBytes = 32 * 1024 * 1024;
+
+    KRByteLruCache<std::string, KRAnyValue> cache_{kMaxCacheBytes};
+    KRRequestCoalescer<std::string, std::function<void(const KRAnyValue &)>> pending_requests_;
+    KRRenderCallback miss_listener_;  // Kotlin 侧 listenCacheMiss 注册的常驻回调
+    std::mutex mutex_;
 };
 
 #endif  // CORE_RENDER_OHOS_KRMEMORYCACHEMODULE_H
@@ -107,7 +107,7 @@ class IKRRenderModuleExport : public std::enable_shared_from_this<IKRRenderModul
                                  bool callback_keep_alive = false) {
         auto instnce_id = instance_id_;
         auto result = new KRResult();
-        KRContextScheduler::ScheduleTaskOnMainThread(
+        auto finished = KRContextScheduler::ScheduleTaskOnMainThread(
             isSync, [isSync, result, module_name, method, instnce_id, params, callback, callback_keep_alive] {
                 auto module_name_value = std::make_shared<KRRenderValue>(module_name);
                 auto method_name = std::make_shared<KRRenderValue>(method);
@@ -118,6 +118,9 @@ class IKRRenderModuleExport : public std::enable_shared_from_this<IKRRenderModul
                     result->result = arktsResult;
                 }
             });
+        if (!finished) {
+            KR_LOG_ERROR << "sync call arkts method abandoned, module:" << module_name << ", method:" << method;
+        }
         auto r_result = result->result;
         delete result;
         return r_result;
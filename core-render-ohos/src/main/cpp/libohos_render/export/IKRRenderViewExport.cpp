@@ -127,25 +127,28 @@ void IKRRenderViewExport::ToSetProp(const std::string &prop_key, const KRAnyValu
     if (node_ == nullptr) {
         return;
     }
+    // bridge 层已登记ID时这里只比较地址；登记后基础属性、基础事件及组件 SetProp 均复用该ID
+    auto key_id = KRGetPropKeyId(prop_key);
+    if (key_id == KRPropKeyId::kFrame && prop_value->isString()) {
+        // frame 统一走 ToSetFrame，子类只需重写一处
+        KRRect frame;
+        const std::string &s = prop_value->toString();
+        memcpy(&frame, s.data(), s.size());
+        ToSetFrame(frame);
+        return;
+    }
     // 把设置过的key收集下, 以便ResetProp
     if (CanReuse()) {
         CollectReuseKeyIfNeed(prop_key);
     }
 
     auto didHanded = false;
+    KRPropKeyIdScope prop_key_scope(prop_key, key_id);
     if (base_props_handler_ != nullptr) {
-        auto isFrameProp = kuikly::util::isEqual(prop_key, "frame");
-        if (!(isFrameProp && CustomSetViewFrame())) {
-            didHanded = ToSetBaseProp(prop_key, prop_value, event_call_back);  // 基础属性设置分发处理
-        }
-        if (isFrameProp) {
-            const std::string &s = prop_value->toString();
-            memcpy(&frame_, s.data(), s.size());
-            SetRenderViewFrame(frame_);
-        }
+        didHanded = ToSetBaseProp(prop_key, prop_value, event_call_back);  // 基础属性设置分发处理
     }
     if (!didHanded && base_event_handler_ != nullptr) {
-        didHanded = base_event_handler_->SetProp(shared_from_this(), prop_key, prop_value,
+        didHanded = base_event_handler_->SetProp(shared_from_this(), key_id, prop_value,
                                                  event_call_back);  // 基础事件分发处理
     }
     if (!didHanded) {
@@ -161,6 +164,24 @@ void IKRRenderViewExport::ToSetProp(const std::string &prop_key, const KRAnyValu
     DidSetProp(prop_key);
 }
 
+void IKRRenderViewExport::ToSetFrame(const KRRect &frame) {
+    static const std::string kFramePropKey = "frame";
+    if (node_ == nullptr) {
+        return;
+    }
+    if (CanReuse()) {
+        CollectReuseKeyIfNeed(kFramePropKey);
+    }
+    if (base_props_handler_ != nullptr) {
+        if (!CustomSetViewFrame()) {
+            base_props_handler_->SetFrame(frame);
+        }
+        frame_ = frame;
+        SetRenderViewFrame(frame_);
+    }
+    DidSetProp(kFramePropKey);
+}
+
 bool IKRRenderViewExport::ResetProp(const std::string &prop_key) {
     return gExternalPropHandlerOnReset ? gExternalPropHandlerOnReset(GetNode(), prop_key.c_str()) : false;
 }
@@ -28,6 +28,7 @@
 #include "libohos_render/export/IKRRenderModuleExport.h"
 #include "libohos_render/export/IKRRenderShadowExport.h"
 #include "libohos_render/foundation/KRCommon.h"
+#include "libohos_render/foundation/KRPropKey.h"
 #include "libohos_render/foundation/KRRect.h"
 #include "libohos_render/foundation/thread/KRMainThread.h"
 #include "libohos_render/manager/KRArkTSManager.h"
@@ -44,7 +45,10 @@ using KRViewCreator = std::function<std::shared_ptr<IKRRenderViewExport>()>;
 
 class IKRRenderViewExport : public std::enable_shared_from_this<IKRRenderViewExport> {
  public:
-    virtual ~IKRRenderViewExport() = default;
+    virtual ~IKRRenderViewExport() {
+        // 事件 userData 指向 event_record_，未经 ToDestroy 直接析构时需兜底注销，避免回调访问悬空指针
+        KREventDispatchCenter::GetInstance().ReleaseEventRecord(node_, event_record_);
+    }
 
     virtual ArkUI_NodeHandle CreateNode() {
         return kuikly::util::GetNodeApi()->createNode(ARKUI_NODE_STACK);
@@ -270,6 +274,10 @@ class IKRRenderViewExport : public std::enable_shared_from_this<IKRRenderViewExp
         KREventDispatchCenter::GetInstance().RegisterEvent(shared_from_this(), event_type);
     }
 
+    KRNodeEventRecord &EventRecord() {
+        return event_record_;
+    }
+
     void ToOnEvent(ArkUI_NodeEvent *event, const ArkUI_NodeEventType &event_type) {
         KREnsureMainThread();
 
@@ -305,11 +313,18 @@ class IKRRenderViewExport : public std::enable_shared_from_this<IKRRenderViewExp
                                const KRRenderCallback event_call_back = nullptr) {
         KREnsureMainThread();
 
-        return base_props_handler_->SetProp(prop_key, prop_value, event_call_back);
+        // 经 ToSetProp 分发时属性ID已登记，这里只比较地址
+        return base_props_handler_->SetProp(KRGetPropKeyId(prop_key), prop_key, prop_value, event_call_back);
     }
 
     virtual void ToSetProp(const std::string &prop_key, const KRAnyValue &prop_value,
                            const KRRenderCallback event_call_back = nullptr);
+    /**
+     * 设置View的frame，类型化 SetFrame 通道与 ToSetProp("frame", ...) 均经过此处，无需将KRRect封装为属性值
+     * frame 的扩展点：需要拦截 frame 的子类重写此方法（frame 不再经过 ToSetBaseProp）
+     * @param frame
+     */
+    virtual void ToSetFrame(const KRRect &frame);
 #if 0  // implementation move to cpp file
     {
         if (node_ == nullptr) {
@@ -348,11 +363,13 @@ class IKRRenderViewExport : public std::enable_shared_from_this<IKRRenderViewExp
             return;
         }
         auto didHanded = false;
-        if (base_props_handler_ != nullptr && base_props_handler_->ResetProp(prop_key)) {
+        auto key_id = KRGetPropKeyId(prop_key);
+        KRPropKeyIdScope prop_key_scope(prop_key, key_id);
+        if (base_props_handler_ != nullptr && base_props_handler_->ResetProp(key_id)) {
             didHanded = true;
         }
         if (!didHanded && base_event_handler_ != nullptr) {
-            didHanded = base_event_handler_->ResetProp(prop_key);
+            didHanded = base_event_handler_->ResetProp(key_id);
         }
         if (!didHanded) {
             ResetProp(prop_key);
@@ -527,6 +544,7 @@ class IKRRenderViewExport : public std::enable_shared_from_this<IKRRenderViewExp
     float interrupt_x_ = -1;
     float interrupt_y_ = -1;
     bool handling_capture_event_ = false;
+    KRNodeEventRecord event_record_{this};
 };
 
 #endif  // CORE_RENDER_OHOS_IKRRENDERVIEWEXPORT_H
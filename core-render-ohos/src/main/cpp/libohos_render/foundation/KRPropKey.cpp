@@ -0,0 +1,151 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 THL A29 Limited, a Tencent company. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/foundation/KRPropKey.h"
+
+#include <string_view>
+#include <unordered_map>
+
+namespace {
+
+struct KRPropKeyEntry {
+    const char *name;
+    KRPropKeyId id;
+};
+
+constexpr KRPropKeyEntry kPropKeyEntries[] = {
+    {"backgroundColor", KRPropKeyId::kBackgroundColor},
+    {"frame", KRPropKeyId::kFrame},
+    {"borderRadius", KRPropKeyId::kBorderRadius},
+    {"border", KRPropKeyId::kBorder},
+    {"backgroundImage", KRPropKeyId::kBackgroundImage},
+    {"transform", KRPropKeyId::kTransform},
+    {"opacity", KRPropKeyId::kOpacity},
+    {"visibility", KRPropKeyId::kVisibility},
+    {"overflow", KRPropKeyId::kOverflow},
+    {"zIndex", KRPropKeyId::kZIndex},
+    {"touchEnable", KRPropKeyId::kTouchEnable},
+    {"accessibility", KRPropKeyId::kAccessibility},
+    {"boxShadow", KRPropKeyId::kBoxShadow},
+    {"animation", KRPropKeyId::kAnimation},
+    {"animationCompletion", KRPropKeyId::kAnimationCompletion},
+    {"click", KRPropKeyId::kClick},
+    {"doubleClick", KRPropKeyId::kDoubleClick},
+    {"longPress", KRPropKeyId::kLongPress},
+    {"pan", KRPropKeyId::kPan},
+    {"pinch", KRPropKeyId::kPinch},
+    {"capture", KRPropKeyId::kCapture},
+    {"touchDown", KRPropKeyId::kTouchDown},
+    {"touchMove", KRPropKeyId::kTouchMove},
+    {"touchUp", KRPropKeyId::kTouchUp},
+    {"preventTouch", KRPropKeyId::kPreventTouch},
+    {"superTouch", KRPropKeyId::kSuperTouch},
+    {"hit-test-ohos", KRPropKeyId::kHitTestModeOhos},
+    {"directionRow", KRPropKeyId::kDirectionRow},
+    {"pagingEnabled", KRPropKeyId::kPagingEnabled},
+    {"scrollEnabled", KRPropKeyId::kScrollEnabled},
+    {"verticalbounces", KRPropKeyId::kVerticalBounces},
+    {"horizontalbounces", KRPropKeyId::kHorizontalBounces},
+    {"bouncesEnable", KRPropKeyId::kBouncesEnable},
+    {"limitHeaderBounces", KRPropKeyId::kLimitHeaderBounces},
+    {"showScrollerIndicator", KRPropKeyId::kShowScrollerIndicator},
+    {"nestedScroll", KRPropKeyId::kNestedScroll},
+    {"scroll", KRPropKeyId::kScroll},
+    {"dragBegin", KRPropKeyId::kDragBegin},
+    {"willDragEnd", KRPropKeyId::kWillDragEnd},
+    {"dragEnd", KRPropKeyId::kDragEnd},
+    {"scrollEnd", KRPropKeyId::kScrollEnd},
+    {"src", KRPropKeyId::kSrc},
+    {"resize", KRPropKeyId::kResize},
+    {"blurRadius", KRPropKeyId::kBlurRadius},
+    {"tintColor", KRPropKeyId::kTintColor},
+    {"capInsets", KRPropKeyId::kCapInsets},
+    {"dotNineImage", KRPropKeyId::kDotNineImage},
+    {"maskLinearGradient", KRPropKeyId::kMaskLinearGradient},
+    {"dragEnable", KRPropKeyId::kDragEnable},
+    {"placeholder", KRPropKeyId::kPlaceholder},
+    {"loadSuccess", KRPropKeyId::kLoadSuccess},
+    {"loadResolution", KRPropKeyId::kLoadResolution},
+    {"loadFailure", KRPropKeyId::kLoadFailure},
+    {"autoPlay", KRPropKeyId::kAutoPlay},
+    {"repeatCount", KRPropKeyId::kRepeatCount},
+    {"animationStart", KRPropKeyId::kAnimationStart},
+    {"animationEnd", KRPropKeyId::kAnimationEnd},
+    {"text", KRPropKeyId::kText},
+    {"placeholderColor", KRPropKeyId::kPlaceholderColor},
+    {"fontSize", KRPropKeyId::kFontSize},
+    {"fontWeight", KRPropKeyId::kFontWeight},
+    {"color", KRPropKeyId::kColor},
+    {"textAlign", KRPropKeyId::kTextAlign},
+    {"editable", KRPropKeyId::kEditable},
+    {"keyboardType", KRPropKeyId::kKeyboardType},
+    {"returnKeyType", KRPropKeyId::kReturnKeyType},
+    {"maxTextLength", KRPropKeyId::kMaxTextLength},
+    {"textDidChange", KRPropKeyId::kTextDidChange},
+    {"inputFocus", KRPropKeyId::kInputFocus},
+    {"inputBlur", KRPropKeyId::kInputBlur},
+    {"inputReturn", KRPropKeyId::kInputReturn},
+    {"textLengthBeyondLimit", KRPropKeyId::kTextLengthBeyondLimit},
+    {"keyboardHeightChange", KRPropKeyId::kKeyboardHeightChange},
+};
+
+const std::unordered_map<std::string_view, KRPropKeyId> &GetPropKeyTable() {
+    // 仅首次访问时构建，之后只读，多线程访问安全
+    static const std::unordered_map<std::string_view, KRPropKeyId> table = [] {
+        std::unordered_map<std::string_view, KRPropKeyId> result;
+        result.reserve(sizeof(kPropKeyEntries) / sizeof(kPropKeyEntries[0]));
+        for (const auto &entry : kPropKeyEntries) {
+            result.emplace(entry.name, entry.id);
+        }
+        return result;
+    }();
+    return table;
+}
+
+struct KRDispatchingPropKey {
+    const std::string *key;
+    KRPropKeyId id;
+};
+
+KRDispatchingPropKey &GetDispatchingPropKey() {
+    static thread_local KRDispatchingPropKey dispatching = {nullptr, KRPropKeyId::kUnknown};
+    return dispatching;
+}
+
+}  // namespace
+
+KRPropKeyIdScope::KRPropKeyIdScope(const std::string &prop_key, KRPropKeyId id) {
+    auto &dispatching = GetDispatchingPropKey();
+    prev_key_ = dispatching.key;
+    prev_id_ = dispatching.id;
+    dispatching.key = &prop_key;
+    dispatching.id = id;
+}
+
+KRPropKeyIdScope::~KRPropKeyIdScope() {
+    auto &dispatching = GetDispatchingPropKey();
+    dispatching.key = prev_key_;
+    dispatching.id = prev_id_;
+}
+
+KRPropKeyId KRGetPropKeyId(const std::string &prop_key) {
+    const auto &dispatching = GetDispatchingPropKey();
+    if (dispatching.key == &prop_key) {
+        return dispatching.id;
+    }
+    const auto &table = GetPropKeyTable();
+    auto it = table.find(std::string_view(prop_key));
+    return it != table.end() ? it->second : KRPropKeyId::kUnknown;
+}
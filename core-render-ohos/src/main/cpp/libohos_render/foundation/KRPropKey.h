@@ -0,0 +1,140 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 THL A29 Limited, a Tencent company. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRPROPKEY_H
+#define CORE_RENDER_OHOS_KRPROPKEY_H
+
+#include <cstdint>
+#include <string>
+
+/**
+ * 内置属性/事件名的整型ID
+ * 属性名在进入View分发前只做一次哈希查找转换为ID，后续基础属性、基础事件以及内置组件的分发
+ * 直接基于ID做switch跳转，避免逐个strcmp比较；未内置的key统一为kUnknown，走原有字符串分发
+ */
+enum class KRPropKeyId : uint16_t {
+    kUnknown = 0,
+    // 基础属性
+    kBackgroundColor,
+    kFrame,
+    kBorderRadius,
+    kBorder,
+    kBackgroundImage,
+    kTransform,
+    kOpacity,
+    kVisibility,
+    kOverflow,
+    kZIndex,
+    kTouchEnable,
+    kAccessibility,
+    kBoxShadow,
+    kAnimation,
+    kAnimationCompletion,
+    // 基础事件
+    kClick,
+    kDoubleClick,
+    kLongPress,
+    kPan,
+    kPinch,
+    kCapture,
+    // View
+    kTouchDown,
+    kTouchMove,
+    kTouchUp,
+    kPreventTouch,
+    kSuperTouch,
+    kHitTestModeOhos,
+    // Scroller
+    kDirectionRow,
+    kPagingEnabled,
+    kScrollEnabled,
+    kVerticalBounces,
+    kHorizontalBounces,
+    kBouncesEnable,
+    kLimitHeaderBounces,
+    kShowScrollerIndicator,
+    kNestedScroll,
+    kScroll,
+    kDragBegin,
+    kWillDragEnd,
+    kDragEnd,
+    kScrollEnd,
+    // Image / APNG
+    kSrc,
+    kResize,
+    kBlurRadius,
+    kTintColor,
+    kCapInsets,
+    kDotNineImage,
+    kMaskLinearGradient,
+    kDragEnable,
+    kPlaceholder,
+    kLoadSuccess,
+    kLoadResolution,
+    kLoadFailure,
+    kAutoPlay,
+    kRepeatCount,
+    kAnimationStart,
+    kAnimationEnd,
+    // TextField
+    kText,
+    kPlaceholderColor,
+    kFontSize,
+    kFontWeight,
+    kColor,
+    kTextAlign,
+    kEditable,
+    kKeyboardType,
+    kReturnKeyType,
+    kMaxTextLength,
+    kTextDidChange,
+    kInputFocus,
+    kInputBlur,
+    kInputReturn,
+    kTextLengthBeyondLimit,
+    kKeyboardHeightChange,
+};
+
+/**
+ * 是否为基础属性（KRBasePropsHandler 处理的属性）
+ */
+inline bool KRIsBasePropKeyId(KRPropKeyId id) {
+    return id >= KRPropKeyId::kBackgroundColor && id <= KRPropKeyId::kAnimationCompletion;
+}
+
+/**
+ * 获取属性名对应的ID，未内置的属性名返回KRPropKeyId::kUnknown
+ * 若 prop_key 正是当前 KRPropKeyIdScope 登记的字符串对象，直接返回登记的ID，不再查表
+ */
+KRPropKeyId KRGetPropKeyId(const std::string &prop_key);
+
+/**
+ * 登记正在分发的属性名及其ID（当前线程、作用域内有效）
+ * bridge 层解析一次ID后登记，属性沿 ToSetProp -> 基础属性/事件 -> 组件 SetProp 分发时按同一字符串对象传递，
+ * 各层调用 KRGetPropKeyId 只需比较地址；作用域可嵌套
+ */
+class KRPropKeyIdScope {
+ public:
+    KRPropKeyIdScope(const std::string &prop_key, KRPropKeyId id);
+    ~KRPropKeyIdScope();
+    KRPropKeyIdScope(const KRPropKeyIdScope &) = delete;
+    KRPropKeyIdScope &operator=(const KRPropKeyIdScope &) = delete;
+
+ private:
+    const std::string *prev_key_;
+    KRPropKeyId prev_id_;
+};
+
+#endif  // CORE_RENDER_OHOS_KRPROPKEY_H
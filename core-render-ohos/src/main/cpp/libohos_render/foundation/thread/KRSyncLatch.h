@@ -0,0 +1,77 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 THL A29 Limited, a Tencent company. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRSYNCLATCH_H
+#define CORE_RENDER_OHOS_KRSYNCLATCH_H
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+/**
+ * 一次性同步门闩：一个线程 CountDown，另一个线程等待（可超时）
+ * 跨线程的等待/唤醒都在同一个 mutex 内完成，不会在 A 线程加锁、B 线程解锁
+ */
+class KRSyncLatch {
+ public:
+    /**
+     * 执行方开始执行前调用，等待方已放弃时返回 false，执行方不应再执行
+     */
+    bool TryStart() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (abandoned_) {
+            return false;
+        }
+        started_ = true;
+        return true;
+    }
+
+    /**
+     * 等待方超时后调用，执行方尚未开始时放弃并返回 true；已开始则返回 false，需继续等待其完成
+     */
+    bool Abandon() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (started_) {
+            return false;
+        }
+        abandoned_ = true;
+        return true;
+    }
+
+    void CountDown() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            done_ = true;
+        }
+        condition_.notify_all();
+    }
+
+    /**
+     * @return 超时前门闩已打开返回 true
+     */
+    bool WaitFor(std::chrono::milliseconds timeout) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return condition_.wait_for(lock, timeout, [this] { return done_; });
+    }
+
+ private:
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    bool started_ = false;
+    bool abandoned_ = false;
+    bool done_ = false;
+};
+
+#endif  // CORE_RENDER_OHOS_KRSYNCLATCH_H
@@ -0,0 +1,258 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 THL A29 Limited, a Tencent company. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRTASKQUEUE_H
+#define CORE_RENDER_OHOS_KRTASKQUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/**
+ * 带小对象优化的任务闭包，捕获不超过 kInlineSize 字节时不在堆上分配，仅支持移动
+ */
+class KRInlineTask {
+ public:
+    static constexpr size_t kInlineSize = 48;
+
+    KRInlineTask() = default;
+
+    template <typename F, typename Fn = std::decay_t<F>,
+              typename = std::enable_if_t<!std::is_same<Fn, KRInlineTask>::value>>
+    KRInlineTask(F &&func) {  // NOLINT
+        if constexpr (sizeof(Fn) <= kInlineSize && alignof(Fn) <= alignof(std::max_align_t) &&
+                      std::is_nothrow_move_constructible<Fn>::value) {
+            new (&storage_) Fn(std::forward<F>(func));
+            ops_ = &InlineOps<Fn>::kOps;
+        } else {
+            *reinterpret_cast<Fn **>(&storage_) = new Fn(std::forward<F>(func));
+            ops_ = &HeapOps<Fn>::kOps;
+        }
+    }
+
+    KRInlineTask(KRInlineTask &&other) noexcept {
+        MoveFrom(other);
+    }
+
+    KRInlineTask &operator=(KRInlineTask &&other) noexcept {
+        if (this != &other) {
+            Reset();
+            MoveFrom(other);
+        }
+        return *this;
+    }
+
+    KRInlineTask(const KRInlineTask &) = delete;
+    KRInlineTask &operator=(const KRInlineTask &) = delete;
+
+    ~KRInlineTask() {
+        Reset();
+    }
+
+    explicit operator bool() const {
+        return ops_ != nullptr;
+    }
+
+    void operator()() {
+        ops_->invoke(&storage_);
+    }
+
+    void Reset() {
+        if (ops_) {
+            ops_->destroy(&storage_);
+            ops_ = nullptr;
+        }
+    }
+
+ private:
+    struct Ops {
+        void (*invoke)(void *storage);
+        void (*move)(void *dst, void *src);
+        void (*destroy)(void *storage);
+    };
+
+    template <typename Fn>
+    struct InlineOps {
+        static void Invoke(void *storage) {
+            (*static_cast<Fn *>(storage))();
+        }
+        static void Move(void *dst, void *src) {
+            new (dst) Fn(std::move(*static_cast<Fn *>(src)));
+            static_cast<Fn *>(src)->~Fn();
+        }
+        static void Destroy(void *storage) {
+            static_cast<Fn *>(storage)->~Fn();
+        }
+        static constexpr Ops kOps{&Invoke, &Move, &Destroy};
+    };
+
+    template <typename Fn>
+    struct HeapOps {
+        static void Invoke(void *storage) {
+            (**static_cast<Fn **>(storage))();
+        }
+        static void Move(void *dst, void *src) {
+            *static_cast<Fn **>(dst) = *static_cast<Fn **>(src);
+        }
+        static void Destroy(void *storage) {
+            delete *static_cast<Fn **>(storage);
+        }
+        static constexpr Ops kOps{&Invoke, &Move, &Destroy};
+    };
+
+    void MoveFrom(KRInlineTask &other) {
+        if (other.ops_) {
+            other.ops_->move(&storage_, &other.storage_);
+            ops_ = other.ops_;
+            other.ops_ = nullptr;
+        }
+    }
+
+    std::aligned_storage_t<kInlineSize, alignof(std::max_align_t)> storage_;
+    const Ops *ops_ = nullptr;
+};
+
+/**
+ * 多生产者单消费者任务队列
+ * 主体为有界无锁环形缓冲（Vyukov 序号算法），环满时退化到加锁的溢出队列；
+ * 溢出队列非空期间新任务也进入溢出队列，保证同一生产者的任务顺序不变
+ */
+class KRMpscTaskQueue {
+ public:
+    explicit KRMpscTaskQueue(size_t capacity = 1024) {
+        size_t size = 2;
+        while (size < capacity) {
+            size <<= 1;
+        }
+        capacity_ = size;
+        mask_ = size - 1;
+        cells_.reset(new Cell[size]);
+        for (size_t i = 0; i < size; ++i) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    KRMpscTaskQueue(const KRMpscTaskQueue &) = delete;
+    KRMpscTaskQueue &operator=(const KRMpscTaskQueue &) = delete;
+
+    /**
+     * 任意线程调用
+     */
+    void Push(KRInlineTask &&task) {
+        if (overflow_count_.load(std::memory_order_acquire) == 0 && TryPushRing(task)) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(overflow_mutex_);
+        overflow_.push_back(std::move(task));
+        overflow_count_.fetch_add(1, std::memory_order_release);
+    }
+
+    /**
+     * 仅消费者线程调用。先取环形缓冲，为空时一次性取走溢出队列
+     */
+    bool Pop(KRInlineTask &task) {
+        if (!pending_overflow_.empty()) {
+            task = std::move(pending_overflow_.front());
+            pending_overflow_.pop_front();
+            return true;
+        }
+        if (TryPopRing(task)) {
+            return true;
+        }
+        if (overflow_count_.load(std::memory_order_acquire) == 0) {
+            return false;
+        }
+        {
+            std::lock_guard<std::mutex> lock(overflow_mutex_);
+            pending_overflow_.swap(overflow_);
+            overflow_count_.store(0, std::memory_order_release);
+        }
+        if (pending_overflow_.empty()) {
+            return false;
+        }
+        task = std::move(pending_overflow_.front());
+        pending_overflow_.pop_front();
+        return true;
+    }
+
+    /**
+     * 仅消费者线程调用
+     */
+    bool Empty() const {
+        if (!pending_overflow_.empty() || overflow_count_.load(std::memory_order_acquire) > 0) {
+            return false;
+        }
+        auto &cell = cells_[dequeue_pos_ & mask_];
+        return cell.sequence.load(std::memory_order_acquire) != dequeue_pos_ + 1;
+    }
+
+ private:
+    struct Cell {
+        std::atomic<size_t> sequence{0};
+        KRInlineTask task;
+    };
+
+    bool TryPushRing(KRInlineTask &task) {
+        size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+        Cell *cell = nullptr;
+        while (true) {
+            cell = &cells_[pos & mask_];
+            size_t seq = cell->sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;  // 环已满
+            } else {
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+        cell->task = std::move(task);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool TryPopRing(KRInlineTask &task) {
+        Cell &cell = cells_[dequeue_pos_ & mask_];
+        if (cell.sequence.load(std::memory_order_acquire) != dequeue_pos_ + 1) {
+            return false;
+        }
+        task = std::move(cell.task);
+        cell.sequence.store(dequeue_pos_ + capacity_, std::memory_order_release);
+        ++dequeue_pos_;
+        return true;
+    }
+
+    std::unique_ptr<Cell[]> cells_;
+    size_t capacity_ = 0;
+    size_t mask_ = 0;
+    alignas(64) std::atomic<size_t> enqueue_pos_{0};
+    alignas(64) size_t dequeue_pos_ = 0;
+    std::deque<KRInlineTask> pending_overflow_;
+
+    std::mutex overflow_mutex_;
+    std::deque<KRInlineTask> overflow_;
+    std::atomic<size_t> overflow_count_{0};
+};
+
+#endif  // CORE_RENDER_OHOS_KRTASKQUEUE_H
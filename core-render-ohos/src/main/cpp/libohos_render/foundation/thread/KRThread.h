@@ -16,57 +16,63 @@
 #ifndef CORE_RENDER_OHOS_KRTHREAD_H
 #define CORE_RENDER_OHOS_KRTHREAD_H
 
+#include <atomic>
 #include <cassert>
 #include <chrono>
 #include <condition_variable>
 #include <functional>
-#include <future>
 #include <mutex>
-#include <queue>
 #include <thread>
-#include "KRDelayThread.h"
+#include "KRTaskQueue.h"
+#include "KRTimerWheel.h"
 
 #include "libohos_render/utils/KRRenderLoger.h"
 class KRThread {
  public:
     explicit KRThread(const std::string &name) : m_stop(false) {
         m_workerThread = std::thread([this] {
-            m_workerThreadId = std::this_thread::get_id();
+            m_workerThreadId.store(std::this_thread::get_id(), std::memory_order_release);
             this->Worker();
         });
         pthread_setname_np(m_workerThread.native_handle(), name.c_str());
 
-        m_delayThread = new KRDelayThread(name + "d");
+        m_timerWheel = new KRTimerWheel(name + "d", [this](KRInlineTask &&task) { this->Enqueue(std::move(task)); });
     }
 
     ~KRThread() {
-        delete m_delayThread;
-        m_delayThread = nullptr;
+        delete m_timerWheel;
+        m_timerWheel = nullptr;
         {
             std::unique_lock<std::mutex> lock(m_mutex);
             m_stop = true;
-            m_condition.notify_one();
         }
+        m_condition.notify_one();
         m_workerThread.join();
     }
 
-    void DispatchAsync(const std::function<void()> &task, int delayMilliseconds = 0) {
+    template <typename F>
+    void DispatchAsync(F &&task, int delayMilliseconds = 0) {
         if (delayMilliseconds > 0) {
-            m_delayThread->DispatchAsync([task, this] { this->DispatchAsync(task, 0); }, delayMilliseconds);
+            DispatchDelayed(std::forward<F>(task), delayMilliseconds);
             return;
         }
-        if (IsCurrentThreadWorkerThread()) {
-            // 如果当前线程已经是工作线程，直接将任务添加到队列
-            std::unique_lock<std::mutex> lock(m_mutex);
-            m_tasks.emplace(task);
-        } else {
-            // 否则，将任务添加到队列
-            {
-                std::unique_lock<std::mutex> lock(m_mutex);
-                m_tasks.emplace(task);
-            }
-            m_condition.notify_one();
-        }
+        Enqueue(KRInlineTask(std::forward<F>(task)));
+    }
+
+    /**
+     * 延时派发任务，到期后直接进入任务队列
+     * @return 定时器 id，可通过 CancelDelayed 取消
+     */
+    template <typename F>
+    KRTimerWheel::TimerId DispatchDelayed(F &&task, int delayMilliseconds) {
+        return m_timerWheel->Schedule(std::forward<F>(task), delayMilliseconds);
+    }
+
+    /**
+     * 取消尚未到期的延时任务
+     */
+    bool CancelDelayed(KRTimerWheel::TimerId timerId) {
+        return m_timerWheel->Cancel(timerId);
     }
 
     void DispatchSync(const std::function<void()> &task) {
@@ -74,70 +80,57 @@ class KRThread {
         return;
     }
 
+    /**
+     * 在当前线程独占执行任务：等待工作线程让出执行权后直接执行，期间工作线程挂起。
+     * Context 线程正在同步等待主线程，或等待超过 100ms 时改为异步派发
+     */
     void DirectRunOnCurThread(const std::function<void()> &task) {
-        if (m_isExecutingTask.load()) {
+        if (m_taskOwner.load(std::memory_order_acquire) == std::this_thread::get_id()) {
+            // 当前线程已持有执行权（重入），直接执行
             task();
-        } else {
-            auto start = std::chrono::steady_clock::now();  // 记录开始时间
-            bool didHandleTask = false;
-            while (!SyncMainTaskMutex(false, false, false)) {
-                // 检查是否超时
-                auto now = std::chrono::steady_clock::now();
-                auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(now - start);
-                if (duration.count() > 100) {
-                    break;  // 超时，跳出循环
-                }
-                // 尝试获取互斥锁
-                if (TaskMutex(true, false, false)) {
-                    m_isExecutingTask.store(true);  // 设置正在执行任务标志
-                    task();
-                    m_isExecutingTask.store(false);  // 清除正在执行任务标志
-                    TaskMutex(false, true, false);
-                    didHandleTask = true;
-                    break;  // 任务执行完成，跳出循环
-                }
-            }
-            if (!didHandleTask) {
-                KR_LOG_INFO << "DispatchAsync when run DirectRunOnCurThread";
-                DispatchAsync(task);
-            }
+            return;
         }
-    }
-
-    bool TaskMutex(bool try_lock, bool is_set, bool value) {
-        std::unique_lock<std::mutex> lock(m_taskMutex);
-        if (try_lock) {
-            if (m_mutex_locked) {
-                return false;
-            } else {
-                m_mutex_locked = true;
-                return true;
+        bool acquired = false;
+        {
+            std::unique_lock<std::mutex> lock(m_ownerMutex);
+            m_directWaiters++;
+            acquired = m_ownerCondition.wait_for(lock, std::chrono::milliseconds(kDirectRunTimeoutMs),
+                                                 [this] { return m_syncMainTaskPending || !m_taskOwned; });
+            acquired = acquired && !m_syncMainTaskPending;
+            if (acquired) {
+                m_taskOwned = true;
+                m_taskOwner.store(std::this_thread::get_id(), std::memory_order_release);
             }
+            m_directWaiters--;
         }
-        if (is_set) {
-            m_mutex_locked = value;
+        if (!acquired) {
+            KR_LOG_INFO << "DispatchAsync when run DirectRunOnCurThread";
+            m_ownerCondition.notify_all();
+            DispatchAsync(task);
+            return;
         }
-        return m_mutex_locked;
+        task();
+        ReleaseTaskOwnership();
     }
 
-    bool SyncMainTaskMutex(bool try_lock, bool is_set, bool value) {
-        std::unique_lock<std::mutex> lock(m_syncMainTaskMutex);
-        if (try_lock) {
-            if (m_sync_main_task_locked) {
-                return false;
-            } else {
-                m_sync_main_task_locked = true;
-                return true;
-            }
-        }
-        if (is_set) {
-            m_sync_main_task_locked = value;
+    /**
+     * Context 线程同步等待主线程前调用，让正在等待执行权的主线程立即改为异步派发，避免死锁
+     */
+    void BeginSyncMainTask() {
+        {
+            std::lock_guard<std::mutex> lock(m_ownerMutex);
+            m_syncMainTaskPending = true;
         }
-        return m_sync_main_task_locked;
+        m_ownerCondition.notify_all();
+    }
+
+    void EndSyncMainTask() {
+        std::lock_guard<std::mutex> lock(m_ownerMutex);
+        m_syncMainTaskPending = false;
     }
 
     bool IsCurrentThreadWorkerThread() const {
-        return std::this_thread::get_id() == m_workerThreadId;
+        return std::this_thread::get_id() == m_workerThreadId.load(std::memory_order_acquire);
     }
 
     void AssertCurrentThreadWorker() {
@@ -145,50 +138,78 @@ class KRThread {
     }
 
  private:
+    static constexpr int kDirectRunTimeoutMs = 100;
+
+    void Enqueue(KRInlineTask &&task) {
+        m_tasks.Push(std::move(task));
+        // 与 Worker 中的 m_workerWaiting 构成 Dekker 式配对，只在工作线程将要休眠时才加锁唤醒。
+        // 两侧的 seq_cst 栅栏保证：要么工作线程看到新任务，要么这里看到其将要休眠
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_workerWaiting.load(std::memory_order_relaxed)) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_condition.notify_one();
+        }
+    }
+
+    void AcquireTaskOwnership() {
+        std::unique_lock<std::mutex> lock(m_ownerMutex);
+        // 有线程在等待直接执行时让其优先
+        m_ownerCondition.wait(lock, [this] { return !m_taskOwned && m_directWaiters == 0; });
+        m_taskOwned = true;
+        m_taskOwner.store(std::this_thread::get_id(), std::memory_order_release);
+    }
+
+    void ReleaseTaskOwnership() {
+        {
+            std::lock_guard<std::mutex> lock(m_ownerMutex);
+            m_taskOwned = false;
+            m_taskOwner.store(std::thread::id(), std::memory_order_release);
+        }
+        m_ownerCondition.notify_all();
+    }
+
     void Worker() {
+        KRInlineTask task;
         while (true) {
-            std::queue<std::function<void()>> tasks;
-            {
+            if (m_tasks.Empty()) {
                 std::unique_lock<std::mutex> lock(m_mutex);
-                m_condition.wait(lock, [this] { return m_stop || !m_tasks.empty(); });
-
-                if (m_stop && m_tasks.empty()) {
+                m_workerWaiting.store(true, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                m_condition.wait(lock, [this] { return m_stop || !m_tasks.Empty(); });
+                m_workerWaiting.store(false, std::memory_order_relaxed);
+                if (m_stop && m_tasks.Empty()) {
                     break;
                 }
-
-                std::swap(tasks, m_tasks);  // 将m_tasks所有任务一次性移动到tasks
             }
-            {
-                if (TaskMutex(true, false, false)) {
-                    while (!tasks.empty()) {
-                        auto &task = tasks.front();
-                        task();
-                        tasks.pop();
-                    }
-                    TaskMutex(false, true, false);
-                } else {
-                    std::unique_lock<std::mutex> lock(m_mutex);
-                    while (!tasks.empty()) {
-                        m_tasks.push(std::move(tasks.front()));
-                        tasks.pop();
-                    }
+            AcquireTaskOwnership();
+            while (m_tasks.Pop(task)) {
+                task();
+                task.Reset();
+                if (m_directWaiters.load(std::memory_order_relaxed) > 0) {
+                    break;  // 让出执行权给同步调用方
                 }
             }
+            ReleaseTaskOwnership();
         }
     }
 
-    std::queue<std::function<void()>> m_tasks;
+    KRMpscTaskQueue m_tasks;
     std::mutex m_mutex;
-    std::mutex m_taskMutex;
-    bool m_mutex_locked = false;
-    std::mutex m_syncMainTaskMutex;
-    bool m_sync_main_task_locked = false;
     std::condition_variable m_condition;
+    std::atomic<bool> m_workerWaiting{false};
     bool m_stop = false;
+
+    // 执行权：工作线程与 DirectRunOnCurThread 的调用方互斥执行任务
+    std::mutex m_ownerMutex;
+    std::condition_variable m_ownerCondition;
+    bool m_taskOwned = false;
+    std::atomic<int> m_directWaiters{0};  // 仅在 m_ownerMutex 内修改
+    bool m_syncMainTaskPending = false;
+    std::atomic<std::thread::id> m_taskOwner{std::thread::id()};
+
     std::thread m_workerThread;
-    std::thread::id m_workerThreadId;
-    KRDelayThread *m_delayThread = nullptr;
-    std::atomic<bool> m_isExecutingTask{false};
+    std::atomic<std::thread::id> m_workerThreadId{std::thread::id()};
+    KRTimerWheel *m_timerWheel = nullptr;
 };
 
 #endif  // CORE_RENDER_OHOS_KRTHREAD_H
@@ -0,0 +1,315 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 THL A29 Limited, a Tencent company. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRTIMERWHEEL_H
+#define CORE_RENDER_OHOS_KRTIMERWHEEL_H
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "KRTaskQueue.h"
+
+/**
+ * 分层时间轮定时器（1ms 精度，4 层 × 64 槽，覆盖约 4.6 小时，更长的定时器逐层回落）
+ * 插入与取消均为 O(1)；到期任务通过 on_fire 回调直接交给目标队列，不再二次包装
+ */
+class KRTimerWheel {
+ public:
+    using TimerId = uint64_t;
+    using FireCallback = std::function<void(KRInlineTask &&task)>;
+
+    KRTimerWheel(const std::string &name, FireCallback on_fire)
+        : on_fire_(std::move(on_fire)), start_(std::chrono::steady_clock::now()) {
+        for (auto &level : slots_) {
+            for (auto &slot : level) {
+                slot = nullptr;
+            }
+        }
+        thread_ = std::thread([this] { this->Run(); });
+        pthread_setname_np(thread_.native_handle(), name.c_str());
+    }
+
+    ~KRTimerWheel() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        condition_.notify_one();
+        thread_.join();
+        for (auto &it : timers_) {
+            delete it.second;
+        }
+    }
+
+    KRTimerWheel(const KRTimerWheel &) = delete;
+    KRTimerWheel &operator=(const KRTimerWheel &) = delete;
+
+    /**
+     * 添加定时器
+     * @return 定时器 id，可用于 Cancel
+     */
+    template <typename F>
+    TimerId Schedule(F &&task, int delay_ms) {
+        auto node = new Node();
+        node->task = KRInlineTask(std::forward<F>(task));
+        bool need_wake = false;
+        TimerId id = 0;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            id = ++last_id_;
+            node->id = id;
+            if (timers_.empty()) {
+                // 空闲期间没有推进 tick，直接对齐到当前时间
+                current_tick_ = std::max(current_tick_, NowTick());
+            }
+            node->expire_tick = NowTickCeil() + static_cast<uint64_t>(delay_ms > 0 ? delay_ms : 0);
+            if (node->expire_tick <= current_tick_) {
+                // 当前 tick 已处理过，顺延到下一个 tick
+                node->expire_tick = current_tick_ + 1;
+            }
+            timers_[id] = node;
+            Insert(node);
+            need_wake = node->expire_tick < wake_tick_;
+        }
+        if (need_wake) {
+            condition_.notify_one();
+        }
+        return id;
+    }
+
+    /**
+     * 取消定时器
+     * @return 定时器尚未触发且取消成功返回 true
+     */
+    bool Cancel(TimerId id) {
+        Node *node = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = timers_.find(id);
+            if (it == timers_.end()) {
+                return false;
+            }
+            node = it->second;
+            timers_.erase(it);
+            Unlink(node);
+        }
+        delete node;
+        return true;
+    }
+
+ private:
+    static constexpr int kLevels = 4;
+    static constexpr int kSlotBits = 6;
+    static constexpr int kSlots = 1 << kSlotBits;
+    static constexpr uint64_t kSlotMask = kSlots - 1;
+    static constexpr uint64_t kMaxDelta = (1ULL << (kSlotBits * kLevels)) - 1;
+    static constexpr uint64_t kNoWake = UINT64_MAX;
+
+    struct Node {
+        TimerId id = 0;
+        uint64_t expire_tick = 0;
+        int level = 0;
+        int slot = 0;
+        Node *prev = nullptr;
+        Node *next = nullptr;
+        KRInlineTask task;
+    };
+
+    uint64_t NowTick() const {
+        return static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start_).count());
+    }
+
+    /**
+     * 向上取整，保证定时器不会早于指定延时触发
+     */
+    uint64_t NowTickCeil() const {
+        auto elapsed =
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start_).count();
+        return static_cast<uint64_t>((elapsed + 999) / 1000);
+    }
+
+    void Insert(Node *node) {
+        uint64_t delta = node->expire_tick - current_tick_;
+        uint64_t placement = node->expire_tick;
+        if (delta > kMaxDelta) {
+            // 超出时间轮范围的先放在最高层，回落时按真实到期时间重新插入
+            placement = current_tick_ + kMaxDelta;
+            delta = kMaxDelta;
+        }
+        int level = 0;
+        while (level < kLevels - 1 && delta >= (1ULL << (kSlotBits * (level + 1)))) {
+            level++;
+        }
+        int slot = static_cast<int>((placement >> (kSlotBits * level)) & kSlotMask);
+        node->level = level;
+        node->slot = slot;
+        node->prev = nullptr;
+        node->next = slots_[level][slot];
+        if (node->next) {
+            node->next->prev = node;
+        }
+        slots_[level][slot] = node;
+        level_counts_[level]++;
+    }
+
+    void Unlink(Node *node) {
+        if (node->prev) {
+            node->prev->next = node->next;
+        } else {
+            slots_[node->level][node->slot] = node->next;
+        }
+        if (node->next) {
+            node->next->prev = node->prev;
+        }
+        node->prev = node->next = nullptr;
+        level_counts_[node->level]--;
+    }
+
+    void Cascade(int level, int slot) {
+        Node *node = slots_[level][slot];
+        slots_[level][slot] = nullptr;
+        while (node) {
+            Node *next = node->next;
+            level_counts_[level]--;
+            Insert(node);
+            node = next;
+        }
+    }
+
+    int LowestNonEmptyLevel() const {
+        for (int level = 0; level < kLevels; level++) {
+            if (level_counts_[level] > 0) {
+                return level;
+            }
+        }
+        return kLevels;
+    }
+
+    /**
+     * 推进到 target tick，收集到期任务
+     */
+    void Advance(uint64_t target, std::vector<KRInlineTask> &expired) {
+        while (current_tick_ < target) {
+            int level = LowestNonEmptyLevel();
+            if (level == kLevels) {
+                current_tick_ = target;
+                break;
+            }
+            if (level > 0) {
+                // 低层为空时直接跳到下一个需要回落的边界
+                uint64_t boundary = (current_tick_ | ((1ULL << (kSlotBits * level)) - 1)) + 1;
+                if (boundary > target) {
+                    current_tick_ = target;
+                    break;
+                }
+                current_tick_ = boundary - 1;
+            }
+            uint64_t tick = ++current_tick_;
+            for (int l = kLevels - 1; l > 0; l--) {
+                if ((tick & ((1ULL << (kSlotBits * l)) - 1)) == 0) {
+                    Cascade(l, static_cast<int>((tick >> (kSlotBits * l)) & kSlotMask));
+                }
+            }
+            int slot = static_cast<int>(tick & kSlotMask);
+            Node *node = slots_[0][slot];
+            slots_[0][slot] = nullptr;
+            while (node) {
+                Node *next = node->next;
+                level_counts_[0]--;
+                timers_.erase(node->id);
+                expired.push_back(std::move(node->task));
+                delete node;
+                node = next;
+            }
+        }
+    }
+
+    /**
+     * 下一次需要醒来的 tick：level 0 最近的非空槽与更高层最近的回落边界取较小者
+     */
+    uint64_t NextWakeTick() const {
+        uint64_t wake_tick = kNoWake;
+        if (level_counts_[0] > 0) {
+            for (uint64_t tick = current_tick_ + 1; tick <= current_tick_ + kSlots; tick++) {
+                if (slots_[0][tick & kSlotMask]) {
+                    wake_tick = tick;
+                    break;
+                }
+            }
+        }
+        for (int level = 1; level < kLevels; level++) {
+            if (level_counts_[level] > 0) {
+                // 低层的回落边界更早，找到第一个非空层即可
+                uint64_t boundary = (current_tick_ | ((1ULL << (kSlotBits * level)) - 1)) + 1;
+                wake_tick = std::min(wake_tick, boundary);
+                break;
+            }
+        }
+        return wake_tick;
+    }
+
+    void Run() {
+        std::vector<KRInlineTask> expired;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                while (true) {
+                    if (stop_) {
+                        return;
+                    }
+                    Advance(NowTick(), expired);
+                    if (!expired.empty()) {
+                        break;
+                    }
+                    wake_tick_ = NextWakeTick();
+                    if (wake_tick_ == kNoWake) {
+                        condition_.wait(lock);
+                    } else {
+                        condition_.wait_until(lock, start_ + std::chrono::milliseconds(wake_tick_));
+                    }
+                    wake_tick_ = 0;
+                }
+            }
+            for (auto &task : expired) {
+                on_fire_(std::move(task));
+            }
+            expired.clear();
+        }
+    }
+
+    FireCallback on_fire_;
+    std::chrono::steady_clock::time_point start_;
+    Node *slots_[kLevels][kSlots];
+    int level_counts_[kLevels] = {0};
+    std::unordered_map<TimerId, Node *> timers_;
+    uint64_t current_tick_ = 0;
+    uint64_t wake_tick_ = 0;
+    TimerId last_id_ = 0;
+
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    bool stop_ = false;
+    std::thread thread_;
+};
+
+#endif  // CORE_RENDER_OHOS_KRTIMERWHEEL_H
@@ -22,19 +22,22 @@
 #include <js_native_api_types.h>
 #include <cmath>
 #include <cstdint>
+#include <cstring>
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
 #include <variant>
 #include <vector>
 #include "KRRenderCValue.h"
 #include "libohos_render/foundation/ark_ts.h"
 #include "libohos_render/foundation/type/KRRenderCValue.h"
+#include "libohos_render/foundation/type/KRRenderValueJson.h"
+#include "libohos_render/foundation/type/KRRenderValuePool.h"
 #include "libohos_render/utils/KRJsUtil.h"
 #include "libohos_render/utils/KRRenderLoger.h"
 #include "libohos_render/utils/NAPIUtil.h"
-#include "thirdparty/cJSON/cJSON.h"
 
 static std::string DoubleToString(double value) {
     std::ostringstream oss;
@@ -75,10 +78,42 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
 
     KRRenderValue() {
         value_ = std::monostate();
-        json_to_map_or_array_value_ = std::monostate();
         c_value_.type = KRRenderCValue::Type::NULL_VALUE;
     }
 
+    /**
+     * 创建 KRRenderValue（NewKRRenderValue / KREmptyValue 均走这里）
+     * null、bool 以及小整数返回共享的只读实例，其余类型从对象池分配，减少跨桥传参时的堆分配
+     */
+    static std::shared_ptr<KRRenderValue> Create() {
+        return SharedNullValue();
+    }
+
+    template <typename T>
+    static std::shared_ptr<KRRenderValue> Create(T &&value) {
+        using ValueType = std::decay_t<T>;
+        if constexpr (std::is_same_v<ValueType, std::nullptr_t>) {
+            return SharedNullValue();
+        } else if constexpr (std::is_same_v<ValueType, bool>) {
+            return SharedBoolValue(value);
+        } else if constexpr (std::is_same_v<ValueType, int32_t>) {
+            if (value >= kSharedIntMin && value <= kSharedIntMax) {
+                return SharedIntValue(value);
+            }
+        } else if constexpr (std::is_same_v<ValueType, KRRenderCValue>) {
+            if (value.type == KRRenderCValue::Type::NULL_VALUE) {
+                return SharedNullValue();
+            } else if (value.type == KRRenderCValue::Type::BOOL) {
+                return SharedBoolValue(value.value.boolValue != 0);
+            } else if (value.type == KRRenderCValue::Type::INT && value.value.intValue >= kSharedIntMin &&
+                       value.value.intValue <= kSharedIntMax) {
+                return SharedIntValue(value.value.intValue);
+            }
+        }
+        return std::allocate_shared<KRRenderValue>(KRRenderValuePoolAllocator<KRRenderValue>(),
+                                                   std::forward<T>(value));
+    }
+
     explicit KRRenderValue(std::nullptr_t) : KRRenderValue() {}
 
     explicit KRRenderValue(bool value) : KRRenderValue() {
@@ -105,6 +140,10 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
         value_ = value;
     }
 
+    explicit KRRenderValue(std::string &&value) : KRRenderValue() {
+        value_ = std::move(value);
+    }
+
     explicit KRRenderValue(const char *value) : KRRenderValue() {
         value_ = std::string(value);
     }
@@ -113,10 +152,18 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
         value_ = value;
     }
 
+    explicit KRRenderValue(Map &&value) : KRRenderValue() {
+        value_ = std::move(value);
+    }
+
     explicit KRRenderValue(const Array &value) : KRRenderValue() {
         value_ = value;
     }
 
+    explicit KRRenderValue(Array &&value) : KRRenderValue() {
+        value_ = std::move(value);
+    }
+
     explicit KRRenderValue(const ByteArray &value) : KRRenderValue() {
         value_ = value;
     }
@@ -135,18 +182,13 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
         } else if (cValue.type == KRRenderCValue::Type::STRING) {
             value_ = std::string(cValue.value.stringValue);
         } else if (cValue.type == KRRenderCValue::Type::BYTES) {
-            auto length = cValue.size;
-            auto start_address = cValue.value.bytesValue;
-            auto bytes = std::make_shared<std::vector<uint8_t>>();
-            for (int i = 0; i < length; i++) {
-                bytes->push_back(*(reinterpret_cast<uint8_t *>(start_address + i)));
-            }
-            value_ = bytes;
+            // C 侧指针只在调用期间有效，这里整段拷贝一次
+            value_ = CopyBytes(cValue.value.bytesValue, cValue.size > 0 ? cValue.size : 0);
         } else if (cValue.type == KRRenderCValue::Type::ARRAY) {
             auto array_size = cValue.size;
             Array array;
             for (int i = 0; i < array_size; i++) {
-                array.push_back(std::make_shared<KRRenderValue>(cValue.value.arrayValue[i]));
+                array.push_back(Create(cValue.value.arrayValue[i]));
             }
             value_ = array;
         } else {
@@ -180,12 +222,7 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
                 void *byte_array = nullptr;
                 size_t byte_length;
                 napi_get_arraybuffer_info(napi_env, nvalue, &byte_array, &byte_length);
-                auto bytes = std::make_shared<std::vector<uint8_t>>();
-                auto byte_buffer = reinterpret_cast<uint8_t *>(byte_array);
-                for (int i = 0; i < byte_length; i++) {
-                    bytes->push_back(*(byte_buffer + i));
-                }
-                value_ = bytes;
+                value_ = CopyBytes(byte_array, byte_length);
                 return;
             }
 
@@ -200,9 +237,8 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
                                                               &typedArrayData, &arraybuffer, &byteOffset);
                 if (status == napi_ok && typedArrayType == napi_int8_array) {
                     if (typedArrayData != nullptr) {
-                        value_ = std::make_shared<std::vector<uint8_t>>(byteOffset + (const char *)typedArrayData,
-                                                                        typedArrayLength + byteOffset +
-                                                                            (const char *)typedArrayData);
+                        value_ = CopyBytes(static_cast<const uint8_t *>(typedArrayData) + byteOffset,
+                                                   typedArrayLength);
                     } else {
                         value_ = std::make_shared<std::vector<uint8_t>>();
                     }
@@ -251,12 +287,7 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
                 void *byte_array = nullptr;
                 size_t byte_length;
                 OH_JSVM_GetArraybufferInfo(js_env, js_value, &byte_array, &byte_length);
-                auto bytes = std::make_shared<std::vector<uint8_t>>();
-                auto byte_buffer = reinterpret_cast<uint8_t *>(byte_array);
-                for (int i = 0; i < byte_length; i++) {
-                    bytes->push_back(*(byte_buffer + i));
-                }
-                value_ = bytes;
+                value_ = CopyBytes(byte_array, byte_length);
                 return;
             }
             bool is_type_array;
@@ -268,12 +299,7 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
                 JSVM_Value retArrayBuffer;
                 size_t byteOffset = -1;
                 OH_JSVM_GetTypedarrayInfo(js_env, js_value, &type, &length, &data, &retArrayBuffer, &byteOffset);
-                auto bytes = std::make_shared<std::vector<uint8_t>>();
-                auto byte_buffer = reinterpret_cast<uint8_t *>(data);
-                for (int i = 0; i < length; i++) {
-                    bytes->push_back(*(byte_buffer + i));
-                }
-                value_ = bytes;
+                value_ = CopyBytes(data, length);
                 return;
             }
 
@@ -411,70 +437,66 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
             return std::get<std::string>(value_);
         }
         if (isBool() || isInt() || isDouble() || isFloat() || isLong()) {  // number to string
-            auto numberString = DoubleToString(toDouble());
-            if (numberString == "0") {
-                outputToStringResult_ = std::string("");
-                return outputToStringResult_;
+            auto &cache = GetCache();
+            if (!cache.number_string_ready) {  // 值不可变，只需转换一次
+                auto numberString = DoubleToString(toDouble());
+                if (numberString != "0") {
+                    cache.output_to_string_result = std::move(numberString);
+                }
+                cache.number_string_ready = true;
             }
-            outputToStringResult_ = numberString;
-            return outputToStringResult_;
+            return cache.output_to_string_result;
         }
         if (isMap() || isArray()) {  // map or array to string
-            cJSON* cjson = toJson( shared_from_this());
-            if(char* p = cJSON_Print(cjson)){
-                outputToStringResult_ = p;
-                cJSON_free(p);
-            }
-            cJSON_Delete(cjson);
-            return outputToStringResult_;
+            auto &cache = GetCache();
+            cache.output_to_string_result.clear();
+            KRRenderValueJson::Write(*this, cache.output_to_string_result);
+            return cache.output_to_string_result;
         }
-        outputToStringResult_ = "";
-        return outputToStringResult_;
+        return EmptyString();
     }
 
     const Map &toMap() const {
         if (isMap()) {
             return std::get<Map>(value_);
-        } else if (std::holds_alternative<Map>(json_to_map_or_array_value_)) {
-            return std::get<Map>(json_to_map_or_array_value_);
         } else if (isString()) {
-            cJSON *cjson = cJSON_Parse(toString().c_str());
-            if(cjson == nullptr){
-                json_to_map_or_array_value_ = Map();
-                return std::get<Map>(json_to_map_or_array_value_);
+            auto &cache = GetCache();
+            if (std::holds_alternative<Map>(cache.json_to_map_or_array_value)) {
+                return std::get<Map>(cache.json_to_map_or_array_value);
             }
-            Map map;
-            for (cJSON *item = cjson->child; item != NULL; item = item->next) {
-                map[item->string] = fromJsonValue(item);
+            auto &str = std::get<std::string>(value_);
+            auto json_value = KRRenderValueJson::Parse(str.data(), str.size());
+            if (json_value != nullptr && json_value->isMap()) {
+                cache.json_to_map_or_array_value = std::move(std::get<Map>(json_value->value_));
+            } else {
+                cache.json_to_map_or_array_value = Map();
             }
-            json_to_map_or_array_value_ = map;
-            return std::get<Map>(json_to_map_or_array_value_);
+            return std::get<Map>(cache.json_to_map_or_array_value);
         } else {
-            json_to_map_or_array_value_ = Map();
-            return std::get<Map>(json_to_map_or_array_value_);
+            static const Map kEmptyMap;
+            return kEmptyMap;
         }
     }
 
     const Array &toArray() const {
         if (isArray()) {
             return std::get<Array>(value_);
-        } else if (std::holds_alternative<Array>(json_to_map_or_array_value_)) {
-            return std::get<Array>(json_to_map_or_array_value_);
         } else if (isString()) {
-            cJSON *cjson = cJSON_Parse(toString().c_str());
-            if(cjson == nullptr){
-                json_to_map_or_array_value_ = Array();
-                return std::get<Array>(json_to_map_or_array_value_);
+            auto &cache = GetCache();
+            if (std::holds_alternative<Array>(cache.json_to_map_or_array_value)) {
+                return std::get<Array>(cache.json_to_map_or_array_value);
             }
-            Array json_vec;
-            for(int i = 0; i < cJSON_GetArraySize(cjson); ++i){
-                json_vec.push_back(fromJsonValue(cJSON_GetArrayItem(cjson, i)));
+            auto &str = std::get<std::string>(value_);
+            auto json_value = KRRenderValueJson::Parse(str.data(), str.size());
+            if (json_value != nullptr && json_value->isArray()) {
+                cache.json_to_map_or_array_value = std::move(std::get<Array>(json_value->value_));
+            } else {
+                cache.json_to_map_or_array_value = Array();
             }
-            json_to_map_or_array_value_ = json_vec;
-            return std::get<Array>(json_to_map_or_array_value_);
+            return std::get<Array>(cache.json_to_map_or_array_value);
         } else {
-            json_to_map_or_array_value_ = Array();
-            return std::get<Array>(json_to_map_or_array_value_);
+            static const Array kEmptyArray;
+            return kEmptyArray;
         }
     }
 
@@ -519,19 +541,18 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
         } else if (isArray()) {
             auto &array = toArray();
             if (HadByteArrayElement(array)) {  // 有二进制元素的话, 不进行 json 序列化，直接传递数组
+                auto &cache = GetCache();
                 c_value_.type = KRRenderCValue::Type::ARRAY;
                 c_value_.size = array.size();
-                array_ptr_ = new KRRenderCValue[c_value_.size];
+                cache.array_ptr.reset(new KRRenderCValue[c_value_.size]);
                 for (int i = 0; i < c_value_.size; i++) {
                     auto &item = array[i];
-                    array_ptr_[i] = item->toCValue();
+                    cache.array_ptr[i] = item->toCValue();
                 }
-                c_value_.value.arrayValue = array_ptr_;
+                c_value_.value.arrayValue = cache.array_ptr.get();
             } else {
                 ToJsonMapOrArray();
             }
-        } else {
-            c_value_.type = KRRenderCValue::Type::NULL_VALUE;
         }
 
         return c_value_;
@@ -555,12 +576,9 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
             void *buffer = nullptr;
             JSVM_Value array_buffer_value = nullptr;
             js_status = OH_JSVM_CreateArraybuffer(js_env, size, &buffer, &array_buffer_value);
-            if (js_status == JSVM_OK) {
-                auto byte_buffer = reinterpret_cast<uint8_t *>(buffer);
-                auto origin_buffer = data.get()->data();
-                for (int i = 0; i < size; i++) {
-                    byte_buffer[i] = origin_buffer[i];
-                }
+            if (js_status == JSVM_OK && size > 0) {
+                // JSVM 没有可挂释放回调的 external arraybuffer，只能整段拷贝
+                std::memcpy(buffer, data->data(), size);
             }
             OH_JSVM_CreateTypedarray(js_env, JSVM_TypedarrayType::JSVM_INT8_ARRAY, size, array_buffer_value, 0,
                                      js_value);
@@ -602,15 +620,9 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
         } else if (isByteArray()) {
             auto &data = toByteArray();
             auto size = data->size();
-            void *buffer = nullptr;
             napi_value arrayBuffer;
-            nstatus = napi_create_arraybuffer(env, size, &buffer, &arrayBuffer);
+            nstatus = CreateArrayBuffer(env, data, &arrayBuffer);
             if (nstatus == napi_ok) {
-                auto byte_buffer = reinterpret_cast<uint8_t *>(buffer);
-                auto origin_buffer = data.get()->data();
-                for (int i = 0; i < size; i++) {
-                    byte_buffer[i] = origin_buffer[i];
-                }
                 nstatus = napi_create_typedarray(env, napi_int8_array, size, arrayBuffer, 0, nvalue);
             }
         } else if (isMap()) {
@@ -640,53 +652,120 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
         }
     }
 
-    ~KRRenderValue() {
-        if (array_ptr_) {
-            delete[] array_ptr_;
-            array_ptr_ = nullptr;
-        }
-    }
+    ~KRRenderValue() = default;
 
  private:
+    /**
+     * 转换结果缓存，只有发生 toString/toMap/toArray/toCValue 等转换时才分配
+     * 大部分标量值不会用到，避免每个值都携带这些字段
+     */
+    struct ConvertCache {
+        std::string map_or_array_json_value;  // 缓存经过序列化的 map或者 array, 用于缓存经过序列化的std::string
+        std::variant<std::monostate, Map, Array> json_to_map_or_array_value;
+        std::string output_to_string_result;
+        bool number_string_ready = false;
+        std::unique_ptr<KRRenderCValue[]> array_ptr;  // 指向数组的指针, 用于防止数组元素copy
+    };
+
+    static constexpr int32_t kSharedIntMin = -128;
+    static constexpr int32_t kSharedIntMax = 1024;
+
     std::variant<std::monostate, bool, int32_t, int64_t, float, double, std::string, Map, Array, void *, ByteArray,
                  NapiValue>
         value_;
-    mutable std::string map_or_array_json_value_;  // 缓存经过序列化的 map或者 array, 用于缓存经过序列化的std::string
     mutable KRRenderCValue c_value_;
-    mutable std::variant<std::monostate, Map, Array> json_to_map_or_array_value_;
-    mutable std::string outputToStringResult_;
-    mutable KRRenderCValue *array_ptr_ = nullptr;  // 指向数组的指针, 用于防止数组元素copy
+    mutable std::unique_ptr<ConvertCache> cache_;
+
+    ConvertCache &GetCache() const {
+        if (!cache_) {
+            cache_ = std::make_unique<ConvertCache>();
+        }
+        return *cache_;
+    }
+
+    static const std::string &EmptyString() {
+        static const std::string kEmptyString;
+        return kEmptyString;
+    }
+
+    /**
+     * 共享实例会被多线程同时读取，创建时预先完成 toString/toCValue 转换，之后只读不写
+     */
+    static std::shared_ptr<KRRenderValue> MakeSharedValue(std::shared_ptr<KRRenderValue> value) {
+        value->toString();
+        value->toCValue();
+        return value;
+    }
+
+    static std::shared_ptr<KRRenderValue> SharedNullValue() {
+        static const std::shared_ptr<KRRenderValue> kNullValue = MakeSharedValue(std::make_shared<KRRenderValue>());
+        return kNullValue;
+    }
+
+    static std::shared_ptr<KRRenderValue> SharedBoolValue(bool value) {
+        static const std::shared_ptr<KRRenderValue> kTrueValue = MakeSharedValue(std::make_shared<KRRenderValue>(true));
+        static const std::shared_ptr<KRRenderValue> kFalseValue =
+            MakeSharedValue(std::make_shared<KRRenderValue>(false));
+        return value ? kTrueValue : kFalseValue;
+    }
+
+    static std::shared_ptr<KRRenderValue> SharedIntValue(int32_t value) {
+        static const std::vector<std::shared_ptr<KRRenderValue>> kIntValues = [] {
+            std::vector<std::shared_ptr<KRRenderValue>> values;
+            values.reserve(kSharedIntMax - kSharedIntMin + 1);
+            for (int32_t i = kSharedIntMin; i <= kSharedIntMax; i++) {
+                values.push_back(MakeSharedValue(std::make_shared<KRRenderValue>(i)));
+            }
+            return values;
+        }();
+        return kIntValues[value - kSharedIntMin];
+    }
 
     const void ToJsonMapOrArray() const {
-        cJSON* cjson = toJson( shared_from_this());
-        char* p = cJSON_PrintUnformatted(cjson);
-        map_or_array_json_value_ = p;
+        auto &cache = GetCache();
+        cache.map_or_array_json_value.clear();
+        KRRenderValueJson::Write(*this, cache.map_or_array_json_value);
         c_value_.type = KRRenderCValue::Type::STRING;
-        c_value_.value.stringValue = const_cast<char *>(map_or_array_json_value_.c_str());
-        cJSON_free(p);
-        cJSON_Delete(cjson);
+        c_value_.value.stringValue = const_cast<char *>(cache.map_or_array_json_value.c_str());
     }
 
     const JSVM_Status ToJsonMapOrArray(JSVM_Env js_env, JSVM_Value *js_value) const {
-        cJSON* cjson = toJson( shared_from_this());
-        if(char* p = cJSON_PrintUnformatted(cjson)){
-            map_or_array_json_value_ = p;
-            cJSON_free(p);
-        }
-        cJSON_Delete(cjson);
-        return OH_JSVM_CreateStringUtf8(js_env, map_or_array_json_value_.c_str(), map_or_array_json_value_.length(),
-                                        js_value);
+        auto &cache = GetCache();
+        cache.map_or_array_json_value.clear();
+        KRRenderValueJson::Write(*this, cache.map_or_array_json_value);
+        return OH_JSVM_CreateStringUtf8(js_env, cache.map_or_array_json_value.c_str(),
+                                        cache.map_or_array_json_value.length(), js_value);
     }
 
     const napi_status ToJsonMapOrArray(const napi_env &env, napi_value *nvalue) const {
-        cJSON* cjson = toJson( shared_from_this());
-        if(char* p = cJSON_PrintUnformatted(cjson)){
-            map_or_array_json_value_ = p;
-            cJSON_free(p);
+        auto &cache = GetCache();
+        cache.map_or_array_json_value.clear();
+        KRRenderValueJson::Write(*this, cache.map_or_array_json_value);
+        return napi_create_string_utf8(env, cache.map_or_array_json_value.c_str(),
+                                       cache.map_or_array_json_value.length(), nvalue);
+    }
+
+    /**
+     * 整段拷贝外部二进制数据，替代逐字节 push_back
+     */
+    static ByteArray CopyBytes(const void *data, size_t size) {
+        auto bytes = std::make_shared<std::vector<uint8_t>>(size);
+        if (size > 0 && data != nullptr) {
+            std::memcpy(bytes->data(), data, size);
         }
-        cJSON_Delete(cjson);
-        return napi_create_string_utf8(env, map_or_array_json_value_.c_str(), map_or_array_json_value_.length(),
-                                       nvalue);
+        return bytes;
+    }
+
+    /**
+     * ArkTS 侧的 ArrayBuffer 由 JS 引擎持有，这里整段 memcpy 一份
+     */
+    static napi_status CreateArrayBuffer(const napi_env &env, const ByteArray &data, napi_value *result) {
+        void *buffer = nullptr;
+        auto status = napi_create_arraybuffer(env, data->size(), &buffer, result);
+        if (status == napi_ok && !data->empty()) {
+            std::memcpy(buffer, data->data(), data->size());
+        }
+        return status;
     }
 
     const bool HadByteArrayElement(const Array &array) const {
@@ -697,66 +776,6 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
         }
         return false;
     }
-    static cJSON *toJson(const std::shared_ptr<const KRRenderValue> &value) {
-        if (value->isMap()) {
-            cJSON* obj = cJSON_CreateObject();
-            const auto &map = value->toMap();
-            for (const auto &entry : map) {
-                cJSON* child = toJson(entry.second);
-                cJSON_AddItemToObject(obj, entry.first.c_str(), child);
-            }
-            return obj;
-        } else if (value->isArray()) {
-            cJSON* arr = cJSON_CreateArray();
-            const auto &array = value->toArray();
-            for (const auto &element : array) {
-                cJSON* child = toJson( element);
-                cJSON_AddItemToArray(arr, child);
-            }
-            return arr;
-        } else if (value->isBool()) {
-            return cJSON_CreateBool(value->toBool());
-        } else if (value->isInt()) {
-            return cJSON_CreateNumber(static_cast<double>(value->toInt()));
-        } else if (value->isLong()) {
-            return cJSON_CreateNumber(static_cast<double>(value->toInt()));
-        } else if (value->isFloat()) {
-            return cJSON_CreateNumber(static_cast<double>(value->toInt()));
-        } else if (value->isDouble()) {
-            return cJSON_CreateNumber(value->toDouble());
-        } else if (value->isString()) {
-            return cJSON_CreateString(value->toString().c_str());
-        } else {
-            return cJSON_CreateNull();
-        }
-    }
-
-    static std::shared_ptr<KRRenderValue> fromJsonValue(const cJSON *cjson) {
-        if(cjson == nullptr){
-            return std::make_shared<KRRenderValue>();;
-        }
-        if (cJSON_IsBool(cjson)) {
-            return std::make_shared<KRRenderValue>(cJSON_IsTrue(cjson));
-        } else if (cJSON_IsNumber(cjson)) {
-            return std::make_shared<KRRenderValue>(cJSON_GetNumberValue(cjson));
-        } else if (cJSON_IsString(cjson)) {
-            return std::make_shared<KRRenderValue>(cJSON_GetStringValue(cjson));
-        } else if (cJSON_IsObject(cjson)) {
-            Map map_obj;
-            for (cJSON *item = cjson->child; item != NULL; item = item->next) {
-                map_obj[item->string] = fromJsonValue(item);
-            }
-            return std::make_shared<KRRenderValue>(map_obj);
-        } else if (cJSON_IsArray(cjson)) {
-            Array vec_obj;
-            for(int i = 0; i < cJSON_GetArraySize(cjson); ++i){
-                vec_obj.push_back(fromJsonValue(cJSON_GetArrayItem(cjson, i)));
-            }
-            return std::make_shared<KRRenderValue>(vec_obj);
-        } else {
-            return std::make_shared<KRRenderValue>();  // Null JSValue
-        }
-    }
 };
 
 #endif  // CORE_RENDER_OHOS_KRRENDERVALUE_H
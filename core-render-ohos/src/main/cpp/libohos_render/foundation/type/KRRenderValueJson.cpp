@@ -0,0 +1,421 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 THL A29 Limited, a Tencent company. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/foundation/type/KRRenderValueJson.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include "libohos_render/foundation/type/KRRenderValue.h"
+
+namespace {
+
+constexpr int kMaxNestingDepth = 512;
+
+class JsonReader {
+ public:
+    JsonReader(const char *json, size_t length) : cur_(json), end_(json + length) {}
+
+    std::shared_ptr<KRRenderValue> ReadDocument() {
+        SkipWhitespace();
+        return ReadValue(0);  // 与 cJSON_Parse 一致，忽略根节点之后的内容
+    }
+
+ private:
+    const char *cur_;
+    const char *end_;
+
+    void SkipWhitespace() {
+        while (cur_ < end_ && (*cur_ == ' ' || *cur_ == '\n' || *cur_ == '\r' || *cur_ == '\t')) {
+            ++cur_;
+        }
+    }
+
+    bool Consume(char c) {
+        if (cur_ < end_ && *cur_ == c) {
+            ++cur_;
+            return true;
+        }
+        return false;
+    }
+
+    bool ConsumeLiteral(const char *literal, size_t length) {
+        if (static_cast<size_t>(end_ - cur_) < length || std::char_traits<char>::compare(cur_, literal, length) != 0) {
+            return false;
+        }
+        cur_ += length;
+        return true;
+    }
+
+    std::shared_ptr<KRRenderValue> ReadValue(int depth) {
+        if (cur_ >= end_) {
+            return nullptr;
+        }
+        switch (*cur_) {
+            case '{':
+                return depth < kMaxNestingDepth ? ReadObject(depth + 1) : nullptr;
+            case '[':
+                return depth < kMaxNestingDepth ? ReadArray(depth + 1) : nullptr;
+            case '"': {
+                std::string str;
+                if (!ReadString(str)) {
+                    return nullptr;
+                }
+                return KRRenderValue::Create(std::move(str));
+            }
+            case 't':
+                return ConsumeLiteral("true", 4) ? KRRenderValue::Create(true) : nullptr;
+            case 'f':
+                return ConsumeLiteral("false", 5) ? KRRenderValue::Create(false) : nullptr;
+            case 'n':
+                return ConsumeLiteral("null", 4) ? KRRenderValue::Create() : nullptr;
+            default:
+                return ReadNumber();
+        }
+    }
+
+    std::shared_ptr<KRRenderValue> ReadObject(int depth) {
+        ++cur_;  // '{'
+        KRRenderValue::Map map;
+        SkipWhitespace();
+        if (Consume('}')) {
+            return KRRenderValue::Create(std::move(map));
+        }
+        while (true) {
+            SkipWhitespace();
+            std::string key;
+            if (cur_ >= end_ || *cur_ != '"' || !ReadString(key)) {
+                return nullptr;
+            }
+            SkipWhitespace();
+            if (!Consume(':')) {
+                return nullptr;
+            }
+            SkipWhitespace();
+            auto value = ReadValue(depth);
+            if (value == nullptr) {
+                return nullptr;
+            }
+            map[std::move(key)] = std::move(value);
+            SkipWhitespace();
+            if (Consume(',')) {
+                continue;
+            }
+            if (Consume('}')) {
+                return KRRenderValue::Create(std::move(map));
+            }
+            return nullptr;
+        }
+    }
+
+    std::shared_ptr<KRRenderValue> ReadArray(int depth) {
+        ++cur_;  // '['
+        KRRenderValue::Array array;
+        SkipWhitespace();
+        if (Consume(']')) {
+            return KRRenderValue::Create(std::move(array));
+        }
+        while (true) {
+            SkipWhitespace();
+            auto value = ReadValue(depth);
+            if (value == nullptr) {
+                return nullptr;
+            }
+            array.push_back(std::move(value));
+            SkipWhitespace();
+            if (Consume(',')) {
+                continue;
+            }
+            if (Consume(']')) {
+                return KRRenderValue::Create(std::move(array));
+            }
+            return nullptr;
+        }
+    }
+
+    std::shared_ptr<KRRenderValue> ReadNumber() {
+        const char *start = cur_;
+        if (cur_ < end_ && (*cur_ == '-' || *cur_ == '+')) {
+            ++cur_;
+        }
+        bool has_digit = false;
+        while (cur_ < end_) {
+            char c = *cur_;
+            if ((c >= '0' && c <= '9')) {
+                has_digit = true;
+            } else if (c != '.' && c != 'e' && c != 'E' && c != '-' && c != '+') {
+                break;
+            }
+            ++cur_;
+        }
+        if (!has_digit) {
+            return nullptr;
+        }
+        // 数字片段很短，拷贝到栈上保证 strtod 不越过片段末尾
+        char buffer[64];
+        size_t length = cur_ - start;
+        if (length >= sizeof(buffer)) {
+            return nullptr;
+        }
+        std::char_traits<char>::copy(buffer, start, length);
+        buffer[length] = '\0';
+        char *parse_end = nullptr;
+        double number = std::strtod(buffer, &parse_end);
+        if (parse_end != buffer + length) {
+            return nullptr;
+        }
+        return KRRenderValue::Create(number);  // 与 cJSON 行为一致，数字统一为 double
+    }
+
+    static void AppendUtf8(uint32_t code_point, std::string &out) {
+        if (code_point < 0x80) {
+            out.push_back(static_cast<char>(code_point));
+        } else if (code_point < 0x800) {
+            out.push_back(static_cast<char>(0xC0 | (code_point >> 6)));
+            out.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+        } else if (code_point < 0x10000) {
+            out.push_back(static_cast<char>(0xE0 | (code_point >> 12)));
+            out.push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+        } else {
+            out.push_back(static_cast<char>(0xF0 | (code_point >> 18)));
+            out.push_back(static_cast<char>(0x80 | ((code_point >> 12) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+        }
+    }
+
+    bool ReadHex4(uint32_t &value) {
+        if (end_ - cur_ < 4) {
+            return false;
+        }
+        value = 0;
+        for (int i = 0; i < 4; i++) {
+            char c = *cur_++;
+            value <<= 4;
+            if (c >= '0' && c <= '9') {
+                value |= c - '0';
+            } else if (c >= 'a' && c <= 'f') {
+                value |= c - 'a' + 10;
+            } else if (c >= 'A' && c <= 'F') {
+                value |= c - 'A' + 10;
+            } else {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool ReadString(std::string &out) {
+        ++cur_;  // '"'
+        const char *run_start = cur_;
+        while (cur_ < end_) {
+            char c = *cur_;
+            if (c == '"') {
+                out.append(run_start, cur_ - run_start);
+                ++cur_;
+                return true;
+            }
+            if (c != '\\') {
+                ++cur_;
+                continue;
+            }
+            // 无转义的片段整段追加，只在遇到转义字符时逐个处理
+            out.append(run_start, cur_ - run_start);
+            ++cur_;
+            if (cur_ >= end_) {
+                return false;
+            }
+            char escaped = *cur_++;
+            switch (escaped) {
+                case '"':
+                case '\\':
+                case '/':
+                    out.push_back(escaped);
+                    break;
+                case 'b':
+                    out.push_back('\b');
+                    break;
+                case 'f':
+                    out.push_back('\f');
+                    break;
+                case 'n':
+                    out.push_back('\n');
+                    break;
+                case 'r':
+                    out.push_back('\r');
+                    break;
+                case 't':
+                    out.push_back('\t');
+                    break;
+                case 'u': {
+                    uint32_t code_point = 0;
+                    if (!ReadHex4(code_point)) {
+                        return false;
+                    }
+                    if (code_point >= 0xD800 && code_point <= 0xDBFF) {  // 代理对
+                        uint32_t low = 0;
+                        if (end_ - cur_ < 2 || cur_[0] != '\\' || cur_[1] != 'u') {
+                            return false;
+                        }
+                        cur_ += 2;
+                        if (!ReadHex4(low) || low < 0xDC00 || low > 0xDFFF) {
+                            return false;
+                        }
+                        code_point = 0x10000 + ((code_point - 0xD800) << 10) + (low - 0xDC00);
+                    }
+                    AppendUtf8(code_point, out);
+                    break;
+                }
+                default:
+                    return false;
+            }
+            run_start = cur_;
+        }
+        return false;
+    }
+};
+
+void WriteString(const std::string &str, std::string &out) {
+    static const char kHex[] = "0123456789abcdef";
+    out.push_back('"');
+    const char *run_start = str.data();
+    const char *end = str.data() + str.size();
+    for (const char *p = run_start; p < end; ++p) {
+        unsigned char c = static_cast<unsigned char>(*p);
+        if (c >= 0x20 && c != '"' && c != '\\') {
+            continue;
+        }
+        out.append(run_start, p - run_start);
+        switch (c) {
+            case '"':
+                out.append("\\\"");
+                break;
+            case '\\':
+                out.append("\\\\");
+                break;
+            case '\b':
+                out.append("\\b");
+                break;
+            case '\f':
+                out.append("\\f");
+                break;
+            case '\n':
+                out.append("\\n");
+                break;
+            case '\r':
+                out.append("\\r");
+                break;
+            case '\t':
+                out.append("\\t");
+                break;
+            default:
+                out.append("\\u00");
+                out.push_back(kHex[c >> 4]);
+                out.push_back(kHex[c & 0xF]);
+                break;
+        }
+        run_start = p + 1;
+    }
+    out.append(run_start, end - run_start);
+    out.push_back('"');
+}
+
+void WriteDouble(double number, std::string &out) {
+    if (std::isnan(number) || std::isinf(number)) {
+        out.append("null");
+        return;
+    }
+    char buffer[32];
+    // 与 cJSON 一致：先尝试 15 位有效数字，无法精确还原时再使用 17 位
+    int length = std::snprintf(buffer, sizeof(buffer), "%1.15g", number);
+    if (std::strtod(buffer, nullptr) != number) {
+        length = std::snprintf(buffer, sizeof(buffer), "%1.17g", number);
+    }
+    out.append(buffer, length);
+}
+
+void WriteFloat(float number, std::string &out) {
+    if (std::isnan(number) || std::isinf(number)) {
+        out.append("null");
+        return;
+    }
+    char buffer[32];
+    // float 只需 9 位有效数字即可精确还原，优先输出更短的 7 位形式
+    int length = std::snprintf(buffer, sizeof(buffer), "%1.7g", number);
+    if (std::strtof(buffer, nullptr) != number) {
+        length = std::snprintf(buffer, sizeof(buffer), "%1.9g", number);
+    }
+    out.append(buffer, length);
+}
+
+}  // namespace
+
+std::shared_ptr<KRRenderValue> KRRenderValueJson::Parse(const char *json, size_t length) {
+    if (json == nullptr || length == 0) {
+        return nullptr;
+    }
+    return JsonReader(json, length).ReadDocument();
+}
+
+void KRRenderValueJson::Write(const KRRenderValue &value, std::string &out) {
+    if (value.isMap()) {
+        out.push_back('{');
+        bool first = true;
+        for (const auto &entry : value.toMap()) {
+            if (!first) {
+                out.push_back(',');
+            }
+            first = false;
+            WriteString(entry.first, out);
+            out.push_back(':');
+            if (entry.second) {
+                Write(*entry.second, out);
+            } else {
+                out.append("null");
+            }
+        }
+        out.push_back('}');
+    } else if (value.isArray()) {
+        out.push_back('[');
+        bool first = true;
+        for (const auto &element : value.toArray()) {
+            if (!first) {
+                out.push_back(',');
+            }
+            first = false;
+            if (element) {
+                Write(*element, out);
+            } else {
+                out.append("null");
+            }
+        }
+        out.push_back(']');
+    } else if (value.isBool()) {
+        out.append(value.toBool() ? "true" : "false");
+    } else if (value.isInt()) {
+        out.append(std::to_string(value.toInt()));
+    } else if (value.isLong()) {
+        out.append(std::to_string(value.toLong()));
+    } else if (value.isFloat()) {
+        WriteFloat(value.toFloat(), out);
+    } else if (value.isDouble()) {
+        WriteDouble(value.toDouble(), out);
+    } else if (value.isString()) {
+        WriteString(value.toString(), out);
+    } else {
+        out.append("null");
+    }
+}
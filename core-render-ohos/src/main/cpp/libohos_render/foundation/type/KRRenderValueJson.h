@@ -0,0 +1,44 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 THL A29 Limited, a Tencent company. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRRENDERVALUEJSON_H
+#define CORE_RENDER_OHOS_KRRENDERVALUEJSON_H
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+class KRRenderValue;
+
+/**
+ * KRRenderValue 与 JSON 字符串之间的转换
+ * 解析时单遍扫描源字符串直接生成 KRRenderValue，不再经过 cJSON 节点树中转；
+ * 序列化时单遍输出紧凑格式，long/float 按原始精度输出
+ */
+class KRRenderValueJson {
+ public:
+    /**
+     * 解析 JSON 字符串
+     * @return 解析结果，格式错误时返回 nullptr
+     */
+    static std::shared_ptr<KRRenderValue> Parse(const char *json, size_t length);
+
+    /**
+     * 将 value 序列化为紧凑格式的 JSON，追加到 out 末尾
+     */
+    static void Write(const KRRenderValue &value, std::string &out);
+};
+
+#endif  // CORE_RENDER_OHOS_KRRENDERVALUEJSON_H
@@ -0,0 +1,227 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 THL A29 Limited, a Tencent company. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRRENDERVALUEPOOL_H
+#define CORE_RENDER_OHOS_KRRENDERVALUEPOOL_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+
+/**
+ * 定长内存块池（每个线程一份空闲链表）
+ * 用于KRRenderValue这类高频创建、销毁的小对象，减少malloc/free次数
+ * 每个内存块头部记录分配线程的堆：本线程释放直接进入本地空闲链表；其他线程释放时无锁压入分配线程的
+ * 远程释放栈，由分配线程在本地链表耗尽时整体取回，保证 context 线程分配、主线程释放的内存块能回到 context 线程复用
+ */
+template <size_t kBlockSize>
+class KRFixedBlockPool {
+ public:
+    static void *Allocate() {
+        auto &local = GetLocal();
+        auto heap = local.heap;
+        if (heap == nullptr && !local.disabled) {
+            heap = CreateLocalHeap();
+        }
+        if (heap != nullptr) {
+            if (heap->head == nullptr) {
+                CollectRemoteFrees(heap);
+            }
+            if (heap->head != nullptr) {
+                auto node = heap->head;
+                heap->head = node->next;
+                --heap->count;
+                return node;
+            }
+            heap->refs.fetch_add(1, std::memory_order_relaxed);
+        }
+        auto raw = static_cast<char *>(::operator new(kHeaderSize + kBlockSize));
+        *reinterpret_cast<Heap **>(raw) = heap;
+        return raw + kHeaderSize;
+    }
+
+    static void Deallocate(void *block) {
+        auto heap = OwnerOf(block);
+        if (heap == nullptr) {
+            ::operator delete(RawOf(block));
+            return;
+        }
+        auto node = static_cast<Node *>(block);
+        if (heap != GetLocal().heap) {
+            PushRemote(heap, node);
+            return;
+        }
+        if (heap->count >= kMaxFreeBlocks) {
+            FreeNode(heap, node);
+            return;
+        }
+        node->next = heap->head;
+        heap->head = node;
+        ++heap->count;
+    }
+
+ private:
+    static constexpr uint32_t kMaxFreeBlocks = 1024;
+    // 块头部存放所属堆指针，按默认对齐补齐，保证返回的内存满足 operator new 的对齐要求
+    static constexpr size_t kHeaderSize = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+    struct Node {
+        Node *next;
+    };
+    static_assert(kBlockSize >= sizeof(Node), "block too small");
+
+    struct Heap;
+    static_assert(kHeaderSize >= sizeof(Heap *), "header too small");
+
+    struct Heap {
+        Node *head = nullptr;  // 本地空闲链表，仅所属线程访问
+        uint32_t count = 0;
+        std::atomic<Node *> remote_head{nullptr};  // 其他线程释放的块，线程退出后置为 ClosedMark()
+        std::atomic<size_t> refs{1};               // 所属线程 + 尚未归还系统的块数，归零时删除
+    };
+
+    // 保持平凡析构，保证线程退出过程中（Drainer析构之后）仍可安全访问
+    struct Local {
+        Heap *heap;
+        bool disabled;
+    };
+
+    struct Drainer {
+        ~Drainer() {
+            auto &local = GetLocal();
+            auto heap = local.heap;
+            local.heap = nullptr;
+            local.disabled = true;
+            if (heap == nullptr) {
+                return;
+            }
+            FreeList(heap, heap->head);
+            heap->head = nullptr;
+            heap->count = 0;
+            // 关闭远程释放栈，之后其他线程释放的块直接归还系统
+            FreeList(heap, heap->remote_head.exchange(ClosedMark(), std::memory_order_acquire));
+            Release(heap);
+        }
+    };
+
+    static Local &GetLocal() {
+        static thread_local Local local = {nullptr, false};
+        return local;
+    }
+
+    static Heap *CreateLocalHeap() {
+        static thread_local Drainer drainer;  // 线程退出时释放空闲链表
+        (void)drainer;
+        auto &local = GetLocal();
+        local.heap = new Heap();
+        return local.heap;
+    }
+
+    static Node *ClosedMark() {
+        return reinterpret_cast<Node *>(uintptr_t(1));
+    }
+
+    static char *RawOf(void *block) {
+        return static_cast<char *>(block) - kHeaderSize;
+    }
+
+    static Heap *OwnerOf(void *block) {
+        return *reinterpret_cast<Heap **>(RawOf(block));
+    }
+
+    static void CollectRemoteFrees(Heap *heap) {
+        if (heap->remote_head.load(std::memory_order_relaxed) == nullptr) {
+            return;
+        }
+        auto node = heap->remote_head.exchange(nullptr, std::memory_order_acquire);
+        heap->head = node;
+        for (; node != nullptr; node = node->next) {
+            ++heap->count;
+        }
+    }
+
+    static void PushRemote(Heap *heap, Node *node) {
+        auto head = heap->remote_head.load(std::memory_order_relaxed);
+        do {
+            if (head == ClosedMark()) {
+                FreeNode(heap, node);
+                return;
+            }
+            node->next = head;
+        } while (!heap->remote_head.compare_exchange_weak(head, node, std::memory_order_release,
+                                                          std::memory_order_relaxed));
+    }
+
+    static void FreeList(Heap *heap, Node *node) {
+        while (node != nullptr) {
+            auto next = node->next;
+            FreeNode(heap, node);
+            node = next;
+        }
+    }
+
+    static void FreeNode(Heap *heap, Node *node) {
+        ::operator delete(RawOf(node));
+        Release(heap);
+    }
+
+    static void Release(Heap *heap) {
+        if (heap->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            delete heap;
+        }
+    }
+};
+
+/**
+ * 配合std::allocate_shared使用的分配器，单个对象（含shared_ptr控制块）从KRFixedBlockPool分配
+ */
+template <typename T>
+class KRRenderValuePoolAllocator {
+ public:
+    using value_type = T;
+
+    KRRenderValuePoolAllocator() noexcept = default;
+    template <typename U>
+    KRRenderValuePoolAllocator(const KRRenderValuePoolAllocator<U> &) noexcept {}
+
+    T *allocate(size_t n) {
+        static_assert(alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__, "over-aligned type");
+        if (n == 1) {
+            return static_cast<T *>(KRFixedBlockPool<sizeof(T)>::Allocate());
+        }
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T *p, size_t n) noexcept {
+        if (n == 1) {
+            KRFixedBlockPool<sizeof(T)>::Deallocate(p);
+            return;
+        }
+        std::allocator<T>().deallocate(p, n);
+    }
+
+    template <typename U>
+    bool operator==(const KRRenderValuePoolAllocator<U> &) const noexcept {
+        return true;
+    }
+    template <typename U>
+    bool operator!=(const KRRenderValuePoolAllocator<U> &) const noexcept {
+        return false;
+    }
+};
+
+#endif  // CORE_RENDER_OHOS_KRRENDERVALUEPOOL_H
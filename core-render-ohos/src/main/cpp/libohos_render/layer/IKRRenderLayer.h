@@ -26,6 +26,7 @@
 #include "libohos_render/export/IKRRenderShadowExport.h"
 #include "libohos_render/export/IKRRenderViewExport.h"
 #include "libohos_render/foundation/KRCommon.h"
+#include "libohos_render/foundation/KRRect.h"
 #include "libohos_render/view/IKRRenderView.h"
 
 class IKRRenderLayer {
@@ -65,6 +66,13 @@ class IKRRenderLayer {
      */
     virtual void SetProp(int tag, const std::string &prop_key, const KRAnyValue &prop_value) = 0;
 
+    /**
+     * 设置渲染视图frame（不经过属性字符串分发）
+     * @param tag 视图 ID
+     * @param frame 视图frame
+     */
+    virtual void SetFrame(int tag, const KRRect &frame) = 0;
+
     /**
      * 设置渲染视图事件
      * @param tag 视图 ID
@@ -36,8 +36,7 @@ void KRRenderLayerHandler::CreateRenderView(int tag, const std::string &view_nam
         // noop if the root view has been destroyed
         return;
     }
-    auto it = view_registry_.find(tag);
-    if (it == view_registry_.end()) {
+    if (view_registry_.Find(tag) == nullptr) {
         auto view = PopViewFromReuseQueue(view_name);
         if (view == nullptr) {
             view = IKRRenderViewExport::CreateView(view_name);
@@ -49,7 +48,7 @@ void KRRenderLayerHandler::CreateRenderView(int tag, const std::string &view_nam
             view->SetViewTag(tag);
         }
         if (view != nullptr) {
-            view_registry_[tag] = view;
+            view_registry_.Insert(tag, std::move(view));
         }
     }
 }
@@ -59,17 +58,12 @@ void KRRenderLayerHandler::CreateRenderView(int tag, const std::string &view_nam
  * @param tag 视图 ID
  */
 void KRRenderLayerHandler::RemoveRenderView(int tag) {
-    auto it = view_registry_.find(tag);
-    if (it == view_registry_.end()) {
-        return;
-    }
-    auto view = it->second;
+    auto view = view_registry_.Remove(tag);
     if (!view) {
         return;
     }
 
     view->ToRemoveFromSuperView();
-    view_registry_.erase(it);
     if (view->CanReuse()) {
         PushViewToReuseQueue(view);  // 放入复用队列
     } else {
@@ -89,16 +83,17 @@ void KRRenderLayerHandler::RemoveRenderView(int tag) {
  */
 void KRRenderLayerHandler::InsertSubRenderView(int parent_tag, int child_tag, int index) {
     auto isRootViewTag = parent_tag == -1;
-    auto &child_view = view_registry_[child_tag];
+    // 持有拷贝，插入过程中回调移除该 tag 时不会释放 child_view
+    auto child_view = view_registry_.Get(child_tag);
+    if (child_view == nullptr) {
+        return;
+    }
     if (isRootViewTag) {
         if (auto lock = root_view_.lock()) {
             lock->AddContentView(child_view, index);
         }
-    } else {
-        auto &parent_view = view_registry_[parent_tag];
-        if (parent_view != nullptr && child_view != nullptr) {
-            parent_view->ToInsertSubRenderView(child_view, index);
-        }
+    } else if (auto parent_view = view_registry_.Find(parent_tag)) {
+        parent_view->ToInsertSubRenderView(child_view, index);
     }
 }
 
@@ -109,12 +104,22 @@ void KRRenderLayerHandler::InsertSubRenderView(int parent_tag, int child_tag, in
  * @param propValue 属性值
  */
 void KRRenderLayerHandler::SetProp(int tag, const std::string &prop_key, const KRAnyValue &prop_value) {
-    auto &view = view_registry_[tag];
-    if (view != nullptr) {
+    if (auto view = view_registry_.Find(tag)) {
         view->ToSetProp(prop_key, prop_value, nullptr);
     }
 }
 
+/**
+ * 设置渲染视图frame
+ * @param tag 视图 ID
+ * @param frame 视图frame
+ */
+void KRRenderLayerHandler::SetFrame(int tag, const KRRect &frame) {
+    if (auto view = view_registry_.Find(tag)) {
+        view->ToSetFrame(frame);
+    }
+}
+
 /**
  * 设置渲染视图事件
  * @param tag 视图 ID
@@ -122,8 +127,7 @@ void KRRenderLayerHandler::SetProp(int tag, const std::string &prop_key, const K
  * @param propValue 事件
  */
 void KRRenderLayerHandler::SetEvent(int tag, const std::string &prop_key, const KRRenderCallback &callback) {
-    auto &view = view_registry_[tag];
-    if (view != nullptr) {
+    if (auto view = view_registry_.Find(tag)) {
         view->ToSetProp(prop_key, nullptr, callback);
     }
 }
@@ -134,8 +138,7 @@ void KRRenderLayerHandler::SetEvent(int tag, const std::string &prop_key, const
  * @param shadow 视图对应的 shadow 对象
  */
 void KRRenderLayerHandler::SetShadow(int tag, const std::shared_ptr<IKRRenderShadowExport> &shadow) {
-    auto &view = view_registry_[tag];
-    if (view != nullptr) {
+    if (auto view = view_registry_.Find(tag)) {
         view->SetShadow(shadow);
     }
 }
@@ -148,8 +151,7 @@ void KRRenderLayerHandler::SetShadow(int tag, const std::shared_ptr<IKRRenderSha
  * @return 计算得到的尺寸，"${width}|${height}" 格式封装返回
  */
 std::string KRRenderLayerHandler::CalculateRenderViewSize(int tag, double constraint_width, double constraint_height) {
-    auto &shadow = shadow_registry_[tag];
-    if (shadow != nullptr) {
+    if (auto shadow = shadow_registry_.Find(tag)) {
         auto size = shadow->CalculateRenderViewSize(constraint_width, constraint_height);
         return kuikly::util::ConvertSizeToString(size);
     }
@@ -165,8 +167,7 @@ std::string KRRenderLayerHandler::CalculateRenderViewSize(int tag, double constr
  */
 void KRRenderLayerHandler::CallViewMethod(int tag, const std::string &method, const KRAnyValue &params,
                                           const KRRenderCallback &callback) {
-    auto &view = view_registry_[tag];
-    if (view != nullptr) {
+    if (auto view = view_registry_.Find(tag)) {
         view->CallMethod(method, params, callback);
     }
 }
@@ -203,12 +204,11 @@ KRAnyValue KRRenderLayerHandler::CallTDFModuleMethod(const std::string &module_n
  * @param viewName 视图名字
  */
 void KRRenderLayerHandler::CreateShadow(int tag, const std::string &view_name) {
-    auto it = shadow_registry_.find(tag);
-    if (it == shadow_registry_.end()) {
+    if (shadow_registry_.Find(tag) == nullptr) {
         auto shadow = IKRRenderShadowExport::CreateShadow(view_name);
         if (shadow != nullptr) {
             shadow->SetRootView(root_view_);
-            shadow_registry_[tag] = shadow;
+            shadow_registry_.Insert(tag, std::move(shadow));
         }
     }
 }
@@ -218,7 +218,7 @@ void KRRenderLayerHandler::CreateShadow(int tag, const std::string &view_name) {
  * @param tag 视图 ID
  */
 void KRRenderLayerHandler::RemoveShadow(int tag) {
-    shadow_registry_.erase(tag);
+    shadow_registry_.Remove(tag);
 }
 
 /**
@@ -228,12 +228,8 @@ void KRRenderLayerHandler::RemoveShadow(int tag) {
  * @param propValue 属性值
  */
 void KRRenderLayerHandler::SetShadowProp(int tag, const std::string &prop_key, const KRAnyValue &prop_value) {
-    auto it = shadow_registry_.find(tag);
-    if (it != shadow_registry_.end()) {
-        auto shadow = it->second;
-        if (shadow != nullptr) {
-            shadow->SetProp(prop_key, prop_value);
-        }
+    if (auto shadow = shadow_registry_.Find(tag)) {
+        shadow->SetProp(prop_key, prop_value);
     }
 }
 
@@ -243,7 +239,7 @@ void KRRenderLayerHandler::SetShadowProp(int tag, const std::string &prop_key, c
  * @return 对应 ID 的 shadow 对象，如果不存在则返回 null
  */
 std::shared_ptr<IKRRenderShadowExport> KRRenderLayerHandler::Shadow(int tag) {
-    return shadow_registry_[tag];
+    return shadow_registry_.Get(tag);
 }
 
 /**
@@ -254,8 +250,7 @@ std::shared_ptr<IKRRenderShadowExport> KRRenderLayerHandler::Shadow(int tag) {
  * @return 方法调用的返回值，如果方法不存在则返回 null
  */
 KRAnyValue KRRenderLayerHandler::CallShadowMethod(int tag, const std::string &method_name, const std::string &params) {
-    auto shadow = Shadow(tag);
-    if (shadow != nullptr) {
+    if (auto shadow = shadow_registry_.Find(tag)) {
         return shadow->Call(method_name, params);
     }
     return std::make_shared<KRRenderValue>(nullptr);
@@ -280,7 +275,7 @@ std::shared_ptr<IKRRenderModuleExport> KRRenderLayerHandler::GetModule(const std
  * @return 对应 ID 的渲染视图实例，如果不存在则返回 null
  */
 std::shared_ptr<IKRRenderViewExport> KRRenderLayerHandler::GetRenderView(int tag) {
-    return view_registry_[tag];
+    return view_registry_.Get(tag);
 }
 
 /**
@@ -293,15 +288,10 @@ void KRRenderLayerHandler::WillDestroy() {}
  */
 void KRRenderLayerHandler::OnDestroy() {
     destroying_ = true;
-    for (const auto &entry : view_registry_) {
-        const std::shared_ptr<IKRRenderViewExport> &value = entry.second;
-        if (value) {
-            value->ToDestroy();
-        }
-    }
+    view_registry_.ForEach([](const std::shared_ptr<IKRRenderViewExport> &view) { view->ToDestroy(); });
     // views should be clear, otherwise pending async ops like RemoveRenderView or InsertSubRenderView
     // would still be able to find them and could cause unexpected behaviors
-    view_registry_.clear();
+    view_registry_.Clear();
 
     {  // auto lock sub-scope to destroy modules
         std::unique_lock lock(module_rw_mutex_);
@@ -19,6 +19,7 @@
 #include <shared_mutex>
 #include "libohos_render/context/KRRenderContextParams.h"
 #include "libohos_render/layer/IKRRenderLayer.h"
+#include "libohos_render/layer/KRTagRegistry.h"
 
 class KRRenderLayerHandler : public IKRRenderLayer {
  public:
@@ -58,6 +59,13 @@ class KRRenderLayerHandler : public IKRRenderLayer {
      */
     void SetProp(int tag, const std::string &prop_key, const KRAnyValue &prop_value) override;
 
+    /**
+     * 设置渲染视图frame
+     * @param tag 视图 ID
+     * @param frame 视图frame
+     */
+    void SetFrame(int tag, const KRRect &frame) override;
+
     /**
      * 设置渲染视图事件
      * @param tag 视图 ID
@@ -185,9 +193,9 @@ class KRRenderLayerHandler : public IKRRenderLayer {
     std::shared_ptr<KRRenderContextParams> context_;
     std::weak_ptr<IKRRenderView> root_view_;
     std::unordered_map<std::string, std::vector<std::shared_ptr<IKRRenderViewExport>>> view_reuse_queue_;
-    std::unordered_map<int, std::shared_ptr<IKRRenderViewExport>> view_registry_;
+    KRTagRegistry<IKRRenderViewExport> view_registry_;
     std::unordered_map<std::string, std::shared_ptr<IKRRenderModuleExport>> module_registry_;
-    std::unordered_map<int, std::shared_ptr<IKRRenderShadowExport>> shadow_registry_;
+    KRTagRegistry<IKRRenderShadowExport> shadow_registry_;
     std::shared_mutex module_rw_mutex_;  // 用于module读写安全用的读写锁
     bool destroying_ = false;
 
@@ -0,0 +1,189 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 THL A29 Limited, a Tencent company. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRTAGREGISTRY_H
+#define CORE_RENDER_OHOS_KRTAGREGISTRY_H
+
+#include <array>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <unordered_map>
+
+/**
+ * 以 tag 为下标的分页稀疏数组，用于 view / shadow 注册表
+ * Kotlin 侧 tag 是单调递增的整数，按 256 个一页直接寻址，查找为 O(1) 且未命中时不会插入空元素；
+ * 页内元素全部移除后释放整页，首尾的空页一并移出页表，页表只覆盖当前存活 tag 所在的区间，不随 tag 增长而膨胀
+ */
+template <typename T> class KRTagRegistry {
+ public:
+    /**
+     * 查找 tag 对应的对象，未命中返回 nullptr；返回裸指针，不产生 shared_ptr 引用计数开销
+     */
+    T *Find(int tag) const {
+        auto slot = FindSlot(tag);
+        return slot != nullptr ? slot->value.get() : nullptr;
+    }
+
+    /**
+     * 需要持有所有权时使用，返回拷贝，调用期间即使 tag 被移除对象也不会析构；未命中返回 nullptr
+     */
+    std::shared_ptr<T> Get(int tag) const {
+        auto slot = FindSlot(tag);
+        return slot != nullptr ? slot->value : nullptr;
+    }
+
+    /**
+     * 注册对象，tag 已存在时不覆盖并返回 false
+     */
+    bool Insert(int tag, std::shared_ptr<T> value) {
+        if (value == nullptr) {
+            return false;
+        }
+        if (tag < 0) {
+            return negative_tags_.emplace(tag, Slot{std::move(value)}).second;
+        }
+        auto page_index = static_cast<size_t>(tag) / kPageSize;
+        if (pages_.empty()) {
+            base_page_ = page_index;
+        }
+        for (; page_index < base_page_; base_page_--) {
+            pages_.emplace_front();
+        }
+        auto offset = page_index - base_page_;
+        if (offset >= pages_.size()) {
+            pages_.resize(offset + 1);
+        }
+        auto &page = pages_[offset];
+        if (page == nullptr) {
+            page = std::make_unique<Page>();
+        }
+        auto &slot = page->slots[static_cast<size_t>(tag) % kPageSize];
+        if (slot.value != nullptr) {
+            return false;
+        }
+        slot.value = std::move(value);
+        page->live_count++;
+        size_++;
+        return true;
+    }
+
+    /**
+     * 移除并返回对象，未命中返回 nullptr
+     */
+    std::shared_ptr<T> Remove(int tag) {
+        if (tag < 0) {
+            auto it = negative_tags_.find(tag);
+            if (it == negative_tags_.end()) {
+                return nullptr;
+            }
+            auto value = std::move(it->second.value);
+            negative_tags_.erase(it);
+            return value;
+        }
+        auto page = PageAt(static_cast<size_t>(tag) / kPageSize);
+        if (page == nullptr) {
+            return nullptr;
+        }
+        auto &slot = page->slots[static_cast<size_t>(tag) % kPageSize];
+        if (slot.value == nullptr) {
+            return nullptr;
+        }
+        auto value = std::move(slot.value);
+        slot.value = nullptr;
+        size_--;
+        if (--page->live_count == 0) {
+            pages_[static_cast<size_t>(tag) / kPageSize - base_page_].reset();
+            TrimEmptyPages();
+        }
+        return value;
+    }
+
+    template <typename Func> void ForEach(Func &&func) const {
+        for (const auto &page : pages_) {
+            if (page == nullptr) {
+                continue;
+            }
+            for (const auto &slot : page->slots) {
+                if (slot.value != nullptr) {
+                    func(slot.value);
+                }
+            }
+        }
+        for (const auto &pair : negative_tags_) {
+            func(pair.second.value);
+        }
+    }
+
+    void Clear() {
+        pages_.clear();
+        base_page_ = 0;
+        negative_tags_.clear();
+        size_ = 0;
+    }
+
+    size_t Size() const {
+        return size_ + negative_tags_.size();
+    }
+
+ private:
+    static constexpr size_t kPageSize = 256;
+
+    struct Slot {
+        std::shared_ptr<T> value;
+    };
+
+    struct Page {
+        std::array<Slot, kPageSize> slots;
+        size_t live_count = 0;
+    };
+
+    const Slot *FindSlot(int tag) const {
+        if (tag < 0) {
+            auto it = negative_tags_.find(tag);
+            return it != negative_tags_.end() ? &it->second : nullptr;
+        }
+        auto page = PageAt(static_cast<size_t>(tag) / kPageSize);
+        if (page == nullptr) {
+            return nullptr;
+        }
+        const auto &slot = page->slots[static_cast<size_t>(tag) % kPageSize];
+        return slot.value != nullptr ? &slot : nullptr;
+    }
+
+    Page *PageAt(size_t page_index) const {
+        if (page_index < base_page_ || page_index - base_page_ >= pages_.size()) {
+            return nullptr;
+        }
+        return pages_[page_index - base_page_].get();
+    }
+
+    void TrimEmptyPages() {
+        while (!pages_.empty() && pages_.front() == nullptr) {
+            pages_.pop_front();
+            base_page_++;
+        }
+        while (!pages_.empty() && pages_.back() == nullptr) {
+            pages_.pop_back();
+        }
+    }
+
+    std::deque<std::unique_ptr<Page>> pages_;  // pages_[i] 对应第 base_page_ + i 页
+    size_t base_page_ = 0;
+    std::unordered_map<int, Slot> negative_tags_;  // 负数 tag 极少出现，单独存放
+    size_t size_ = 0;
+};
+
+#endif  // CORE_RENDER_OHOS_KRTAGREGISTRY_H
@@ -15,8 +15,11 @@
 
 #include "libohos_render/manager/KRRenderManager.h"
 
+#include "libohos_render/context/KRInstanceHandleTable.h"
 #include "libohos_render/context/KRRenderNativeContextHandlerManager.h"
 #include "libohos_render/expand/components/ComponentsRegisterEntry.h"
+#include "libohos_render/expand/components/apng/APNGCache.h"
+#include "libohos_render/expand/components/image/KRImageDecodeCache.h"
 #include "libohos_render/expand/events/KREventDispatchCenter.h"
 #include "libohos_render/expand/modules/ModulesRegisterEntry.h"
 #include "libohos_render/foundation/thread/KRMainThread.h"
@@ -91,12 +94,16 @@ std::shared_ptr<KRRenderView> KRRenderManager::GetRenderView(const std::string &
 }
 
 bool KRRenderManager::SetRenderView(std::string &instanceId, std::shared_ptr<KRRenderView> &renderView) {
-    KRScopedSpinLock lock(&render_view_map_lock_);
-    if (render_view_map_.find(instanceId) == render_view_map_.end()) {
+    {
+        KRScopedSpinLock lock(&render_view_map_lock_);
+        if (render_view_map_.find(instanceId) != render_view_map_.end()) {
+            return false;
+        }
         render_view_map_[instanceId] = renderView;
-        return true;
     }
-    return false;
+    // 句柄表内部会加 mutex，不能在自旋锁内调用
+    KRInstanceHandleTable::GetInstance().SetRenderViewAlive(instanceId, true);
+    return true;
 }
 
 void KRRenderManager::DestroyRenderView(std::string &instanceId) {
@@ -111,11 +118,13 @@ void KRRenderManager::DestroyRenderView(std::string &instanceId) {
 }
 
 void KRRenderManager::DestroyRenderViewCallBack(const std::string &instanceId) {
+    bool erased = false;
     {
         KRScopedSpinLock lock(&render_view_map_lock_);
-        if (render_view_map_.find(instanceId) != render_view_map_.end()) {
-            render_view_map_.erase(instanceId);
-        }
+        erased = render_view_map_.erase(instanceId) > 0;
+    }
+    if (erased) {
+        KRInstanceHandleTable::GetInstance().SetRenderViewAlive(instanceId, false);
     }
     {
         KRScopedSpinLock lock(&launch_init_time_map_lock_);
@@ -143,6 +152,29 @@ int64_t KRRenderManager::GetLaunchStartTime(std::string &instanceId) {
     return 0;
 }
 
+void KRRenderManager::OnMemoryLevel(int level) {
+    KR_LOG_INFO << "OnMemoryLevel, level:" << level << " apng cache bytes:" << APNGCache::GetInstance().TotalBytes()
+                << " image cache bytes:" << KRImageDecodeCache::GetInstance().TotalBytes();
+    APNGCache::GetInstance().OnMemoryLevel(level);
+    KRImageDecodeCache::GetInstance().OnMemoryLevel(level);
+    std::vector<std::shared_ptr<KRRenderView>> render_views;
+    {
+        KRScopedSpinLock lock(&render_view_map_lock_);
+        for (const auto &pair : render_view_map_) {
+            if (pair.second != nullptr) {
+                render_views.push_back(pair.second);
+            }
+        }
+    }
+    // 实例缓存被淘汰的 key 在读取时会请求 Kotlin 侧重发
+    auto module_name = std::string(kMemoryCacheModuleName);
+    for (const auto &render_view : render_views) {
+        if (auto module = std::dynamic_pointer_cast<KRMemoryCacheModule>(render_view->GetModule(module_name))) {
+            module->OnMemoryLevel(level);
+        }
+    }
+}
+
 void KRRenderManager::RegisterExcuteModeCreator(
     const std::shared_ptr<KRRenderExecuteModeWrapper> &execute_mode_wrapper) {
     if (execute_mode_wrapper) {
@@ -41,6 +41,7 @@ class KRRenderManager {
 
     void OnLaunchStart(std::string &instanceId);  //  ArkTS层页面启动事件
     int64_t GetLaunchStartTime(std::string &instanceId);
+    void OnMemoryLevel(int level);  //  ArkTS层内存压力事件，用于裁剪进程级缓存
     void RegisterExcuteModeCreator(const std::shared_ptr<KRRenderExecuteModeWrapper> &execute_mode_wrapper);
 
     void CreateRenderViewIfNeeded(napi_env env, napi_callback_info info);
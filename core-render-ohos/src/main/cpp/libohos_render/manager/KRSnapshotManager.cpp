@@ -19,18 +19,20 @@
 #include <arkui/native_interface.h>
 #include <arkui/native_node.h>
 #include <arkui/native_node_napi.h>
-#include <multimedia/image_framework/image_packer_mdk.h>
-#include <multimedia/image_framework/image_pixel_map_mdk.h>
-#include <unistd.h>
+#include <multimedia/image_framework/image/image_packer_native.h>
+#include <multimedia/image_framework/image/pixelmap_native.h>
+#include <algorithm>
+#include <fstream>
+#include <sstream>
 
 #include "libohos_render/expand/components/view/KRView.h"
 #include "libohos_render/foundation/KRCommon.h"
 #include "libohos_render/foundation/ark_ts.h"
+#include "libohos_render/foundation/thread/KRGCDQueue.h"
+#include "libohos_render/foundation/thread/KRMainThread.h"
 #include "libohos_render/scheduler/KRContextScheduler.h"
 #include "libohos_render/utils/KRBase64Util.h"
-
-constexpr static int TIME_TO_REMOVE_SNAPSHOT_DRAWABLE_MS = 100;  // remove the cached drawable after 6 frames
-constexpr static int MAX_DELAY_DURATION_MS = 1000;
+#include "libohos_render/utils/KRRenderLoger.h"
 
 static void DisposeItem(struct KRSnapshotItem *item) {
     if (item) {
@@ -91,79 +93,148 @@ void KRSnapshotManager::SetCachedSnapshotToNode(ArkUI_NodeHandle node, const std
     }
 }
 
-struct KRSnapshotManager::ResultData KRSnapshotManager::ProcessSnapshotResultWithDataType(
-    napi_env env, napi_value pixelMap, const std::string &path, const std::string &pathUri,
-    ArkUI_DrawableDescriptor *drawableDescriptorPtr, std::weak_ptr<IKRRenderViewExport> weak_view) {
-    struct ResultData resultData;
-    NativePixelMap *nativePixelMap = OH_PixelMap_InitNativePixelMap(env, pixelMap);
-    OhosPixelMapInfos info;
-    OH_PixelMap_GetImageInfo(nativePixelMap, &info);
-    struct ImagePacker_Opts_ opts;
-    opts.format = "image/png";
-    opts.quality = 80;
+KRSnapshotEncodeOptions KRSnapshotEncodeOptions::FromParams(const KRRenderValue::Map &params) {
+    KRSnapshotEncodeOptions options;
+    auto format = params.find("format");
+    if (format != params.end() && format->second) {
+        auto value = format->second->toString();
+        if (value == "jpeg") {
+            options.format = KRSnapshotEncodeFormat::kJPEG;
+        } else if (value == "raw") {
+            options.format = KRSnapshotEncodeFormat::kRaw;
+        }
+    }
+    auto quality = params.find("quality");
+    if (quality != params.end() && quality->second && quality->second->toInt() > 0) {
+        options.quality = std::min(quality->second->toInt(), 100);
+    }
+    return options;
+}
 
-    size_t size = info.width * info.height * 4;
-    uint8_t *outData = reinterpret_cast<uint8_t *>(malloc(size));
+static bool GetPixelmapSize(OH_PixelmapNative *pixelmap, uint32_t &width, uint32_t &height) {
+    OH_Pixelmap_ImageInfo *info = nullptr;
+    OH_PixelmapImageInfo_Create(&info);
+    bool ok = OH_PixelmapNative_GetImageInfo(pixelmap, info) == IMAGE_SUCCESS;
+    if (ok) {
+        OH_PixelmapImageInfo_GetWidth(info, &width);
+        OH_PixelmapImageInfo_GetHeight(info, &height);
+    }
+    OH_PixelmapImageInfo_Release(info);
+    return ok && width > 0 && height > 0;
+}
+
+static bool PackPixelmap(OH_PixelmapNative *pixelmap, const char *mime_type, int quality, std::string &out) {
+    uint32_t width = 0;
+    uint32_t height = 0;
+    if (!GetPixelmapSize(pixelmap, width, height)) {
+        return false;
+    }
+    OH_ImagePackerNative *packer = nullptr;
+    if (OH_ImagePackerNative_Create(&packer) != IMAGE_SUCCESS) {
+        return false;
+    }
+    OH_PackingOptions *opts = nullptr;
+    OH_PackingOptions_Create(&opts);
+    Image_MimeType mime = {const_cast<char *>(mime_type), strlen(mime_type)};
+    OH_PackingOptions_SetMimeType(opts, &mime);
+    OH_PackingOptions_SetQuality(opts, quality);
+    // 压缩结果极少超过原始像素大小，额外留一些头部空间
+    size_t size = static_cast<size_t>(width) * height * 4 + 4096;
+    out.resize(size);
+    auto err = OH_ImagePackerNative_PackToDataFromPixelmap(packer, opts, pixelmap,
+                                                           reinterpret_cast<uint8_t *>(out.data()), &size);
+    OH_PackingOptions_Release(opts);
+    OH_ImagePackerNative_Release(packer);
+    if (err != IMAGE_SUCCESS) {
+        KR_LOG_ERROR << "snapshot pack failed, err:" << err;
+        out.clear();
+        return false;
+    }
+    out.resize(size);
+    return true;
+}
 
-    napi_value packer;
-    OH_ImagePacker_Create(env, &packer);
-    ImagePacker_Native *imagePacker = OH_ImagePacker_InitNative(env, packer);
-    int err = OH_ImagePacker_PackToData(imagePacker, pixelMap, &opts, outData, &size);
-    OH_ImagePacker_Release(imagePacker);
-    if (err == 0) {
-        std::string_view imageData((const char *)outData, size);
-        std::string base64Data = KRBase64Util::Encode(imageData);
-        std::stringstream base64ImageSS;
-        base64ImageSS << "data:" << opts.format << ";base64," << base64Data;
-        resultData.data = base64ImageSS.str();
-        resultData.code = 0;
+static KRSnapshotManager::ResultData EncodeDataUri(OH_PixelmapNative *pixelmap,
+                                                  const KRSnapshotEncodeOptions &options) {
+    KRSnapshotManager::ResultData resultData;
+    std::string bytes;
+    std::string prefix;
+    if (options.format == KRSnapshotEncodeFormat::kRaw) {
+        uint32_t width = 0;
+        uint32_t height = 0;
+        if (GetPixelmapSize(pixelmap, width, height)) {
+            size_t size = static_cast<size_t>(width) * height * 4;
+            bytes.resize(size);
+            if (OH_PixelmapNative_ReadPixels(pixelmap, reinterpret_cast<uint8_t *>(bytes.data()), &size) ==
+                IMAGE_SUCCESS) {
+                bytes.resize(size);
+                prefix = "data:image/x-rgba8888;width=" + std::to_string(width) + ";height=" + std::to_string(height) +
+                         ";base64,";
+            }
+        }
+    } else {
+        const char *mime_type = options.format == KRSnapshotEncodeFormat::kJPEG ? "image/jpeg" : "image/png";
+        if (PackPixelmap(pixelmap, mime_type, options.quality, bytes)) {
+            prefix = std::string("data:") + mime_type + ";base64,";
+        }
+    }
+    if (prefix.empty()) {
+        resultData.message = "ERROR: FAILED TO ENCODE SNAPSHOT";
+        return resultData;
     }
-    free(outData);
+    resultData.data.reserve(prefix.size() + (bytes.size() + 2) / 3 * 4);
+    resultData.data.append(prefix);
+    KRBase64Util::EncodeAppend(bytes, resultData.data);
+    resultData.code = 0;
     return resultData;
 }
 
-void KRSnapshotManager::RemoveCachedDrawableAfterDelay(int delayMS, const std::string &key, const std::string &path,
-                                                       const std::string &pathUri,
-                                                       std::weak_ptr<IKRRenderViewExport> weak_view) {
-    KRContextScheduler::ScheduleTask(false, delayMS, [delayMS, weak_view, path, pathUri, key]() {
-        if (access(path.c_str(), F_OK) == 0) {
-            KRContextScheduler::ScheduleTaskOnMainThread(false, [delayMS, weak_view, pathUri, key] {
-                if (auto strong_view = weak_view.lock()) {
-                    if (auto strong_root = strong_view->GetRootView().lock()) {
-                        auto snapshotManager = strong_root->GetSnapshotManager();
-                        snapshotManager->UpdateSnapshot(pathUri, key);
-                    }
+void KRSnapshotManager::EncodeDataUriAsync(OH_PixelmapNative *pixelmap, const KRSnapshotEncodeOptions &options,
+                                           const ResultCallback &completion) {
+    KRGCDQueue::GetInstance().DispatchAsync([pixelmap, options, completion] {
+        auto resultData = EncodeDataUri(pixelmap, options);
+        OH_PixelmapNative_Release(pixelmap);
+        KRMainThread::RunOnMainThread([resultData = std::move(resultData), completion] { completion(resultData); });
+    });
+}
+
+void KRSnapshotManager::WriteSnapshotFileAsync(OH_PixelmapNative *pixelmap, const std::string &key,
+                                               const std::string &path, const std::string &pathUri,
+                                               std::weak_ptr<IKRRenderViewExport> weak_view) {
+    KRGCDQueue::GetInstance().DispatchAsync([pixelmap, key, path, pathUri, weak_view] {
+        std::string bytes;
+        bool ok = PackPixelmap(pixelmap, "image/png", 100, bytes);
+        OH_PixelmapNative_Release(pixelmap);
+        if (ok) {
+            std::ofstream file(path, std::ios::binary | std::ios::trunc);
+            ok = static_cast<bool>(file.write(bytes.data(), bytes.size()));
+        }
+        if (!ok) {
+            KR_LOG_ERROR << "snapshot write file failed, path:" << path;
+            return;  // 写入失败时保留内存中的 drawable
+        }
+        KRMainThread::RunOnMainThread([weak_view, pathUri, key] {
+            if (auto strong_view = weak_view.lock()) {
+                if (auto strong_root = strong_view->GetRootView().lock()) {
+                    strong_root->GetSnapshotManager()->UpdateSnapshot(pathUri, key);
                 }
-            });
-        } else if (delayMS < MAX_DELAY_DURATION_MS) {
-            auto strongView = weak_view.lock();
-            if (strongView == nullptr) {
-                return;
-            }
-            if (auto root = strongView->GetRootView().lock()) {
-                auto snapshotManager = root->GetSnapshotManager();
-                snapshotManager->RemoveCachedDrawableAfterDelay(delayMS * 2, key, path, pathUri, weak_view);
             }
-        }
+        });
     });
 }
 
 struct KRSnapshotManager::ResultData KRSnapshotManager::ProcessSnapshotResultWithCacheKeyType(
-    napi_env env, napi_value pixelMap, const std::string &path, const std::string &pathUri,
+    OH_PixelmapNative *pixelmap, const std::string &path, const std::string &pathUri,
     ArkUI_DrawableDescriptor *drawableDescriptorPtr, std::weak_ptr<IKRRenderViewExport> weak_view) {
     struct ResultData resultData;
     std::stringstream kss;
     kss << "data:image_Md5_Pixelmap" << drawableDescriptorPtr;
     std::string key = kss.str();
-    if (auto strong_view = weak_view.lock()) {
-        if (auto strong_root = strong_view->GetRootView().lock()) {
-            auto snapshotManager = strong_root->GetSnapshotManager();
-            snapshotManager->CacheSnapshot(drawableDescriptorPtr, key);
-            // users would typically use the result immediately,
-            // keep the drawable for a while, and remove it after the disk copy is ready
-            snapshotManager->RemoveCachedDrawableAfterDelay(TIME_TO_REMOVE_SNAPSHOT_DRAWABLE_MS, key, path, pathUri,
-                                                            weak_view);
-        }
+    CacheSnapshot(drawableDescriptorPtr, key);
+    // users would typically use the result immediately,
+    // keep the drawable until the disk copy is written on the worker thread
+    if (pixelmap) {
+        WriteSnapshotFileAsync(pixelmap, key, path, pathUri, weak_view);
     }
     resultData.data = key;
     resultData.code = 0;
@@ -171,18 +242,23 @@ struct KRSnapshotManager::ResultData KRSnapshotManager::ProcessSnapshotResultWit
     return resultData;
 }
 
-struct KRSnapshotManager::ResultData KRSnapshotManager::ProcessSnapshotResultWithFileType(
-    napi_env env, napi_value pixelMap, const std::string &path, const std::string &pathUri,
-    ArkUI_DrawableDescriptor *drawableDescriptorPtr, std::weak_ptr<IKRRenderViewExport> weak_view) {
+struct KRSnapshotManager::ResultData KRSnapshotManager::ProcessSnapshotResultWithFileType(const std::string &pathUri) {
     struct ResultData resultData;
     resultData.code = 0;
-    if (resultData.code == 0) {
-        resultData.data = pathUri;
+    resultData.data = pathUri;
+    return resultData;
+}
+
+static void InvokeSnapshotCallback(const KRRenderCallback &callback, int code, const std::string &data,
+                                   const std::string &message) {
+    KRRenderValue::Map resultMap;
+    resultMap["code"] = std::make_shared<KRRenderValue>(code);
+    if (code == 0) {
+        resultMap["data"] = std::make_shared<KRRenderValue>(data);
     } else {
-        resultData.message = "ERROR: FAILED TO SAVE SNAPSHOT";
+        resultMap["message"] = std::make_shared<KRRenderValue>(message);
     }
-
-    return resultData;
+    callback(std::make_shared<KRRenderValue>(resultMap));
 }
 
 void KRSnapshotManager::TakeSnapshot(const std::string &instance_id, const std::string &method_name,
@@ -197,61 +273,67 @@ void KRSnapshotManager::TakeSnapshot(const std::string &instance_id, const std::
         KRRenderCallback toImageCb = [params, callback, weak_view](KRAnyValue result) {
             bool isNapiValue = result->isNapiValue();
             auto strongView = weak_view.lock();
-            if (isNapiValue && strongView) {
-                auto paramsMap = params->toMap();
-                std::string type = paramsMap["type"]->toString();
-                NapiValue napiValue = result->toNapiValue();
-                auto env = napiValue.env;
-                ArkTS arkTs(napiValue.env);
-
-                napi_value snapshotData = arkTs.GetArrayElement(napiValue.value, 0);
-                napi_value drawableDescriptor = arkTs.GetObjectProperty(snapshotData, "drawableDescriptor");
-                KRSnapshotManager::ResultData resultData;
-
-                if (arkTs.IsNull(drawableDescriptor) || arkTs.IsUndefined(drawableDescriptor)) {
-                    resultData.data = arkTs.GetString(arkTs.GetObjectProperty(snapshotData, "message"));
-                    resultData.code = -1;
-                } else {
-                    napi_value pixelMap = arkTs.GetObjectProperty(snapshotData, "pixelMap");
+            if (!isNapiValue || !strongView) {
+                InvokeSnapshotCallback(callback, -1, "", "invalid result from arkts");
+                return;
+            }
+            auto paramsMap = params->toMap();
+            std::string type = paramsMap["type"]->toString();
+            NapiValue napiValue = result->toNapiValue();
+            auto env = napiValue.env;
+            ArkTS arkTs(napiValue.env);
 
-                    ArkUI_DrawableDescriptor *drawableDescriptorPtr = nullptr;
-                    OH_ArkUI_GetDrawableDescriptorFromNapiValue(env, drawableDescriptor, &drawableDescriptorPtr);
-                    std::string pathStr;
-                    std::string pathURI;
-                    if (auto root = strongView->GetRootView().lock()) {
-                        auto snapshotManager = root->GetSnapshotManager();
-                        if (type == "dataUri") {
-                            resultData = snapshotManager->ProcessSnapshotResultWithDataType(
-                                env, pixelMap, "", "", drawableDescriptorPtr, weak_view);
-                        } else {
-                            napi_value path = arkTs.GetObjectProperty(snapshotData, "path");
-                            pathStr = arkTs.GetString(path);
-                            napi_value uri = arkTs.GetObjectProperty(snapshotData, "pathURI");
-                            pathURI = arkTs.GetString(uri);
-                            if (type == "cacheKey") {
-                                resultData = snapshotManager->ProcessSnapshotResultWithCacheKeyType(
-                                    env, pixelMap, pathStr, pathURI, drawableDescriptorPtr, weak_view);
-                            } else if (type == "file") {
-                                resultData = snapshotManager->ProcessSnapshotResultWithFileType(
-                                    env, pixelMap, pathStr, pathURI, drawableDescriptorPtr, weak_view);
-                            }
-                        }
-                    }
-                }
-                KRRenderValue::Map resultMap;
-                resultMap["code"] = std::make_shared<KRRenderValue>(resultData.code);
-                if (resultData.code == 0) {
-                    resultMap["data"] = std::make_shared<KRRenderValue>(resultData.data);
-                } else {
-                    resultMap["message"] = std::make_shared<KRRenderValue>(resultData.message);
+            napi_value snapshotData = arkTs.GetArrayElement(napiValue.value, 0);
+            napi_value drawableDescriptor = arkTs.GetObjectProperty(snapshotData, "drawableDescriptor");
+            if (arkTs.IsNull(drawableDescriptor) || arkTs.IsUndefined(drawableDescriptor)) {
+                InvokeSnapshotCallback(callback, -1, "",
+                                       arkTs.GetString(arkTs.GetObjectProperty(snapshotData, "message")));
+                return;
+            }
+            auto root = strongView->GetRootView().lock();
+            if (!root) {
+                InvokeSnapshotCallback(callback, -1, "", "render view destroyed");
+                return;
+            }
+            auto snapshotManager = root->GetSnapshotManager();
+            if (type == "file") {
+                napi_value uri = arkTs.GetObjectProperty(snapshotData, "pathURI");
+                auto resultData = snapshotManager->ProcessSnapshotResultWithFileType(arkTs.GetString(uri));
+                InvokeSnapshotCallback(callback, resultData.code, resultData.data, resultData.message);
+                return;
+            }
+            // 主线程只取出 pixelmap，编码与写文件在工作线程完成
+            OH_PixelmapNative *pixelmap = nullptr;
+            napi_value pixelMap = arkTs.GetObjectProperty(snapshotData, "pixelMap");
+            if (OH_PixelmapNative_ConvertPixelmapNativeFromNapi(env, pixelMap, &pixelmap) != IMAGE_SUCCESS) {
+                pixelmap = nullptr;
+            }
+            if (type == "dataUri") {
+                if (pixelmap == nullptr) {
+                    InvokeSnapshotCallback(callback, -1, "", "ERROR: INVALID SNAPSHOT PIXELMAP");
+                    return;
                 }
-                callback(std::make_shared<KRRenderValue>(resultMap));
-            } else {
-                KRRenderValue::Map resultMap;
-                resultMap["code"] = std::make_shared<KRRenderValue>(-1);
-                resultMap["message"] = std::make_shared<KRRenderValue>("invalid result from arkts");
-                callback(std::make_shared<KRRenderValue>(resultMap));
+                EncodeDataUriAsync(pixelmap, KRSnapshotEncodeOptions::FromParams(paramsMap),
+                                   [callback](const ResultData &resultData) {
+                                       InvokeSnapshotCallback(callback, resultData.code, resultData.data,
+                                                              resultData.message);
+                                   });
+                return;
+            }
+            if (type == "cacheKey") {
+                ArkUI_DrawableDescriptor *drawableDescriptorPtr = nullptr;
+                OH_ArkUI_GetDrawableDescriptorFromNapiValue(env, drawableDescriptor, &drawableDescriptorPtr);
+                napi_value path = arkTs.GetObjectProperty(snapshotData, "path");
+                napi_value uri = arkTs.GetObjectProperty(snapshotData, "pathURI");
+                auto resultData = snapshotManager->ProcessSnapshotResultWithCacheKeyType(
+                    pixelmap, arkTs.GetString(path), arkTs.GetString(uri), drawableDescriptorPtr, weak_view);
+                InvokeSnapshotCallback(callback, resultData.code, resultData.data, resultData.message);
+                return;
+            }
+            if (pixelmap) {
+                OH_PixelmapNative_Release(pixelmap);
             }
+            InvokeSnapshotCallback(callback, -1, "", "unsupported snapshot type: " + type);
         };
         KRArkTSManager::GetInstance().CallArkTSMethod(
             instance_id, KRNativeCallArkTSMethod::CallModuleMethod, module_name, NewKRRenderValue(method_name),
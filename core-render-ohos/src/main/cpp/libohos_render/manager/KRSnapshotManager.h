@@ -16,11 +16,25 @@
 #ifndef CORE_RENDER_OHOS_KRSNAPSHOTMANAGER_H
 #define CORE_RENDER_OHOS_KRSNAPSHOTMANAGER_H
 #include <arkui/drawable_descriptor.h>
+#include <multimedia/image_framework/image/pixelmap_native.h>
+#include <functional>
 #include <string>
 #include <unordered_map>
 #include "libohos_render/expand/components/view/KRView.h"
 #include "libohos_render/foundation/KRCommon.h"
 
+/**
+ * dataUri 类型快照的编码格式，raw 为未压缩的 RGBA_8888 像素
+ */
+enum class KRSnapshotEncodeFormat { kPNG, kJPEG, kRaw };
+
+struct KRSnapshotEncodeOptions {
+    KRSnapshotEncodeFormat format = KRSnapshotEncodeFormat::kPNG;
+    int quality = 80;
+
+    static KRSnapshotEncodeOptions FromParams(const KRRenderValue::Map &params);
+};
+
 struct KRSnapshotItem {
     KRSnapshotItem() : drawableDescriptor(nullptr) {}
     ArkUI_DrawableDescriptor *drawableDescriptor;
@@ -29,6 +43,12 @@ struct KRSnapshotItem {
 
 class KRSnapshotManager {
  public:
+    struct ResultData {
+        int code = -1;
+        std::string data;
+        std::string message;
+    };
+
     ~KRSnapshotManager();
 
     void SetCachedSnapshotToNode(ArkUI_NodeHandle node, const std::string &key);
@@ -37,29 +57,26 @@ class KRSnapshotManager {
                       std::weak_ptr<IKRRenderViewExport> weak_view);
 
  private:
-    struct ResultData {
-        int code;
-        std::string data;
-        std::string message;
-    };
+    using ResultCallback = std::function<void(const ResultData &)>;
 
-    struct ResultData ProcessSnapshotResultWithDataType(napi_env env, napi_value pixelMap, const std::string &path,
-                                                        const std::string &pathUri,
-                                                        ArkUI_DrawableDescriptor *drawableDescriptorPtr,
-                                                        std::weak_ptr<IKRRenderViewExport> weak_view);
-    struct ResultData ProcessSnapshotResultWithCacheKeyType(napi_env env, napi_value pixelMap, const std::string &path,
+    /**
+     * 在工作线程编码为 data uri，完成后在主线程回调；pixelmap 的所有权转移给该方法
+     */
+    static void EncodeDataUriAsync(OH_PixelmapNative *pixelmap, const KRSnapshotEncodeOptions &options,
+                                   const ResultCallback &completion);
+    struct ResultData ProcessSnapshotResultWithCacheKeyType(OH_PixelmapNative *pixelmap, const std::string &path,
                                                             const std::string &pathUri,
                                                             ArkUI_DrawableDescriptor *drawableDescriptorPtr,
                                                             std::weak_ptr<IKRRenderViewExport> weak_view);
-    struct ResultData ProcessSnapshotResultWithFileType(napi_env env, napi_value pixelMap, const std::string &path,
-                                                        const std::string &pathUri,
-                                                        ArkUI_DrawableDescriptor *drawableDescriptorPtr,
-                                                        std::weak_ptr<IKRRenderViewExport> weak_view);
+    struct ResultData ProcessSnapshotResultWithFileType(const std::string &pathUri);
 
     void CacheSnapshot(ArkUI_DrawableDescriptor *descriptor, const std::string &key);
     void UpdateSnapshot(const std::string &uri, const std::string &key);
-    void RemoveCachedDrawableAfterDelay(int delayMS, const std::string &key, const std::string &path,
-                                        const std::string &pathUri, std::weak_ptr<IKRRenderViewExport> weak_view);
+    /**
+     * 在工作线程将快照写入 path，写入完成后用文件 uri 替换缓存的 drawable；pixelmap 的所有权转移给该方法
+     */
+    void WriteSnapshotFileAsync(OH_PixelmapNative *pixelmap, const std::string &key, const std::string &path,
+                                const std::string &pathUri, std::weak_ptr<IKRRenderViewExport> weak_view);
 
     std::unordered_map<std::string, struct KRSnapshotItem> drawableDescriptorCache_;
 };
@@ -15,38 +15,116 @@
 
 #include "libohos_render/scheduler/KRContextScheduler.h"
 
+#include <unordered_map>
 #include "libohos_render/foundation/thread/KRMainThread.h"
+#include "libohos_render/foundation/thread/KRSyncLatch.h"
 
 class KRContextSchedulerInternal {
  public:
     virtual ~KRContextSchedulerInternal() = default;
-    virtual void ScheduleTask(bool sync, int delayMs, const KRSchedulerTask &task) = 0;
-    virtual void ScheduleTaskOnMainThread(bool sync, const KRSchedulerTask &task) = 0;
-    virtual void DirectRunOnMainThread(bool isSync, const KRSchedulerTask &task) = 0;
+    virtual bool ScheduleTask(bool sync, int delayMs, const KRSchedulerTask &task) = 0;
+    virtual uint64_t ScheduleDelayedTask(int delayMs, const KRSchedulerTask &task) = 0;
+    virtual void CancelDelayedTask(uint64_t taskId) = 0;
+    virtual bool ScheduleTaskOnMainThread(bool sync, const KRSchedulerTask &task) = 0;
+    virtual bool DirectRunOnMainThread(bool isSync, const KRSchedulerTask &task) = 0;
+    virtual KRContextScheduler::SyncTaskStats GetSyncTaskStats() {
+        return {};
+    }
 
     virtual bool IsCurrentOnContextThread() = 0;
 };
 
 class KRContextSchedulerMultiThreaded : public KRContextSchedulerInternal {
  public:
-    void ScheduleTask(bool sync, int delayMs, const KRSchedulerTask &task) override;
-    void ScheduleTaskOnMainThread(bool sync, const KRSchedulerTask &task) override;
-    void DirectRunOnMainThread(bool isSync, const KRSchedulerTask &task) override;
+    bool ScheduleTask(bool sync, int delayMs, const KRSchedulerTask &task) override;
+    uint64_t ScheduleDelayedTask(int delayMs, const KRSchedulerTask &task) override;
+    void CancelDelayedTask(uint64_t taskId) override;
+    bool ScheduleTaskOnMainThread(bool sync, const KRSchedulerTask &task) override;
+    bool DirectRunOnMainThread(bool isSync, const KRSchedulerTask &task) override;
     bool IsCurrentOnContextThread() override;
+    KRContextScheduler::SyncTaskStats GetSyncTaskStats() override;
 
  private:
+    // Context线程同步等待主线程时，每隔该时长打印一次仍在等待的日志
+    static constexpr int kSyncMainTaskWarnMs = 1000;
+    // 同步等待超过该时长时打印耗时
+    static constexpr int kSyncMainTaskSlowMs = 16;
+    // 同步等待的截止时长，到期时主线程仍未开始执行则放弃该任务
+    static constexpr int kSyncMainTaskTimeoutMs = 5000;
+
+    /**
+     * @return 任务在主线程执行完成返回 true，超时放弃返回 false
+     */
+    bool RunOnMainThreadAndWait(const KRSchedulerTask &task);
+    bool DispatchAsyncIfReentrant(const KRSchedulerTask &task);
+
     static KRThread *GetContextThread() {
         static KRThread *gContextThread = new KRThread("kuikly");
         return gContextThread;
     }
     static std::atomic_bool runningOnMainThread;
     static std::thread::id mainThreadId;
+    // 主线程正在执行Context线程同步派发过来的任务
+    static thread_local bool inSyncMainTask;
+    // 超时被放弃的同步主线程任务数
+    std::atomic<uint64_t> abandonedSyncTaskCount_{0};
+    // 重入时被降级为异步执行的同步任务数
+    std::atomic<uint64_t> reentrantAsyncTaskCount_{0};
 };
 
 std::atomic_bool KRContextSchedulerMultiThreaded::runningOnMainThread{false};
 std::thread::id KRContextSchedulerMultiThreaded::mainThreadId;
+thread_local bool KRContextSchedulerMultiThreaded::inSyncMainTask = false;
+
+bool KRContextSchedulerMultiThreaded::DispatchAsyncIfReentrant(const KRSchedulerTask &task) {
+    if (!inSyncMainTask) {
+        return false;
+    }
+    // Context线程正阻塞等待当前主线程任务，此时再同步调度回Context线程必然无法同步完成
+    auto count = ++reentrantAsyncTaskCount_;
+    KR_LOG_ERROR << "re-entrant sync call from sync main task, dispatch async, total:" << count;
+    GetContextThread()->DispatchAsync(task, 0);
+    return true;
+}
 
-void KRContextSchedulerMultiThreaded::DirectRunOnMainThread(bool isSync, const KRSchedulerTask &task) {
+bool KRContextSchedulerMultiThreaded::RunOnMainThreadAndWait(const KRSchedulerTask &task) {
+    auto contextThread = GetContextThread();
+    auto latch = std::make_shared<KRSyncLatch>();
+    auto start = std::chrono::steady_clock::now();
+    contextThread->BeginSyncMainTask();
+    // 超时返回后主线程仍可能取到该任务，task 需按值持有
+    KRMainThread::RunOnMainThread([task, latch] {
+        if (!latch->TryStart()) {
+            return;
+        }
+        inSyncMainTask = true;
+        task();
+        inSyncMainTask = false;
+        latch->CountDown();
+    });
+    while (!latch->WaitFor(std::chrono::milliseconds(kSyncMainTaskWarnMs))) {
+        auto waited = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+        // 任务已在主线程执行时不能提前返回，否则会与仍在运行的任务并发访问 Context 线程的数据
+        if (waited.count() >= kSyncMainTaskTimeoutMs && latch->Abandon()) {
+            contextThread->EndSyncMainTask();
+            auto count = ++abandonedSyncTaskCount_;
+            KR_LOG_ERROR << "sync main task timeout, abandoned after:" << waited.count() << "ms, total:" << count;
+            return false;
+        }
+        KR_LOG_ERROR << "sync main task still waiting, cost:" << waited.count() << "ms";
+    }
+    contextThread->EndSyncMainTask();
+    auto cost = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    if (cost.count() >= kSyncMainTaskSlowMs) {
+        KR_LOG_INFO << "sync main task cost:" << cost.count() << "ms";
+    }
+    return true;
+}
+
+bool KRContextSchedulerMultiThreaded::DirectRunOnMainThread(bool isSync, const KRSchedulerTask &task) {
+    if (isSync && DispatchAsyncIfReentrant(task)) {
+        return false;
+    }
     if (isSync) {
         GetContextThread()->DirectRunOnCurThread([task]() {
             mainThreadId = std::this_thread::get_id();
@@ -57,33 +135,36 @@ void KRContextSchedulerMultiThreaded::DirectRunOnMainThread(bool isSync, const K
     } else {
         GetContextThread()->DispatchAsync(task, 0);
     }
+    return true;
 }
 
-void KRContextSchedulerMultiThreaded::ScheduleTask(bool sync, int delayMs, const KRSchedulerTask &task) {
+bool KRContextSchedulerMultiThreaded::ScheduleTask(bool sync, int delayMs, const KRSchedulerTask &task) {
+    if (sync && DispatchAsyncIfReentrant(task)) {
+        return false;
+    }
     if (sync) {
         GetContextThread()->DispatchSync(task);
     } else {
         GetContextThread()->DispatchAsync(task, delayMs);
     }
+    return true;
+}
+
+uint64_t KRContextSchedulerMultiThreaded::ScheduleDelayedTask(int delayMs, const KRSchedulerTask &task) {
+    return GetContextThread()->DispatchDelayed(task, delayMs);
 }
 
-void KRContextSchedulerMultiThreaded::ScheduleTaskOnMainThread(bool sync, const KRSchedulerTask &task) {
+void KRContextSchedulerMultiThreaded::CancelDelayedTask(uint64_t taskId) {
+    GetContextThread()->CancelDelayed(taskId);
+}
+
+bool KRContextSchedulerMultiThreaded::ScheduleTaskOnMainThread(bool sync, const KRSchedulerTask &task) {
     if (sync) {
         if (GetContextThread()->IsCurrentThreadWorkerThread()) {
-            GetContextThread()->SyncMainTaskMutex(true, false, false);
-            std::mutex mtx;
-            mtx.lock();  // 同步
-            KRMainThread::RunOnMainThread([task, &mtx] {
-                task();
-                mtx.unlock();
-            });
-            mtx.lock();
-            mtx.unlock();
-            GetContextThread()->SyncMainTaskMutex(false, true, false);
-        } else {
-            // 说明在主线程, 直接同步
-            task();
+            return RunOnMainThreadAndWait(task);
         }
+        // 说明在主线程, 直接同步
+        task();
     } else {
         if (GetContextThread()->IsCurrentThreadWorkerThread()) {
             KRMainThread::RunOnMainThread([task] { task(); });
@@ -91,6 +172,11 @@ void KRContextSchedulerMultiThreaded::ScheduleTaskOnMainThread(bool sync, const
             task();
         }
     }
+    return true;
+}
+
+KRContextScheduler::SyncTaskStats KRContextSchedulerMultiThreaded::GetSyncTaskStats() {
+    return {abandonedSyncTaskCount_.load(), reentrantAsyncTaskCount_.load()};
 }
 
 bool KRContextSchedulerMultiThreaded::IsCurrentOnContextThread() {
@@ -102,36 +188,69 @@ bool KRContextSchedulerMultiThreaded::IsCurrentOnContextThread() {
 
 class KRContextSchedulerSingleThreaded : public KRContextSchedulerInternal {
  public:
-    void ScheduleTask(bool sync, int delayMs, const KRSchedulerTask &task) override;
-    void ScheduleTaskOnMainThread(bool sync, const KRSchedulerTask &task) override;
-    void DirectRunOnMainThread(bool isSync, const KRSchedulerTask &task) override;
+    bool ScheduleTask(bool sync, int delayMs, const KRSchedulerTask &task) override;
+    uint64_t ScheduleDelayedTask(int delayMs, const KRSchedulerTask &task) override;
+    void CancelDelayedTask(uint64_t taskId) override;
+    bool ScheduleTaskOnMainThread(bool sync, const KRSchedulerTask &task) override;
+    bool DirectRunOnMainThread(bool isSync, const KRSchedulerTask &task) override;
     bool IsCurrentOnContextThread() override;
     std::thread::id mainThreadId;
+
+ private:
+    // 单线程模式下延时任务在主线程执行，仅主线程访问
+    std::unordered_map<uint64_t, std::shared_ptr<bool>> delayedTasks_;
+    uint64_t lastDelayedTaskId_ = 0;
 };
 
-void KRContextSchedulerSingleThreaded::DirectRunOnMainThread(bool isSync, const KRSchedulerTask &task) {
+bool KRContextSchedulerSingleThreaded::DirectRunOnMainThread(bool isSync, const KRSchedulerTask &task) {
     mainThreadId = std::this_thread::get_id();
     if (isSync) {
         task();
     } else {
         KRMainThread::RunOnMainThread(task, 0);
     }
+    return true;
 }
 
-void KRContextSchedulerSingleThreaded::ScheduleTask(bool sync, int delayMs, const KRSchedulerTask &task) {
+bool KRContextSchedulerSingleThreaded::ScheduleTask(bool sync, int delayMs, const KRSchedulerTask &task) {
     if (sync) {
         task();
     } else {
         KRMainThread::RunOnMainThread(task, delayMs);
     }
+    return true;
 }
 
-void KRContextSchedulerSingleThreaded::ScheduleTaskOnMainThread(bool sync, const KRSchedulerTask &task) {
+uint64_t KRContextSchedulerSingleThreaded::ScheduleDelayedTask(int delayMs, const KRSchedulerTask &task) {
+    auto taskId = ++lastDelayedTaskId_;
+    auto alive = std::make_shared<bool>(true);
+    delayedTasks_[taskId] = alive;
+    KRMainThread::RunOnMainThread(
+        [this, taskId, alive, task] {
+            if (*alive) {
+                delayedTasks_.erase(taskId);
+                task();
+            }
+        },
+        delayMs);
+    return taskId;
+}
+
+void KRContextSchedulerSingleThreaded::CancelDelayedTask(uint64_t taskId) {
+    auto it = delayedTasks_.find(taskId);
+    if (it != delayedTasks_.end()) {
+        *(it->second) = false;
+        delayedTasks_.erase(it);
+    }
+}
+
+bool KRContextSchedulerSingleThreaded::ScheduleTaskOnMainThread(bool sync, const KRSchedulerTask &task) {
     if (sync) {
         task();
     } else {
         KRMainThread::RunOnMainThread([task] { task(); });
     }
+    return true;
 }
 
 bool KRContextSchedulerSingleThreaded::IsCurrentOnContextThread() {
@@ -158,14 +277,23 @@ std::shared_ptr<KRContextSchedulerInternal> KRContextScheduler::GetInstance() {
     return instance_;
 }
 
-void KRContextScheduler::ScheduleTask(bool sync, int delayMs, const KRSchedulerTask &task) {
-    GetInstance()->ScheduleTask(sync, delayMs, task);
+bool KRContextScheduler::ScheduleTask(bool sync, int delayMs, const KRSchedulerTask &task) {
+    return GetInstance()->ScheduleTask(sync, delayMs, task);
+}
+uint64_t KRContextScheduler::ScheduleDelayedTask(int delayMs, const KRSchedulerTask &task) {
+    return GetInstance()->ScheduleDelayedTask(delayMs, task);
+}
+void KRContextScheduler::CancelDelayedTask(uint64_t taskId) {
+    GetInstance()->CancelDelayedTask(taskId);
+}
+bool KRContextScheduler::ScheduleTaskOnMainThread(bool sync, const KRSchedulerTask &task) {
+    return GetInstance()->ScheduleTaskOnMainThread(sync, task);
 }
-void KRContextScheduler::ScheduleTaskOnMainThread(bool sync, const KRSchedulerTask &task) {
-    GetInstance()->ScheduleTaskOnMainThread(sync, task);
+bool KRContextScheduler::DirectRunOnMainThread(bool isSync, const KRSchedulerTask &task) {
+    return GetInstance()->DirectRunOnMainThread(isSync, task);
 }
-void KRContextScheduler::DirectRunOnMainThread(bool isSync, const KRSchedulerTask &task) {
-    GetInstance()->DirectRunOnMainThread(isSync, task);
+KRContextScheduler::SyncTaskStats KRContextScheduler::GetSyncTaskStats() {
+    return GetInstance()->GetSyncTaskStats();
 }
 bool KRContextScheduler::IsCurrentOnContextThread() {
     return GetInstance()->IsCurrentOnContextThread();
@@ -28,32 +28,62 @@ class KRContextScheduler {
         SingleThread = 1  // 单线程模型，Kuikly逻辑在主线程执行
     };
 
+    /**
+     * 同步任务未能同步完成的累计次数
+     */
+    struct SyncTaskStats {
+        uint64_t abandoned_count = 0;        // 等待主线程超时而被放弃（任务不会执行）
+        uint64_t reentrant_async_count = 0;  // 重入时降级为异步执行（调用方拿不到同步结果）
+    };
+
     /**
      * 调度任务到Context线程执行
      * @param sync 是否同步执行
      * @param delayMs 延时毫秒，0为不延时
      * @param task 任务闭包
+     * @return sync 为 true 且因重入只能异步执行时返回 false
+     */
+    static bool ScheduleTask(bool sync, int delayMs, const KRSchedulerTask &task);
+
+    /**
+     * 调度可取消的延时任务到Context线程执行
+     * @param delayMs 延时毫秒
+     * @param task 任务闭包
+     * @return 延时任务id，用于CancelDelayedTask
+     */
+    static uint64_t ScheduleDelayedTask(int delayMs, const KRSchedulerTask &task);
+
+    /**
+     * 取消尚未执行的延时任务
+     * @param taskId ScheduleDelayedTask返回的id
      */
-    static void ScheduleTask(bool sync, int delayMs, const KRSchedulerTask &task);
+    static void CancelDelayedTask(uint64_t taskId);
 
     /**
      * Context线程调度任务到主线程执行(注：该方法只能在主线程或Context线程被调用)
      * @param sync 是否同步执行
      * @param task 任务闭包
+     * @return sync 为 true 且等待主线程超时、任务被放弃时返回 false
      */
-    static void ScheduleTaskOnMainThread(bool sync, const KRSchedulerTask &task);
+    static bool ScheduleTaskOnMainThread(bool sync, const KRSchedulerTask &task);
     /**
      * 直接在主线线程同步执行在Context线程安全的任务
      * @param sync 是否同步执行
      * @param task 任务闭包
+     * @return isSync 为 true 且因重入只能异步执行时返回 false
      */
-    static void DirectRunOnMainThread(bool isSync, const KRSchedulerTask &task);
+    static bool DirectRunOnMainThread(bool isSync, const KRSchedulerTask &task);
 
     /**
      * 判断当前是否在Context线程
      */
     static bool IsCurrentOnContextThread();
 
+    /**
+     * 获取同步任务未能同步完成的累计次数，用于监控上报
+     */
+    static SyncTaskStats GetSyncTaskStats();
+
     /**
      * 设置线程模型，初始化kuikly前调用，初始化后调用无作用
      * @param mode 单线程或多线程模式
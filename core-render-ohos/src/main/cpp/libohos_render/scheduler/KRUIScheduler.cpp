@@ -19,10 +19,128 @@
 
 // should call on context线程
 void KRUIScheduler::AddTaskToMainQueueWithTask(const KRSchedulerTask &task) {
+    AddTaskToMainQueueWithTask(KRSchedulerTask(task));
+}
+// should call on context线程
+void KRUIScheduler::AddTaskToMainQueueWithTask(KRSchedulerTask &&task) {
     std::lock_guard<std::mutex> lock(m_mutex_);
-    m_main_thread_tasks_on_context_queue_.push_back(task);
+    // 不透明任务可能依赖任意视图的状态（如模块调用），作为全局屏障；各视图的合并状态在下次访问时按纪元失效
+    m_barrier_epoch_++;
+    m_main_thread_tasks_on_context_queue_.push_back(std::move(task));
     SetNeedSyncMainQuequeTasks();
 }
+// should call on context线程
+void KRUIScheduler::AddViewOpToMainQueue(KRUIViewOpType type, int tag, int parent_tag, const std::string &prop_key,
+                                         KRSchedulerTask &&task) {
+    std::lock_guard<std::mutex> lock(m_mutex_);
+    auto &tasks = m_main_thread_tasks_on_context_queue_;
+    auto index = tasks.size();
+    switch (type) {
+    case KRUIViewOpType::kCreate: {
+        auto &ops = GetBatchViewOps(tag);
+        ops.created_in_batch = ops.op_indexes.empty();
+        break;
+    }
+    case KRUIViewOpType::kRemove: {
+        auto it = m_batch_view_ops_.find(tag);
+        if (it != m_batch_view_ops_.end()) {
+            auto ops = std::move(it->second);
+            m_batch_view_ops_.erase(it);
+            auto droppable = ops.droppable && ops.barrier_epoch == m_barrier_epoch_;
+            // 之后插入同一父视图的兄弟节点按包含该视图的位置计算下标，丢弃其插入会导致兄弟节点错位
+            if (ops.created_in_batch && droppable && !HasLaterSiblingInsert(ops)) {
+                // 本批次内创建又删除，创建、插入、属性等操作都无需执行
+                for (auto op_index : ops.op_indexes) {
+                    tasks[op_index] = nullptr;
+                }
+                return;
+            }
+        }
+        tasks.push_back(std::move(task));
+        SetNeedSyncMainQuequeTasks();
+        return;
+    }
+    case KRUIViewOpType::kInsert: {
+        if (parent_tag != -1) {
+            auto &parent_ops = GetBatchViewOps(parent_tag);
+            RecordViewOp(parent_ops, index);
+            parent_ops.has_child_insert = true;
+            parent_ops.last_child_insert_index = index;
+            auto &child_ops = GetBatchViewOps(tag);
+            child_ops.insert_parent_tag = parent_tag;
+            child_ops.insert_index = index;
+        }
+        break;
+    }
+    case KRUIViewOpType::kSetProp:
+    case KRUIViewOpType::kFrame: {
+        // frame 与属性共用合并状态，以空 key 区分（属性名不会为空）
+        static const std::string kFrameOpKey;
+        const auto &op_key = type == KRUIViewOpType::kFrame ? kFrameOpKey : prop_key;
+        auto &ops = GetBatchViewOps(tag);
+        // 只合并该视图上紧邻的同 key 写入：中间有其他操作时两次都保留，不改变不同 key 之间的先后顺序
+        auto superseded = ops.last_op_mergeable && ops.last_op_key == op_key;
+        if (superseded) {
+            tasks[ops.last_op_index] = nullptr;  // 被本次写入覆盖
+        }
+        RecordViewOp(ops, index);
+        ops.last_op_mergeable = true;
+        ops.last_op_index = index;
+        if (!superseded) {
+            ops.last_op_key = op_key;
+        }
+        tasks.push_back(std::move(task));
+        SetNeedSyncMainQuequeTasks();
+        return;
+    }
+    case KRUIViewOpType::kBarrier:
+    case KRUIViewOpType::kOther: {
+        if (type == KRUIViewOpType::kOther) {
+            GetBatchViewOps(tag).droppable = false;
+        }
+        break;
+    }
+    }
+    RecordViewOp(GetBatchViewOps(tag), index);
+    tasks.push_back(std::move(task));
+    SetNeedSyncMainQuequeTasks();
+}
+
+KRUIScheduler::ViewOps &KRUIScheduler::GetBatchViewOps(int tag) {
+    auto result = m_batch_view_ops_.try_emplace(tag);
+    auto &ops = result.first->second;
+    if (result.second) {
+        ops.barrier_epoch = m_barrier_epoch_;
+    } else if (ops.barrier_epoch != m_barrier_epoch_) {
+        // 上次访问之后插入过不透明任务：之前的写入不再合并，视图也不再整体丢弃
+        ops.last_op_mergeable = false;
+        ops.droppable = false;
+        ops.barrier_epoch = m_barrier_epoch_;
+    }
+    return ops;
+}
+
+void KRUIScheduler::RecordViewOp(ViewOps &ops, size_t index) {
+    ops.op_indexes.push_back(index);
+    ops.last_op_mergeable = false;
+}
+
+bool KRUIScheduler::HasLaterSiblingInsert(const ViewOps &ops) {
+    if (ops.insert_parent_tag == -1) {
+        return false;
+    }
+    auto it = m_batch_view_ops_.find(ops.insert_parent_tag);
+    if (it == m_batch_view_ops_.end()) {
+        // 父视图已在本批次内删除，保守处理
+        return true;
+    }
+    return it->second.has_child_insert && it->second.last_child_insert_index > ops.insert_index;
+}
+
+void KRUIScheduler::ResetBatchViewOps() {
+    m_batch_view_ops_.clear();
+}
+
 // should call on context线程
 void KRUIScheduler::PerformSyncMainQueueTasksBlockIfNeed(bool sync) {
     if (m_need_sync_main_queue_tasks_block_) {
@@ -53,6 +171,7 @@ void KRUIScheduler::Destroy() {
     m_delegate_ = nullptr;
     m_need_sync_main_queue_tasks_block_ = nullptr;
     m_main_thread_tasks_on_context_queue_.clear();
+    ResetBatchViewOps();
 }
 
 void KRUIScheduler::SetNeedSyncMainQuequeTasks() {
@@ -73,12 +192,18 @@ void KRUIScheduler::SetNeedSyncMainQuequeTasks() {
                 scheduler->m_delegate_->WillPerformUITasksWithScheduler();
             }
             
-            std::vector<KRSchedulerTask> performTasks;
             {
                 std::lock_guard<std::mutex> lock(scheduler->m_mutex_);
-                performTasks = scheduler->m_main_thread_tasks_on_context_queue_;
-                scheduler->m_main_thread_tasks_on_context_queue_ = {};
-                scheduler->m_main_thread_tasks_.insert(scheduler->m_main_thread_tasks_.end(), performTasks.begin(), performTasks.end());
+                auto &pendingTasks = scheduler->m_main_thread_tasks_on_context_queue_;
+                auto &mainTasks = scheduler->m_main_thread_tasks_;
+                if (mainTasks.empty()) {
+                    mainTasks.swap(pendingTasks);
+                } else {
+                    mainTasks.insert(mainTasks.end(), std::make_move_iterator(pendingTasks.begin()),
+                                     std::make_move_iterator(pendingTasks.end()));
+                    pendingTasks.clear();
+                }
+                scheduler->ResetBatchViewOps();
             }
             
             scheduler->PerformOnMainQueueWithTask(sync, [weakSelf] {
@@ -92,8 +217,7 @@ void KRUIScheduler::SetNeedSyncMainQuequeTasks() {
                 std::vector<KRSchedulerTask> mainTasks;
                 {
                     std::lock_guard<std::mutex> lock(scheduler->m_mutex_);
-                    mainTasks = scheduler->m_main_thread_tasks_;
-                    scheduler->m_main_thread_tasks_ = {};
+                    mainTasks.swap(scheduler->m_main_thread_tasks_);
                 }
                 scheduler->RunMainQueueTasks(mainTasks);
             });
@@ -126,20 +250,22 @@ void KRUIScheduler::RunMainQueueTasks(const std::vector<KRSchedulerTask> &tasks)
     // 主线程
     m_performing_main_queue_task_ = true;
     for (size_t i = 0; i < tasks.size(); i++) {
-        tasks[i]();
+        if (tasks[i]) {  // 被合并或丢弃的操作为空
+            tasks[i]();
+        }
     }
     m_performing_main_queue_task_ = false;
     if (!m_view_did_load_) {
         m_view_did_load_ = true;
-        auto viewDidLoadTasks = m_view_did_load_main_thread_tasks_;
-        m_view_did_load_main_thread_tasks_ = {};
+        auto viewDidLoadTasks = std::move(m_view_did_load_main_thread_tasks_);
+        m_view_did_load_main_thread_tasks_.clear();
         for (size_t i = 0; i < viewDidLoadTasks.size(); i++) {
             viewDidLoadTasks[i]();
         }
     }
     if (m_did_end_main_thread_tasks_.size() > 0) {
-        auto tasks = m_did_end_main_thread_tasks_;
-        m_did_end_main_thread_tasks_ = {};
+        auto tasks = std::move(m_did_end_main_thread_tasks_);
+        m_did_end_main_thread_tasks_.clear();
         for (size_t i = 0; i < tasks.size(); i++) {
             tasks[i]();
         }
@@ -16,16 +16,32 @@
 #ifndef CORE_RENDER_OHOS_KRUISCHEDULER_H
 #define CORE_RENDER_OHOS_KRUISCHEDULER_H
 
+#include <cstdint>
 #include <functional>
 #include <future>
 #include <mutex>
+#include <string>
 #include <thread>
+#include <unordered_map>
 #include <vector>
 #include "libohos_render/foundation/thread/KRMainThread.h"
 #include "libohos_render/scheduler/IKRScheduler.h"
 
 using KRSyncSchedulerTask = std::function<void(bool sync)>;
 
+/**
+ * 可在同一批次内合并的视图操作类型
+ */
+enum class KRUIViewOpType {
+    kCreate,   // 创建视图
+    kRemove,   // 删除视图
+    kInsert,   // 插入子视图，tag 为子视图，parent_tag 为父视图
+    kSetProp,  // 设置属性，同一视图上紧邻的同名属性写入只保留最后一次
+    kFrame,    // 设置 frame，同一视图上紧邻的 frame 写入只保留最后一次
+    kBarrier,  // 对顺序敏感的属性（如 animation），之前的属性写入不再与之后的合并
+    kOther,    // 其他依赖视图的操作（如 callViewMethod），同时作为屏障，且该视图本批次的操作不再丢弃
+};
+
 class KRRenderUISchedulerDelegate {
  public:
     // UI任务将要执行前回调
@@ -38,6 +54,19 @@ class KRUIScheduler : public IKRScheduler {
 
     // should call on context线程
     void AddTaskToMainQueueWithTask(const KRSchedulerTask &task);
+    void AddTaskToMainQueueWithTask(KRSchedulerTask &&task);
+    /**
+     * 添加视图操作到主线程队列（should call on context线程）
+     * 同一批次内，同一视图上紧邻（中间没有该视图的其他操作）的同名属性或 frame 写入只执行最后一次，
+     * 保留的操作维持原有先后顺序；在本批次内创建又删除的视图，其操作全部丢弃
+     * @param type 操作类型
+     * @param tag 视图 tag
+     * @param parent_tag 父视图 tag，仅 kInsert 有效
+     * @param prop_key 属性名，仅 kSetProp 有效
+     * @param task 操作任务
+     */
+    void AddViewOpToMainQueue(KRUIViewOpType type, int tag, int parent_tag, const std::string &prop_key,
+                              KRSchedulerTask &&task);
     // should call on context线程
     void PerformSyncMainQueueTasksBlockIfNeed(bool sync);
     // should call on main thread
@@ -59,11 +88,33 @@ class KRUIScheduler : public IKRScheduler {
 
     void RunMainQueueTasks(const std::vector<KRSchedulerTask> &tasks);
 
+    /** 当前批次内某个视图的操作记录 */
+    struct ViewOps {
+        bool created_in_batch = false;
+        bool droppable = true;
+        uint64_t barrier_epoch = 0;      // 记录时的屏障纪元，落后于 m_barrier_epoch_ 表示之后有不透明任务
+        std::vector<size_t> op_indexes;  // 在当前批次任务队列中的下标
+        bool last_op_mergeable = false;  // 该视图最近一次操作是否为可被覆盖的属性/frame 写入
+        std::string last_op_key;         // 最近一次属性写入的 key（frame 为空）
+        size_t last_op_index = 0;        // 最近一次属性写入的下标
+        int insert_parent_tag = -1;      // 本批次内最近一次插入的父视图
+        size_t insert_index = 0;         // 本批次内最近一次插入自身的下标
+        bool has_child_insert = false;
+        size_t last_child_insert_index = 0;  // 本批次内最近一次向自身插入子视图的下标
+    };
+
+    ViewOps &GetBatchViewOps(int tag);
+    void RecordViewOp(ViewOps &ops, size_t index);
+    bool HasLaterSiblingInsert(const ViewOps &ops);
+    void ResetBatchViewOps();
+
     bool m_is_destroyed_ = false;
     KRSyncSchedulerTask m_need_sync_main_queue_tasks_block_ = nullptr;
     KRRenderUISchedulerDelegate *m_delegate_ = nullptr;
     bool m_performing_main_queue_task_ = false;
     std::vector<KRSchedulerTask> m_main_thread_tasks_on_context_queue_;
+    std::unordered_map<int, ViewOps> m_batch_view_ops_;
+    uint64_t m_barrier_epoch_ = 0;
     std::vector<KRSchedulerTask> m_main_thread_tasks_;
     std::vector<KRSchedulerTask> m_view_did_load_main_thread_tasks_;
     std::vector<KRSchedulerTask> m_did_end_main_thread_tasks_;
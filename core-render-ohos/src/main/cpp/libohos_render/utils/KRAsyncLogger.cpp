@@ -0,0 +1,145 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 THL A29 Limited, a Tencent company. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/utils/KRAsyncLogger.h"
+
+#include <pthread.h>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <thread>
+#include "libohos_render/adapter/KRRenderAdapterManager.h"
+
+namespace {
+
+/**
+ * 线程退出时标记其环形缓冲，剩余日志仍会被后台线程输出
+ */
+struct KRLogRingHolder {
+    std::shared_ptr<KRLogRing> ring;
+
+    ~KRLogRingHolder() {
+        if (ring) {
+            ring->MarkAbandoned();
+        }
+    }
+};
+
+thread_local KRLogRingHolder g_log_ring_holder;
+
+}  // namespace
+
+bool KRLogRing::TryPush(LogLevel level, std::string_view tag, std::string_view message) {
+    size_t tail = tail_.load(std::memory_order_relaxed);
+    if (tail - head_.load(std::memory_order_acquire) >= kCapacity) {
+        dropped_count_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    auto &record = slots_[tail & (kCapacity - 1)];
+    record.level = level;
+    record.tag_length = static_cast<uint16_t>(std::min(tag.size(), KRLogRecord::kMaxTagLength));
+    std::memcpy(record.tag, tag.data(), record.tag_length);
+    record.message_length = static_cast<uint16_t>(std::min(message.size(), KRLogRecord::kMaxMessageLength));
+    std::memcpy(record.message, message.data(), record.message_length);
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+KRAsyncLogger &KRAsyncLogger::GetInstance() {
+    // 不析构，静态对象析构阶段仍可能有日志写入
+    static KRAsyncLogger *instance = new KRAsyncLogger();
+    return *instance;
+}
+
+KRAsyncLogger::KRAsyncLogger() {
+    std::thread drain_thread([this] { DrainLoop(); });
+    pthread_setname_np(drain_thread.native_handle(), "KRLogDrainer");
+    drain_thread.detach();
+}
+
+void KRAsyncLogger::Write(LogLevel level, std::string_view tag, std::string_view message) {
+    auto &ring = g_log_ring_holder.ring;
+    if (ring == nullptr) {
+        ring = CreateCurrentThreadRing();
+    }
+    if (!ring->TryPush(level, tag, message)) {
+        return;
+    }
+    // 错误日志尽快输出；缓冲过半时提前唤醒，减少突发日志被丢弃
+    if (level >= LOG_ERROR || ring->Size() == KRLogRing::kCapacity / 2) {
+        wake_condition_.notify_one();
+    }
+}
+
+std::shared_ptr<KRLogRing> KRAsyncLogger::CreateCurrentThreadRing() {
+    auto ring = std::make_shared<KRLogRing>();
+    std::lock_guard<std::mutex> lock(rings_mutex_);
+    rings_.push_back(ring);
+    return ring;
+}
+
+void KRAsyncLogger::Flush() {
+    DrainOnce();
+}
+
+uint64_t KRAsyncLogger::DroppedCount() {
+    std::lock_guard<std::mutex> lock(rings_mutex_);
+    uint64_t dropped = retired_dropped_count_;
+    for (const auto &ring : rings_) {
+        dropped += ring->DroppedCount();
+    }
+    return dropped;
+}
+
+void KRAsyncLogger::DrainLoop() {
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(wake_mutex_);
+            wake_condition_.wait_for(lock, std::chrono::milliseconds(kDrainIntervalMs));
+        }
+        DrainOnce();
+    }
+}
+
+void KRAsyncLogger::DrainOnce() {
+    std::lock_guard<std::mutex> lock(drain_mutex_);
+    {
+        std::lock_guard<std::mutex> rings_lock(rings_mutex_);
+        // 所属线程已退出且已消费完的缓冲直接移除
+        auto removed = std::remove_if(rings_.begin(), rings_.end(), [](const std::shared_ptr<KRLogRing> &ring) {
+            return ring->IsAbandoned() && ring->Empty();
+        });
+        for (auto it = removed; it != rings_.end(); ++it) {
+            retired_dropped_count_ += (*it)->DroppedCount();
+        }
+        rings_.erase(removed, rings_.end());
+        draining_rings_.assign(rings_.begin(), rings_.end());
+    }
+    auto &adapter_manager = KRRenderAdapterManager::GetInstance();
+    for (const auto &ring : draining_rings_) {
+        ring->ConsumeAll([this, &adapter_manager](const KRLogRecord &record) {
+            drain_tag_.assign(record.tag, record.tag_length);
+            drain_message_.assign(record.message, record.message_length);
+            adapter_manager.Log(record.level, drain_tag_, drain_message_);
+        });
+    }
+    draining_rings_.clear();
+    uint64_t dropped = DroppedCount();
+    if (dropped > reported_dropped_count_) {
+        adapter_manager.Log(LOG_ERROR, "KRRender",
+                            "KRAsyncLogger dropped " + std::to_string(dropped - reported_dropped_count_) + " logs");
+        reported_dropped_count_ = dropped;
+    }
+}
@@ -0,0 +1,140 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 THL A29 Limited, a Tencent company. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRASYNCLOGGER_H
+#define CORE_RENDER_OHOS_KRASYNCLOGGER_H
+
+#include <hilog/log.h>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * 定长日志记录，写入环形缓冲时不需要分配内存
+ */
+struct KRLogRecord {
+    static constexpr size_t kMaxTagLength = 32;
+    static constexpr size_t kMaxMessageLength = 1000;
+
+    LogLevel level = LOG_INFO;
+    uint16_t tag_length = 0;
+    uint16_t message_length = 0;
+    char tag[kMaxTagLength];
+    char message[kMaxMessageLength];
+};
+
+/**
+ * 单生产者单消费者无锁环形缓冲，每个写日志的线程各持有一个，由后台线程统一消费
+ * 缓冲写满时丢弃新日志并计数
+ */
+class KRLogRing {
+ public:
+    static constexpr size_t kCapacity = 256;  // 必须为 2 的幂
+
+    KRLogRing() : slots_(new KRLogRecord[kCapacity]) {}
+
+    /**
+     * 仅由所属线程调用
+     */
+    bool TryPush(LogLevel level, std::string_view tag, std::string_view message);
+
+    /**
+     * 仅由消费线程调用，依次处理已写入的记录，返回处理条数
+     */
+    template <typename Consumer> size_t ConsumeAll(Consumer &&consumer) {
+        size_t head = head_.load(std::memory_order_relaxed);
+        size_t tail = tail_.load(std::memory_order_acquire);
+        size_t count = tail - head;
+        for (; head != tail; ++head) {
+            consumer(slots_[head & (kCapacity - 1)]);
+            head_.store(head + 1, std::memory_order_release);
+        }
+        return count;
+    }
+
+    size_t Size() const {
+        return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire);
+    }
+
+    bool Empty() const {
+        return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire);
+    }
+
+    uint64_t DroppedCount() const {
+        return dropped_count_.load(std::memory_order_relaxed);
+    }
+
+    void MarkAbandoned() {
+        abandoned_.store(true, std::memory_order_release);
+    }
+
+    bool IsAbandoned() const {
+        return abandoned_.load(std::memory_order_acquire);
+    }
+
+ private:
+    std::unique_ptr<KRLogRecord[]> slots_;
+    alignas(64) std::atomic<size_t> head_{0};  // 消费位置
+    alignas(64) std::atomic<size_t> tail_{0};  // 写入位置
+    std::atomic<uint64_t> dropped_count_{0};
+    std::atomic<bool> abandoned_{false};  // 所属线程已退出，消费完后移除
+};
+
+/**
+ * 异步日志：调用线程只做格式化和一次无锁写入，由单一后台线程转发给日志 adapter 或 hilog
+ */
+class KRAsyncLogger {
+ public:
+    static KRAsyncLogger &GetInstance();
+
+    void Write(LogLevel level, std::string_view tag, std::string_view message);
+
+    /**
+     * 同步输出所有已缓冲的日志，用于即将崩溃等场景
+     */
+    void Flush();
+
+    /**
+     * 因缓冲写满而丢弃的日志总数
+     */
+    uint64_t DroppedCount();
+
+ private:
+    KRAsyncLogger();
+
+    std::shared_ptr<KRLogRing> CreateCurrentThreadRing();
+    void DrainLoop();
+    void DrainOnce();
+
+    static constexpr int kDrainIntervalMs = 20;
+
+    std::mutex rings_mutex_;
+    std::vector<std::shared_ptr<KRLogRing>> rings_;
+    uint64_t retired_dropped_count_ = 0;  // 已移除缓冲的丢弃数，受 rings_mutex_ 保护
+    std::mutex drain_mutex_;              // 保证同一时刻只有一个消费者
+    std::vector<std::shared_ptr<KRLogRing>> draining_rings_;
+    std::string drain_tag_;
+    std::string drain_message_;
+    uint64_t reported_dropped_count_ = 0;  // 已输出过提示的丢弃数，受 drain_mutex_ 保护
+    std::mutex wake_mutex_;
+    std::condition_variable wake_condition_;
+};
+
+#endif  // CORE_RENDER_OHOS_KRASYNCLOGGER_H
@@ -15,6 +15,9 @@
 
 #include "KRBase64Util.h"
 
+#include <array>
+#include <cstdint>
+
 static const char HEX_DIGITS[] = "0123456789abcdef";
 // Maps integer in the range [0,16) to a hex digit.
 
@@ -28,20 +31,34 @@ static const char base64_chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
 
 std::string KRBase64Util::Encode(std::string_view in) {
     std::string out;
-    int val = 0, valb = -6;
-    for (unsigned char c : in) {
-        val = (val << 8) + c;
-        valb += 8;
-        while (valb >= 0) {
-            out.push_back(base64_chars[(val >> valb) & 0x3F]);
-            valb -= 6;
+    EncodeAppend(in, out);
+    return out;
+}
+
+void KRBase64Util::EncodeAppend(std::string_view in, std::string &out) {
+    size_t offset = out.size();
+    out.resize(offset + (in.size() + 2) / 3 * 4);
+    char *dst = &out[offset];
+    const auto *src = reinterpret_cast<const unsigned char *>(in.data());
+    size_t i = 0;
+    for (; i + 3 <= in.size(); i += 3) {
+        uint32_t v = (src[i] << 16) | (src[i + 1] << 8) | src[i + 2];
+        *dst++ = base64_chars[(v >> 18) & 0x3F];
+        *dst++ = base64_chars[(v >> 12) & 0x3F];
+        *dst++ = base64_chars[(v >> 6) & 0x3F];
+        *dst++ = base64_chars[v & 0x3F];
+    }
+    size_t rest = in.size() - i;
+    if (rest > 0) {
+        uint32_t v = src[i] << 16;
+        if (rest == 2) {
+            v |= src[i + 1] << 8;
         }
+        *dst++ = base64_chars[(v >> 18) & 0x3F];
+        *dst++ = base64_chars[(v >> 12) & 0x3F];
+        *dst++ = rest == 2 ? base64_chars[(v >> 6) & 0x3F] : '=';
+        *dst++ = '=';
     }
-    if (valb > -6)
-        out.push_back(base64_chars[((val << 8) >> (valb + 8)) & 0x3F]);
-    while (out.size() % 4)
-        out.push_back('=');
-    return out;
 }
 
 std::string KRBase64Util::Encode(const std::string &data) {
@@ -49,20 +66,34 @@ std::string KRBase64Util::Encode(const std::string &data) {
 }
 
 std::string KRBase64Util::Decode(std::string_view in) {
+    static const auto decode_table = [] {
+        std::array<int8_t, 256> table;
+        table.fill(-1);
+        for (int i = 0; i < 64; ++i) {
+            table[static_cast<unsigned char>(base64_chars[i])] = static_cast<int8_t>(i);
+        }
+        return table;
+    }();
     std::string out;
-    int val = 0, valb = -6;
+    out.reserve(in.size() / 4 * 3);
+    uint32_t val = 0;
+    int valb = -8;
     for (unsigned char c : in) {
-        val = (val << 8) + c;
-        valb += 8;
-        while (valb >= 0) {
-            out.push_back(base64_chars[(val >> valb) & 0x3F]);
-            valb -= 6;
+        int d = decode_table[c];
+        if (d < 0) {
+            if (c == '=') {
+                break;
+            }
+            continue;  // 跳过换行等非 base64 字符
+        }
+        // 只保留尚未输出的低位，避免移位溢出
+        val = ((val << 6) | static_cast<uint32_t>(d)) & 0xFFFFFF;
+        valb += 6;
+        if (valb >= 0) {
+            out.push_back(static_cast<char>((val >> valb) & 0xFF));
+            valb -= 8;
         }
     }
-    if (valb > -6)
-        out.push_back(base64_chars[((val << 8) >> (valb + 8)) & 0x3F]);
-    while (out.size() % 4)
-        out.push_back('=');
     return out;
 }
 
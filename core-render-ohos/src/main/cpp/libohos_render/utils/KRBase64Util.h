@@ -22,6 +22,10 @@ class KRBase64Util {
  public:
     static std::string Encode(std::string_view data);
     static std::string Encode(const std::string &data);
+    /**
+     * 编码结果直接追加到 out 末尾，避免生成中间字符串
+     */
+    static void EncodeAppend(std::string_view data, std::string &out);
     static std::string Decode(std::string_view data);
     static std::string Decode(const std::string &data);
 };
@@ -0,0 +1,197 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 THL A29 Limited, a Tencent company. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRBYTELRUCACHE_H
+#define CORE_RENDER_OHOS_KRBYTELRUCACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "libohos_render/foundation/thread/KRGCDQueue.h"
+
+/**
+ * 按字节预算淘汰的 LRU 缓存
+ * 本身不加锁，由持有方在自己的锁内调用；被淘汰或替换的值通过 evicted 交给调用方，便于在锁外释放
+ */
+template <typename Key, typename Value, typename Hash = std::hash<Key>> class KRByteLruCache {
+ public:
+    static constexpr size_t kUnlimited = SIZE_MAX;
+
+    explicit KRByteLruCache(size_t byte_budget = kUnlimited) : byte_budget_(byte_budget) {}
+
+    /**
+     * 命中时移到队头并返回值的指针（下一次修改缓存前有效），未命中返回 nullptr
+     */
+    Value *Get(const Key &key) {
+        auto it = index_.find(key);
+        if (it == index_.end()) {
+            miss_count_++;
+            return nullptr;
+        }
+        hit_count_++;
+        lru_.splice(lru_.begin(), lru_, it->second);
+        return &it->second->value;
+    }
+
+    /**
+     * 插入或替换；超过整个预算的值不缓存，返回 false
+     */
+    bool Put(const Key &key, Value value, size_t bytes, std::vector<Value> &evicted) {
+        Remove(key, evicted);
+        if (bytes > byte_budget_) {
+            return false;
+        }
+        Evict(byte_budget_ - bytes, evicted);
+        lru_.push_front(Entry{key, std::move(value), bytes});
+        index_[key] = lru_.begin();
+        total_bytes_ += bytes;
+        return true;
+    }
+
+    bool Remove(const Key &key, std::vector<Value> &evicted) {
+        auto it = index_.find(key);
+        if (it == index_.end()) {
+            return false;
+        }
+        total_bytes_ -= it->second->bytes;
+        evicted.push_back(std::move(it->second->value));
+        lru_.erase(it->second);
+        index_.erase(it);
+        return true;
+    }
+
+    /**
+     * 淘汰到不超过 target_bytes
+     */
+    void Evict(size_t target_bytes, std::vector<Value> &evicted) {
+        while (total_bytes_ > target_bytes && !lru_.empty()) {
+            auto &entry = lru_.back();
+            total_bytes_ -= entry.bytes;
+            evicted.push_back(std::move(entry.value));
+            index_.erase(entry.key);
+            lru_.pop_back();
+            eviction_count_++;
+        }
+    }
+
+    void SetByteBudget(size_t bytes, std::vector<Value> &evicted) {
+        byte_budget_ = bytes;
+        Evict(byte_budget_, evicted);
+    }
+
+    /**
+     * 内存压力回调（level 与 AbilityConstant.MemoryLevel 一致：0 中等，1 低，2 严重）
+     */
+    void OnMemoryLevel(int level, std::vector<Value> &evicted) {
+        switch (level) {
+        case 0:  // MEMORY_LEVEL_MODERATE
+            Evict(byte_budget_ / 2, evicted);
+            break;
+        case 1:  // MEMORY_LEVEL_LOW
+            Evict(byte_budget_ / 4, evicted);
+            break;
+        default:  // MEMORY_LEVEL_CRITICAL
+            Evict(0, evicted);
+            break;
+        }
+    }
+
+    size_t TotalBytes() const {
+        return total_bytes_;
+    }
+    size_t ByteBudget() const {
+        return byte_budget_;
+    }
+    size_t Count() const {
+        return lru_.size();
+    }
+    uint64_t HitCount() const {
+        return hit_count_;
+    }
+    uint64_t MissCount() const {
+        return miss_count_;
+    }
+    uint64_t EvictionCount() const {
+        return eviction_count_;
+    }
+
+ private:
+    struct Entry {
+        Key key;
+        Value value;
+        size_t bytes = 0;
+    };
+
+    size_t byte_budget_;
+    size_t total_bytes_ = 0;
+    uint64_t hit_count_ = 0;
+    uint64_t miss_count_ = 0;
+    uint64_t eviction_count_ = 0;
+    std::list<Entry> lru_;  // 头部为最近使用
+    std::unordered_map<Key, typename std::list<Entry>::iterator, Hash> index_;
+};
+
+/**
+ * 合并相同 key 的并发加载请求，同样由持有方加锁
+ */
+template <typename Key, typename Completion, typename Hash = std::hash<Key>> class KRRequestCoalescer {
+ public:
+    /**
+     * 登记请求，返回 true 表示该 key 的首个请求，调用方需要发起加载
+     */
+    bool Add(const Key &key, Completion completion) {
+        auto &completions = pending_[key];
+        completions.push_back(std::move(completion));
+        return completions.size() == 1;
+    }
+
+    bool Contains(const Key &key) const {
+        return pending_.find(key) != pending_.end();
+    }
+
+    /**
+     * 取出并移除该 key 上等待的全部请求
+     */
+    std::vector<Completion> Take(const Key &key) {
+        std::vector<Completion> completions;
+        auto it = pending_.find(key);
+        if (it != pending_.end()) {
+            completions = std::move(it->second);
+            pending_.erase(it);
+        }
+        return completions;
+    }
+
+ private:
+    std::unordered_map<Key, std::vector<Completion>, Hash> pending_;
+};
+
+/**
+ * 在子线程释放被淘汰的值，避免在主线程析构大块像素内存
+ */
+template <typename Value> void KRReleaseOnSubThread(std::vector<Value> values) {
+    if (values.empty()) {
+        return;
+    }
+    KRGCDQueue::GetInstance().DispatchAsync([values = std::move(values)] {
+        // sub thread release
+    });
+}
+
+#endif  // CORE_RENDER_OHOS_KRBYTELRUCACHE_H
@@ -18,37 +18,122 @@
 
 #include <arm-linux-ohos/asm/setup.h>
 #include <hilog/log.h>
+#include <algorithm>
+#include <charconv>
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include "libohos_render/adapter/KRRenderAdapterManager.h"
+#include "libohos_render/utils/KRAsyncLogger.h"
 
+/**
+ * 编译期日志等级过滤，低于该等级的日志语句不会生成代码，可通过 -DKR_LOG_MIN_LEVEL=LOG_INFO 配置
+ */
+#ifndef KR_LOG_MIN_LEVEL
+#define KR_LOG_MIN_LEVEL LOG_DEBUG
+#endif
+
+constexpr bool KRLogLevelEnabled(LogLevel log_level) {
+    return log_level >= KR_LOG_MIN_LEVEL;
+}
+
+/**
+ * 在栈上的定长缓冲中格式化单条日志，析构时写入 KRAsyncLogger，超长内容会被截断
+ */
 class KRRenderLog {
  public:
     explicit KRRenderLog(LogLevel log_level) : log_level_(log_level), tag_("KRRender") {}
-    KRRenderLog(LogLevel log_level, const std::string &tag) : log_level_(log_level), tag_(tag) {}
+    KRRenderLog(LogLevel log_level, std::string_view tag) : log_level_(log_level), tag_(tag) {}
 
     ~KRRenderLog() {
-        stream_ << std::endl;
-        KRRenderAdapterManager::GetInstance().Log(log_level_, tag_, std::move(stream_.str()));
+        Append('\n');
+        KRAsyncLogger::GetInstance().Write(log_level_, tag_, std::string_view(buffer_, length_));
     }
 
     template <typename T> KRRenderLog &operator<<(const T &value) {
-        stream_ << value;
+        if constexpr (std::is_same_v<T, bool>) {
+            Append(value ? '1' : '0');
+        } else if constexpr (std::is_same_v<T, char> || std::is_same_v<T, signed char> ||
+                             std::is_same_v<T, unsigned char>) {
+            Append(static_cast<char>(value));
+        } else if constexpr (std::is_integral_v<T>) {
+            AppendInteger(value);
+        } else if constexpr (std::is_floating_point_v<T>) {
+            AppendFormat("%g", static_cast<double>(value));
+        } else if constexpr (std::is_enum_v<T> && std::is_convertible_v<T, int>) {
+            AppendInteger(static_cast<std::underlying_type_t<T>>(value));
+        } else if constexpr (std::is_same_v<std::decay_t<T>, const char *> || std::is_same_v<std::decay_t<T>, char *>) {
+            const char *str = value;
+            Append(str != nullptr ? std::string_view(str) : std::string_view("(null)"));
+        } else if constexpr (std::is_convertible_v<const T &, std::string_view>) {
+            Append(std::string_view(value));
+        } else if constexpr (std::is_pointer_v<T>) {
+            AppendFormat("%p", static_cast<const void *>(value));
+        } else {
+            std::ostringstream stream;
+            stream << value;
+            Append(stream.str());
+        }
         return *this;
     }
 
  private:
-    std::string tag_;
+    void Append(char value) {
+        if (length_ < sizeof(buffer_)) {
+            buffer_[length_++] = value;
+        }
+    }
+
+    void Append(std::string_view value) {
+        size_t length = std::min(value.size(), sizeof(buffer_) - length_);
+        std::memcpy(buffer_ + length_, value.data(), length);
+        length_ += length;
+    }
+
+    template <typename T> void AppendInteger(T value) {
+        auto result = std::to_chars(buffer_ + length_, buffer_ + sizeof(buffer_), value);
+        if (result.ec == std::errc()) {
+            length_ = result.ptr - buffer_;
+        }
+    }
+
+    void AppendFormat(const char *format, ...) __attribute__((format(printf, 2, 3))) {
+        if (length_ >= sizeof(buffer_)) {
+            return;
+        }
+        va_list args;
+        va_start(args, format);
+        int written = vsnprintf(buffer_ + length_, sizeof(buffer_) - length_, format, args);
+        va_end(args);
+        if (written > 0) {
+            length_ = std::min(length_ + static_cast<size_t>(written), sizeof(buffer_) - 1);
+        }
+    }
+
     LogLevel log_level_;
-    std::stringstream stream_;
+    std::string_view tag_;
+    size_t length_ = 0;
+    char buffer_[KRLogRecord::kMaxMessageLength];
 };
 
-#define KR_LOG_INFO KRRenderLog(LOG_INFO)
-#define KR_LOG_DEBUG KRRenderLog(LOG_DEBUG)
-#define KR_LOG_ERROR KRRenderLog(LOG_ERROR)
+/**
+ * 等级被编译期关闭时整条语句（包括 << 右侧的表达式）都不会执行
+ */
+#define KR_LOG_WITH_LEVEL(log_level, ...)                                                                              \
+    if constexpr (!KRLogLevelEnabled(log_level)) {                                                                     \
+    } else                                                                                                             \
+        KRRenderLog(log_level, ##__VA_ARGS__)
+
+#define KR_LOG_INFO KR_LOG_WITH_LEVEL(LOG_INFO)
+#define KR_LOG_DEBUG KR_LOG_WITH_LEVEL(LOG_DEBUG)
+#define KR_LOG_ERROR KR_LOG_WITH_LEVEL(LOG_ERROR)
 
-#define KR_LOG_INFO_WITH_TAG(tag) KRRenderLog(LOG_INFO, tag)
-#define KR_LOG_DEBUG_WITH_TAG(tag) KRRenderLog(LOG_DEBUG, tag)
-#define KR_LOG_ERROR_WITH_TAG(tag) KRRenderLog(LOG_ERROR, tag)
+#define KR_LOG_INFO_WITH_TAG(tag) KR_LOG_WITH_LEVEL(LOG_INFO, tag)
+#define KR_LOG_DEBUG_WITH_TAG(tag) KR_LOG_WITH_LEVEL(LOG_DEBUG, tag)
+#define KR_LOG_ERROR_WITH_TAG(tag) KR_LOG_WITH_LEVEL(LOG_ERROR, tag)
 
 #endif  // CORE_RENDER_OHOS_KRRENDERLOGER_H
@@ -17,6 +17,7 @@
 
 #include <unistd.h>
 #include "libohos_render/scheduler/KRContextScheduler.h"
+#include "libohos_render/utils/KRRenderLoger.h"
 
 static __attribute__((always_inline)) bool isMainThread() {
     return getpid() == gettid();
@@ -29,6 +30,7 @@ void KREnsureMainThreadChecker(const char *file, unsigned int line, const char *
         OH_LOG_Print(LOG_APP, LOG_ERROR, 0x7, "ThreadChecker",
                      "Main Thread Check Failed. %{public}s %{public}d %{public}s", file, line, function);
         KR_LOG_ERROR << "Main Thread Check Failed. " << file << ":" << line << ":" << function;
+        KRAsyncLogger::GetInstance().Flush();
 
         __assert_fail("Main Thread Check Failed.", file, line, function);
     }
@@ -35,6 +35,19 @@ static napi_value OnLaunchStart(napi_env env, napi_callback_info info) {
     KRRenderManager::GetInstance().OnLaunchStart(instance_id);
     return 0;
 }
+//  ArkTs层内存压力事件
+static napi_value OnMemoryLevel(napi_env env, napi_callback_info info) {
+    size_t argc = 1;
+    napi_value args[1] = {nullptr};
+    if (napi_ok != napi_get_cb_info(env, info, &argc, args, nullptr, nullptr)) {
+        napi_throw_error(env, "-1000", "napi_get_cb_info error");
+        return 0;
+    }
+    int32_t level = 0;
+    napi_get_value_int32(env, args[0], &level);
+    KRRenderManager::GetInstance().OnMemoryLevel(level);
+    return 0;
+}
 static napi_value UpdateConfig(napi_env env, napi_callback_info info) {
     size_t argc = 2;
     napi_value args[2] = {nullptr};
@@ -207,6 +220,7 @@ static napi_value Init(napi_env env, napi_value exports) {
         {"sendEvent", nullptr, ArkTSOnSendEvent, nullptr, nullptr, nullptr, napi_default, nullptr},
         {"updateConfig", nullptr, UpdateConfig, nullptr, nullptr, nullptr, napi_default, nullptr},
         {"OnLaunchStart", nullptr, OnLaunchStart, nullptr, nullptr, nullptr, napi_default, nullptr},
+        {"onMemoryLevel", nullptr, OnMemoryLevel, nullptr, nullptr, nullptr, napi_default, nullptr},
         {"createNativeRoot", nullptr, CreateNativeRoot, nullptr, nullptr, nullptr, napi_default, nullptr},
         {"isBackPressConsumed", nullptr, isBackPressConsumed, nullptr, nullptr, nullptr, napi_default, nullptr},
     };
@@ -0,0 +1,146 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 THL A29 Limited, a Tencent company. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * APNGPixelOps 的离线校验与基准，不参与 libohos_render 构建，在开发机上单独编译运行：
+ *   g++ -O2 -std=c++17 -I. tools/APNGPixelOpsCheck.cpp \
+ *       libohos_render/expand/components/apng/APNGPixelOps.cpp -o apng_pixel_ops_check
+ * arm64 设备上用 NDK 的 clang++ 交叉编译即可覆盖 NEON 路径。
+ * 1. 与改造前 APNG::HandleFrameBlendOp 的浮点逐像素混合对比，每通道误差不超过 1（结果全透明时只比较 alpha）
+ * 2. SIMD 路径（BlendOverRect）与整数标量实现逐字节一致
+ * 3. 打印浮点、整数标量及 SIMD 三者的耗时
+ */
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include "libohos_render/expand/components/apng/APNGPixelOps.h"
+
+namespace {
+
+// 改造前的浮点混合实现（APNG_BLEND_OP_OVER），作为对比基准
+void BlendOverRowFloat(uint8_t *dst, const uint8_t *src, int width) {
+    for (int x = 0; x < width; ++x, src += 4, dst += 4) {
+        float srcAlpha = src[3] / 255.0f;
+        float dstAlpha = dst[3] / 255.0f;
+        float outAlpha = srcAlpha + dstAlpha * (1 - srcAlpha);
+        if (outAlpha == 0) {
+            memset(dst, 0, 4);
+            continue;
+        }
+        for (int c = 0; c < 3; ++c) {
+            dst[c] = static_cast<uint8_t>((src[c] * srcAlpha + dst[c] * dstAlpha * (1 - srcAlpha)) / outAlpha);
+        }
+        dst[3] = static_cast<uint8_t>(outAlpha * 255);
+    }
+}
+
+void BlendOverRowSimd(uint8_t *dst, const uint8_t *src, int width) {
+    APNGPixelOps::BlendOverRect(dst, static_cast<size_t>(width) * 4, src, static_cast<size_t>(width) * 4, width, 1);
+}
+
+// 确定性伪随机数（xorshift32）
+uint8_t NextByte(uint32_t &state) {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return static_cast<uint8_t>(state >> 24);
+}
+
+template <typename AlphaOf> void FillRow(std::vector<uint8_t> &row, int width, uint32_t &state, AlphaOf alpha_of) {
+    for (int x = 0; x < width; ++x) {
+        row[x * 4] = NextByte(state);
+        row[x * 4 + 1] = NextByte(state);
+        row[x * 4 + 2] = NextByte(state);
+        row[x * 4 + 3] = alpha_of(x);
+    }
+}
+
+// 返回与浮点基准的最大通道误差，全透明像素的颜色不参与比较
+int MaxDiffToFloat(const std::vector<uint8_t> &actual, const std::vector<uint8_t> &expected, int width) {
+    int max_diff = 0;
+    for (int x = 0; x < width; ++x) {
+        int channels = expected[x * 4 + 3] == 0 ? 1 : 4;
+        for (int c = 4 - channels; c < 4; ++c) {
+            max_diff = std::max(max_diff, std::abs(actual[x * 4 + c] - expected[x * 4 + c]));
+        }
+    }
+    return max_diff;
+}
+
+}  // namespace
+
+int main() {
+    constexpr int kWidth = 256;
+    uint32_t state = 0x12345678u;
+    std::vector<uint8_t> src(kWidth * 4);
+    std::vector<uint8_t> dst(kWidth * 4);
+    std::vector<uint8_t> by_float(kWidth * 4);
+    std::vector<uint8_t> by_scalar(kWidth * 4);
+    std::vector<uint8_t> by_simd(kWidth * 4);
+    int max_float_diff = 0;
+    bool simd_equal = true;
+    auto check_row = [&](int width) {
+        by_float = dst;
+        by_scalar = dst;
+        by_simd = dst;
+        BlendOverRowFloat(by_float.data(), src.data(), width);
+        APNGPixelOps::BlendOverRowScalar(by_scalar.data(), src.data(), width);
+        BlendOverRowSimd(by_simd.data(), src.data(), width);
+        max_float_diff = std::max(max_float_diff, MaxDiffToFloat(by_scalar, by_float, width));
+        simd_equal = simd_equal && memcmp(by_simd.data(), by_scalar.data(), static_cast<size_t>(width) * 4) == 0;
+    };
+    for (int row = 0; row < 256; ++row) {
+        auto alpha = static_cast<uint8_t>(row);
+        // src alpha 逐像素变化，dst alpha 整行相同，覆盖全部 alpha 组合
+        FillRow(src, kWidth, state, [](int x) { return static_cast<uint8_t>(x); });
+        FillRow(dst, kWidth, state, [alpha](int) { return alpha; });
+        check_row(kWidth);
+        // src alpha 整行相同（整块全透明 / 全不透明的快速路径），dst 不透明
+        FillRow(src, kWidth, state, [alpha](int) { return alpha; });
+        FillRow(dst, kWidth, state, [](int) { return static_cast<uint8_t>(255); });
+        check_row(kWidth);
+    }
+    // SIMD 分块之外的尾部像素
+    for (int width = 1; width <= 37; ++width) {
+        FillRow(src, width, state, [&state](int) { return NextByte(state); });
+        FillRow(dst, width, state, [](int) { return static_cast<uint8_t>(255); });
+        check_row(width);
+    }
+    printf("max channel diff to float: %d, simd equals scalar: %s\n", max_float_diff, simd_equal ? "yes" : "no");
+
+    // 512x512 不透明背景上混合半透明帧
+    constexpr int kBenchWidth = 512;
+    constexpr int kBenchRows = 512;
+    std::vector<uint8_t> frame(kBenchWidth * 4);
+    std::vector<uint8_t> canvas(kBenchWidth * 4);
+    FillRow(frame, kBenchWidth, state, [&state](int) { return NextByte(state); });
+    FillRow(canvas, kBenchWidth, state, [](int) { return static_cast<uint8_t>(255); });
+    auto time_frame = [&](void (*blend)(uint8_t *, const uint8_t *, int)) {
+        auto start = std::chrono::steady_clock::now();
+        for (int y = 0; y < kBenchRows; ++y) {
+            blend(canvas.data(), frame.data(), kBenchWidth);
+        }
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    };
+    auto float_us = time_frame(&BlendOverRowFloat);
+    auto scalar_us = time_frame(&APNGPixelOps::BlendOverRowScalar);
+    auto simd_us = time_frame(&BlendOverRowSimd);
+    printf("%dx%d blend, float: %lldus, scalar: %lldus, simd: %lldus\n", kBenchWidth, kBenchRows,
+           static_cast<long long>(float_us), static_cast<long long>(scalar_us), static_cast<long long>(simd_us));
+    return max_float_diff <= 1 && simd_equal ? 0 : 1;
+}
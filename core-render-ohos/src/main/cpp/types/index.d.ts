@@ -44,6 +44,11 @@ export const updateConfig: (instanceId: string, configJson: string) => number
  * @param excuteMode 运行模式
  */
 export const OnLaunchStart: (instanceId: string, excuteMode: number) => void
+/**
+ * 系统内存压力通知到Native层，用于裁剪进程级缓存。
+ * @param level 内存级别，与AbilityConstant.MemoryLevel一致
+ */
+export const onMemoryLevel: (level: number) => void
 /*
  * ArkTS调用Native侧方法唯一通信通道
  * @param instanceId 实例id
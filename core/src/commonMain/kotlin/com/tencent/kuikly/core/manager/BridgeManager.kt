@@ -317,6 +317,10 @@ object BridgeManager {
         callNativeMethod(NativeMethod.SET_TIMEOUT, instanceId, delayTimeMs, callbackId)
     }
 
+    fun clearTimeout(instanceId: String, callbackId: String) {
+        callNativeMethod(NativeMethod.CLEAR_TIMEOUT, instanceId, callbackId)
+    }
+
     fun callShadowMethod(
         instanceId: String,
         tag: Int,
@@ -359,4 +363,6 @@ object NativeMethod {
     const val FIRE_FATAL_EXCEPTION = 15 // "fireFatalException" 方法
     const val SYNC_FLUSH_UI = 16 // "syncFlushUI" 方法
     const val CALL_TDF_MODULE_METHOD = 17 // "callTDFModuleMethod" 方法
+    const val FLUSH_RENDER_COMMANDS = 18 // "flushRenderCommands" 方法（鸿蒙批量渲染指令）
+    const val CLEAR_TIMEOUT = 19 // "clearTimeout" 方法（鸿蒙取消原生定时器）
 }
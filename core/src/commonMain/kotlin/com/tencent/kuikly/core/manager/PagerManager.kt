@@ -36,6 +36,8 @@ object PagerManager {
         return pagerMap[pagerId] ?: throw PagerNotFoundException("pager not found: $pagerId")
     }
 
+    fun getPagerOrNull(pagerId: String): IPager? = pagerMap[pagerId]
+
     fun isPagerCreatorExist(pageName: String): Boolean {
         return pagerNameMap.containsKey(pageName.lowercase())
     }
@@ -37,6 +37,18 @@ class ImageCacheStatus{
 
 typealias ImageCacheCallback = (status: ImageCacheStatus) -> Unit
 
+/**
+ * 内存缓存统计，目前仅鸿蒙渲染层支持，其他平台各字段为 0
+ */
+class MemoryCacheStats {
+    var hits: Long = 0
+    var misses: Long = 0
+    var evictions: Long = 0
+    var bytes: Long = 0
+    var maxBytes: Long = 0
+    var count: Long = 0
+}
+
 class MemoryCacheModule : Module() {
 
     override fun moduleName(): String {
@@ -47,6 +59,8 @@ class MemoryCacheModule : Module() {
         const val MODULE_NAME = ModuleConst.MEMORY
         const val METHOD_SET_OBJECT = "setObject"
         const val METHOD_CACHE_IMAGE = "cacheImage"
+        const val METHOD_GET_STATS = "getStats"
+        const val METHOD_LISTEN_CACHE_MISS = "listenCacheMiss"
     }
 
     fun setObject(key: String, value: Any) {
@@ -60,6 +74,24 @@ class MemoryCacheModule : Module() {
         )
     }
 
+    /**
+     * 监听渲染层缓存未命中（如条目已被淘汰），回调参数为需要重新下发的 key，目前仅鸿蒙渲染层支持
+     */
+    fun listenCacheMiss(callback: (key: String) -> Unit) {
+        toNative(
+            true,
+            METHOD_LISTEN_CACHE_MISS,
+            null,
+            callback = { res ->
+                res?.optString("key", "")?.also {
+                    if (it.isNotEmpty()) {
+                        callback(it)
+                    }
+                }
+            }
+        )
+    }
+
     fun cacheImage(src: String, sync: Boolean, callback: ImageCacheCallback):ImageCacheStatus {
         val params = JSONObject()
         params.put("src", src)
@@ -100,4 +132,27 @@ class MemoryCacheModule : Module() {
             return status
         }
     }
-}
\ No newline at end of file
+
+    fun getStats(): MemoryCacheStats {
+        val stats = MemoryCacheStats()
+        val retStr = toNative(
+            false,
+            METHOD_GET_STATS,
+            null,
+            syncCall = true
+        ).toString()
+        try {
+            JSONObject(retStr).also {
+                stats.hits = it.optLong("hits", 0L)
+                stats.misses = it.optLong("misses", 0L)
+                stats.evictions = it.optLong("evictions", 0L)
+                stats.bytes = it.optLong("bytes", 0L)
+                stats.maxBytes = it.optLong("maxBytes", 0L)
+                stats.count = it.optLong("count", 0L)
+            }
+        } catch (e: Throwable) {
+            // 平台未实现时返回空统计
+        }
+        return stats
+    }
+}
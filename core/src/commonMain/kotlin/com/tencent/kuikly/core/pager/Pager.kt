@@ -55,6 +55,7 @@ abstract class Pager : ComposeView<ComposeAttr, ComposeEvent>(), IPager {
     private var layoutFinishTasks = fastArrayListOf<() -> Unit>()
     private var didCalculateLayoutTasks = fastArrayListOf<() -> Unit>()
     private val keyValueMap = fastHashMapOf<String, Any>()
+    private var listeningCacheMiss = false
     private var willDestroy = false
     private var pageTrace : PageCreateTrace? = null
     override val isDebugUIInspector by lazy { debugUIInspector() } // debug ui
@@ -262,7 +263,17 @@ abstract class Pager : ComposeView<ComposeAttr, ComposeEvent>(), IPager {
 
     override fun setMemoryCache(key: String, value: Any) {
         keyValueMap[key] = value
-        acquireModule<MemoryCacheModule>(MemoryCacheModule.MODULE_NAME).setObject(key, value)
+        val module = acquireModule<MemoryCacheModule>(MemoryCacheModule.MODULE_NAME)
+        if (!listeningCacheMiss && pageData.isOhOs) {
+            listeningCacheMiss = true
+            // 鸿蒙渲染层按内存预算淘汰后，读取未命中时请求重新下发
+            module.listenCacheMiss { missKey ->
+                keyValueMap[missKey]?.also {
+                    module.setObject(missKey, it)
+                }
+            }
+        }
+        module.setObject(key, value)
     }
 
     override fun getValueForKey(key: String): Any? {
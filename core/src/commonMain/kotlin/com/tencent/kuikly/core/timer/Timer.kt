@@ -19,6 +19,7 @@ import com.tencent.kuikly.core.base.PagerScope
 import com.tencent.kuikly.core.coroutines.*
 import com.tencent.kuikly.core.global.GlobalFunctions
 import com.tencent.kuikly.core.manager.BridgeManager
+import com.tencent.kuikly.core.manager.PagerManager
 /**
  * @brief Timer等价Android的Timer类功能(定时器)。
  */
@@ -110,11 +111,19 @@ fun PagerScope.setTimeout(timeout: Int = 0, callback: () -> Unit): String {
 
 @Deprecated("Use PagerScope.clearTimeout(timeoutRef) instead")
 fun clearTimeout(timeoutRef: String) {
-    GlobalFunctions.destroyGlobalFunction(BridgeManager.currentPageId, timeoutRef)
+    clearTimeout(BridgeManager.currentPageId, timeoutRef)
 }
 
 fun PagerScope.clearTimeout(timeoutRef: String) {
     // 用currentPageId兜底，以保持向前兼容
     val pagerId = this.pagerId.ifEmpty { BridgeManager.currentPageId }
+    clearTimeout(pagerId, timeoutRef)
+}
+
+private fun clearTimeout(pagerId: String, timeoutRef: String) {
     GlobalFunctions.destroyGlobalFunction(pagerId, timeoutRef)
+    // 鸿蒙侧定时器可取消，避免已清除的定时器到期后仍回调一次
+    if (PagerManager.getPagerOrNull(pagerId)?.pageData?.isOhOs == true) {
+        BridgeManager.clearTimeout(pagerId, timeoutRef)
+    }
 }
\ No newline at end of file
@@ -15,6 +15,9 @@
 
 package com.tencent.kuikly.core.nvi
 
+import com.tencent.kuikly.core.manager.NativeMethod
+import com.tencent.kuikly.core.manager.PagerManager
+
 typealias CallNativeCallback = (
     methodId: Int,
     arg0: Any?,
@@ -29,6 +32,8 @@ actual open class NativeBridge actual constructor() {
 
     var callNativeCallback: CallNativeCallback? = null
     private var pagerId = ""
+    private var renderCommandBuffer: RenderCommandBuffer? = null
+    private var renderCommandBatchEnabled: Boolean? = null
 
     actual fun toNative(
         methodId: Int,
@@ -42,10 +47,89 @@ actual open class NativeBridge actual constructor() {
         if (pagerId.isEmpty()) {
             pagerId = arg0 as String
         }
+        if (isRenderCommandBatchEnabled()) {
+            val buffer = renderCommandBuffer ?: RenderCommandBuffer().also { renderCommandBuffer = it }
+            if (buffer.append(methodId, arg1, arg2, arg3, arg4, arg5)) {
+                if (buffer.size >= MAX_BATCH_BYTES) {
+                    flushRenderCommands()
+                } else {
+                    pendingBridges.add(this)
+                }
+                return null
+            }
+            // 非批量指令需保证时序，先提交已缓存的渲染指令
+            flushRenderCommands()
+        }
         return callNativeCallback?.invoke(methodId, arg0, arg1, arg2, arg3, arg4, arg5)
     }
 
+    /**
+     * 页面参数 renderCommandBatch 优先，未设置时使用全局开关；页面创建后才确定，之后不再变化
+     */
+    private fun isRenderCommandBatchEnabled(): Boolean {
+        renderCommandBatchEnabled?.also {
+            return it
+        }
+        val params = PagerManager.getPagerOrNull(pagerId)?.pageData?.params ?: return enableRenderCommandBatch
+        val enabled = params.optBoolean(PARAM_RENDER_COMMAND_BATCH, enableRenderCommandBatch)
+        renderCommandBatchEnabled = enabled
+        return enabled
+    }
+
+    /**
+     * 将缓存的渲染指令一次性提交到 Native 侧
+     */
+    fun flushRenderCommands() {
+        pendingBridges.remove(this)
+        val buffer = renderCommandBuffer ?: return
+        if (buffer.isEmpty()) {
+            return
+        }
+        callNativeCallback?.invoke(
+            NativeMethod.FLUSH_RENDER_COMMANDS,
+            pagerId,
+            buffer.takeBytes(),
+            null,
+            null,
+            null,
+            null
+        )
+    }
+
     actual fun destroy() {
+        pendingBridges.remove(this)
+        renderCommandBuffer = null
+    }
+
+    companion object {
+        /**
+         * 是否开启批量渲染指令模式，开启后 createRenderView / insertSubRenderView /
+         * setViewProp / setRenderViewFrame 会先写入二进制缓冲区，在 kotlin 方法调用结束时统一提交
+         * 全局默认值，单个页面可通过页面参数 renderCommandBatch 覆盖
+         */
+        var enableRenderCommandBatch = false
+
+        /**
+         * 页面参数中控制批量渲染指令模式的 key，例如 pageData: { renderCommandBatch: true }
+         */
+        const val PARAM_RENDER_COMMAND_BATCH = "renderCommandBatch"
+
+        private const val MAX_BATCH_BYTES = 256 * 1024
+        private val pendingBridges = linkedSetOf<NativeBridge>()
+
+        /**
+         * 提交所有页面缓存的渲染指令，需在每次 native 调用 kotlin 结束时调用
+         */
+        fun flushAllRenderCommands() {
+            if (pendingBridges.isEmpty()) {
+                return
+            }
+            val bridges = pendingBridges.toList()
+            pendingBridges.clear()
+            for (bridge in bridges) {
+                bridge.flushRenderCommands()
+            }
+        }
     }
 
-}
\ No newline at end of file
+}
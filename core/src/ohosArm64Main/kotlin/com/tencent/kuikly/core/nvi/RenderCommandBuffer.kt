@@ -0,0 +1,189 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 THL A29 Limited, a Tencent company. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.tencent.kuikly.core.nvi
+
+import com.tencent.kuikly.core.manager.NativeMethod
+
+/**
+ * 鸿蒙批量渲染指令缓冲区，格式与 Native 侧 KRRenderCommandBuffer 一致（小端序）：
+ * 每条记录为 [type:u8][payload]，type 取值与 [NativeMethod] 相同；
+ * str = [length:u32][utf8]，value = [KRRenderCValue::Type:u8][payload]。
+ */
+internal class RenderCommandBuffer {
+
+    private var bytes = ByteArray(INITIAL_CAPACITY)
+
+    var size = 0
+        private set
+
+    fun isEmpty(): Boolean = size == 0
+
+    /**
+     * 尝试追加一条指令
+     * @return 该指令是否可被批量处理，不可批量处理时不写入任何数据
+     */
+    fun append(
+        methodId: Int,
+        arg1: Any?,
+        arg2: Any?,
+        arg3: Any?,
+        arg4: Any?,
+        arg5: Any?
+    ): Boolean {
+        when (methodId) {
+            NativeMethod.CREATE_RENDER_VIEW -> {
+                val tag = arg1 as? Int ?: return false
+                val viewName = arg2 as? String ?: return false
+                writeByte(methodId)
+                writeInt(tag)
+                writeString(viewName)
+            }
+            NativeMethod.INSERT_SUB_RENDER_VIEW -> {
+                val parentTag = arg1 as? Int ?: return false
+                val childTag = arg2 as? Int ?: return false
+                val index = arg3 as? Int ?: return false
+                writeByte(methodId)
+                writeInt(parentTag)
+                writeInt(childTag)
+                writeInt(index)
+            }
+            NativeMethod.SET_VIEW_PROP -> {
+                // 事件需要 Native 侧生成回调，走原有单次调用通道
+                if (arg4 == 1) {
+                    return false
+                }
+                val tag = arg1 as? Int ?: return false
+                val propKey = arg2 as? String ?: return false
+                if (!isEncodableValue(arg3)) {
+                    return false
+                }
+                writeByte(methodId)
+                writeInt(tag)
+                writeString(propKey)
+                writeValue(arg3)
+            }
+            NativeMethod.SET_RENDER_VIEW_FRAME -> {
+                val tag = arg1 as? Int ?: return false
+                writeByte(methodId)
+                writeInt(tag)
+                writeFloat((arg2 as? Float) ?: 0f)
+                writeFloat((arg3 as? Float) ?: 0f)
+                writeFloat((arg4 as? Float) ?: 0f)
+                writeFloat((arg5 as? Float) ?: 0f)
+            }
+            else -> return false
+        }
+        return true
+    }
+
+    /**
+     * 取出已写入的指令数据并清空缓冲区
+     */
+    fun takeBytes(): ByteArray {
+        val result = bytes.copyOf(size)
+        size = 0
+        return result
+    }
+
+    private fun isEncodableValue(value: Any?): Boolean {
+        return value == null || value is Int || value is Long || value is Float ||
+                value is Double || value is Boolean || value is String
+    }
+
+    private fun writeValue(value: Any?) {
+        when (value) {
+            is Int -> {
+                writeByte(TYPE_INT)
+                writeInt(value)
+            }
+            is Long -> {
+                writeByte(TYPE_LONG)
+                writeLong(value)
+            }
+            is Float -> {
+                writeByte(TYPE_FLOAT)
+                writeFloat(value)
+            }
+            is Double -> {
+                writeByte(TYPE_DOUBLE)
+                writeLong(value.toRawBits())
+            }
+            is Boolean -> {
+                writeByte(TYPE_BOOL)
+                writeByte(if (value) 1 else 0)
+            }
+            is String -> {
+                writeByte(TYPE_STRING)
+                writeString(value)
+            }
+            else -> writeByte(TYPE_NULL)
+        }
+    }
+
+    private fun ensureCapacity(extra: Int) {
+        val required = size + extra
+        if (required > bytes.size) {
+            var newCapacity = bytes.size * 2
+            while (newCapacity < required) {
+                newCapacity *= 2
+            }
+            bytes = bytes.copyOf(newCapacity)
+        }
+    }
+
+    private fun writeByte(value: Int) {
+        ensureCapacity(1)
+        bytes[size++] = value.toByte()
+    }
+
+    private fun writeInt(value: Int) {
+        ensureCapacity(4)
+        bytes[size++] = value.toByte()
+        bytes[size++] = (value ushr 8).toByte()
+        bytes[size++] = (value ushr 16).toByte()
+        bytes[size++] = (value ushr 24).toByte()
+    }
+
+    private fun writeLong(value: Long) {
+        writeInt(value.toInt())
+        writeInt((value ushr 32).toInt())
+    }
+
+    private fun writeFloat(value: Float) {
+        writeInt(value.toRawBits())
+    }
+
+    private fun writeString(value: String) {
+        val utf8 = value.encodeToByteArray()
+        writeInt(utf8.size)
+        ensureCapacity(utf8.size)
+        utf8.copyInto(bytes, size)
+        size += utf8.size
+    }
+
+    companion object {
+        private const val INITIAL_CAPACITY = 4 * 1024
+
+        // 与 KRRenderCValue::Type 保持一致
+        private const val TYPE_NULL = 0
+        private const val TYPE_INT = 1
+        private const val TYPE_LONG = 2
+        private const val TYPE_FLOAT = 3
+        private const val TYPE_DOUBLE = 4
+        private const val TYPE_BOOL = 5
+        private const val TYPE_STRING = 6
+    }
+}